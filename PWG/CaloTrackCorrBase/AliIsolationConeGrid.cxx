@@ -0,0 +1,291 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+// --- ROOT system ---
+#include <TMath.h>
+#include <algorithm>
+
+#include "AliIsolationConeGrid.h"
+
+/// \cond CLASSIMP
+ClassImp(AliIsolationConeGrid) ;
+/// \endcond
+
+//____________________________________
+/// Default constructor.
+/// Cells of about 0.1x0.1 over the central barrel.
+//____________________________________
+AliIsolationConeGrid::AliIsolationConeGrid() :
+TObject(),
+fNEta(20),           fNPhi(64),
+fEtaMin(-1.),        fEtaMax(1.),
+fEta(),              fPhi(),          fPt(),
+fIndex(),            fCell(),
+fCellOffset(),       fCellSlots(),
+fStamp(),            fCurrentStamp(0),
+fSelected()
+{
+}
+
+//____________________________________
+/// Constructor with binning.
+//____________________________________
+AliIsolationConeGrid::AliIsolationConeGrid(Int_t nEta, Float_t etaMin, Float_t etaMax, Int_t nPhi) :
+TObject(),
+fNEta(nEta),         fNPhi(nPhi),
+fEtaMin(etaMin),     fEtaMax(etaMax),
+fEta(),              fPhi(),          fPt(),
+fIndex(),            fCell(),
+fCellOffset(),       fCellSlots(),
+fStamp(),            fCurrentStamp(0),
+fSelected()
+{
+  SetBinning(nEta, etaMin, etaMax, nPhi);
+}
+
+//____________________________________
+/// Set the cells, to be done before filling.
+/// Particles out of the eta range go to the border cells.
+//____________________________________
+void AliIsolationConeGrid::SetBinning(Int_t nEta, Float_t etaMin, Float_t etaMax, Int_t nPhi)
+{
+  fNEta   = nEta > 0 ? nEta : 1;
+  fNPhi   = nPhi > 0 ? nPhi : 1;
+  fEtaMin = etaMin;
+  fEtaMax = etaMax > etaMin ? etaMax : etaMin+1;
+}
+
+//____________________________________
+/// Remove all particles, keep the allocated memory.
+//____________________________________
+void AliIsolationConeGrid::Reset()
+{
+  fEta  .clear();
+  fPhi  .clear();
+  fPt   .clear();
+  fIndex.clear();
+  fCell .clear();
+  fCellSlots.clear();
+  fCellOffset.assign(fNEta*fNPhi+1, 0);
+  fSelected.clear();
+}
+
+//____________________________________
+/// Add one particle.
+/// \param eta: pseudorapidity.
+/// \param phi: azimuthal angle, any range.
+/// \param pt: transverse momentum.
+/// \param index: index of the particle in the original array.
+//____________________________________
+void AliIsolationConeGrid::Add(Float_t eta, Float_t phi, Float_t pt, Int_t index)
+{
+  while ( phi <  0                ) phi += TMath::TwoPi();
+  while ( phi >= TMath::TwoPi()   ) phi -= TMath::TwoPi();
+
+  fEta  .push_back(eta);
+  fPhi  .push_back(phi);
+  fPt   .push_back(pt);
+  fIndex.push_back(index);
+  fCell .push_back(EtaBin(eta)*fNPhi + PhiBin(phi));
+}
+
+//____________________________________
+/// Sort the particles by cell (counting sort, keeps the insertion order inside a cell).
+//____________________________________
+void AliIsolationConeGrid::Build()
+{
+  Int_t nCells = fNEta*fNPhi;
+  Int_t nPart  = fCell.size();
+
+  fCellOffset.assign(nCells+1, 0);
+  for(Int_t islot = 0; islot < nPart; islot++) fCellOffset[fCell[islot]+1]++;
+  for(Int_t icell = 0; icell < nCells; icell++) fCellOffset[icell+1] += fCellOffset[icell];
+
+  fCellSlots.resize(nPart);
+  std::vector<Int_t> fill(fCellOffset.begin(), fCellOffset.end()-1);
+  for(Int_t islot = 0; islot < nPart; islot++) fCellSlots[fill[fCell[islot]]++] = islot;
+
+  fStamp.assign(nPart, 0);
+  fCurrentStamp = 0;
+}
+
+//____________________________________
+/// Start a new selection of regions.
+//____________________________________
+void AliIsolationConeGrid::ClearSelection()
+{
+  fSelected.clear();
+  fCurrentStamp++;
+  if ( fCurrentStamp == 0 )
+  { // wrapped around, reset stamps
+    fStamp.assign(fStamp.size(), 0);
+    fCurrentStamp = 1;
+  }
+}
+
+//____________________________________
+/// Add to the selection the particles in the cells overlapping
+/// with the eta-phi rectangle. It is a superset of the particles
+/// inside the rectangle, the caller still applies its own cuts.
+/// The phi range can go below 0 or above 2pi.
+//____________________________________
+void AliIsolationConeGrid::SelectRegion(Float_t etaMin, Float_t etaMax, Float_t phiMin, Float_t phiMax)
+{
+  if ( fCellOffset.empty() ) return;
+
+  // Widen slightly the region, so that particles on its border
+  // are not lost to rounding when binned
+  const Float_t margin = 1.e-4;
+  etaMin -= margin; etaMax += margin;
+  phiMin -= margin; phiMax += margin;
+
+  Int_t ieta1 = EtaBin(etaMin);
+  Int_t ieta2 = EtaBin(etaMax);
+
+  Int_t iphi1 = 0, nphi = 0;
+  GetPhiBinRange(phiMin, phiMax, iphi1, nphi);
+
+  for(Int_t ieta = ieta1; ieta <= ieta2; ieta++)
+  {
+    for(Int_t k = 0; k < nphi; k++)
+    {
+      Int_t icell = ieta*fNPhi + (iphi1+k)%fNPhi;
+      for(Int_t j = fCellOffset[icell]; j < fCellOffset[icell+1]; j++)
+      {
+        Int_t islot = fCellSlots[j];
+        if ( fStamp[islot] == fCurrentStamp ) continue;
+        fStamp[islot] = fCurrentStamp;
+        fSelected.push_back(islot);
+      }
+    }
+  }
+}
+
+//____________________________________
+/// \return the original indices of the selected particles,
+/// in increasing order, as in a loop on the full array.
+//____________________________________
+const std::vector<Int_t> & AliIsolationConeGrid::GetSelectedIndices()
+{
+  // slots are filled in the order of the original array
+  std::sort(fSelected.begin(), fSelected.end());
+  for(UInt_t i = 0; i < fSelected.size(); i++) fSelected[i] = fIndex[fSelected[i]];
+  return fSelected;
+}
+
+//____________________________________
+/// Sum pT of the particles inside several cone radii around (etaC,phiC)
+/// in a single pass on the cells around the largest cone.
+/// A particle is inside the cone of radius R if its distance is below R.
+/// \param etaC: pseudorapidity of the cone axis.
+/// \param phiC: azimuthal angle of the cone axis.
+/// \param nRadii: number of radii.
+/// \param radii: cone radii.
+/// \param sumPt: sum pT in each cone, output.
+//____________________________________
+void AliIsolationConeGrid::GetSumPtInCones(Float_t etaC, Float_t phiC, Int_t nRadii,
+                                           const Float_t * radii, Float_t * sumPt) const
+{
+  Float_t rMax = 0;
+  for(Int_t ir = 0; ir < nRadii; ir++)
+  {
+    sumPt[ir] = 0;
+    if ( radii[ir] > rMax ) rMax = radii[ir];
+  }
+
+  if ( fCellOffset.empty() || rMax <= 0 ) return;
+
+  Float_t range = rMax + 1.e-4; // same margin as in SelectRegion
+
+  Int_t ieta1 = EtaBin(etaC-range);
+  Int_t ieta2 = EtaBin(etaC+range);
+
+  Int_t iphi1 = 0, nphi = 0;
+  GetPhiBinRange(phiC-range, phiC+range, iphi1, nphi);
+
+  for(Int_t ieta = ieta1; ieta <= ieta2; ieta++)
+  {
+    for(Int_t k = 0; k < nphi; k++)
+    {
+      Int_t icell = ieta*fNPhi + (iphi1+k)%fNPhi;
+      for(Int_t j = fCellOffset[icell]; j < fCellOffset[icell+1]; j++)
+      {
+        Int_t   islot = fCellSlots[j];
+        Float_t dEta  = etaC - fEta[islot];
+        Float_t dPhi  = DeltaPhi(phiC, fPhi[islot]);
+        Float_t r2    = dEta*dEta + dPhi*dPhi;
+        for(Int_t ir = 0; ir < nRadii; ir++)
+        {
+          if ( r2 < radii[ir]*radii[ir] ) sumPt[ir] += fPt[islot];
+        }
+      }
+    }
+  }
+}
+
+//____________________________________
+/// \return the phi distance between two angles, wrapped in [0,pi].
+//____________________________________
+Float_t AliIsolationConeGrid::DeltaPhi(Float_t phi1, Float_t phi2)
+{
+  Float_t dPhi = TMath::Abs(phi1-phi2);
+  while ( dPhi > TMath::TwoPi() ) dPhi -= TMath::TwoPi();
+  if ( dPhi >= TMath::Pi() ) dPhi = TMath::TwoPi()-dPhi;
+  return dPhi;
+}
+
+//____________________________________
+/// \return eta cell, clamped to the grid.
+//____________________________________
+Int_t AliIsolationConeGrid::EtaBin(Float_t eta) const
+{
+  Int_t ieta = TMath::FloorNint((eta-fEtaMin)/(fEtaMax-fEtaMin)*fNEta);
+  if ( ieta < 0      ) ieta = 0;
+  if ( ieta >= fNEta ) ieta = fNEta-1;
+  return ieta;
+}
+
+//____________________________________
+/// \return phi cell of an angle in [0,2pi[.
+//____________________________________
+Int_t AliIsolationConeGrid::PhiBin(Float_t phi) const
+{
+  Int_t iphi = TMath::FloorNint(phi/(TMath::TwoPi()/fNPhi));
+  if ( iphi < 0      ) iphi = 0;
+  if ( iphi >= fNPhi ) iphi = fNPhi-1;
+  return iphi;
+}
+
+//____________________________________
+/// Cells covering the phi range [phiMin,phiMax], any range:
+/// first cell and number of consecutive cells, modulo fNPhi.
+//____________________________________
+void AliIsolationConeGrid::GetPhiBinRange(Float_t phiMin, Float_t phiMax, Int_t & first, Int_t & nBins) const
+{
+  if ( phiMax-phiMin >= TMath::TwoPi() )
+  {
+    first = 0;
+    nBins = fNPhi;
+    return;
+  }
+
+  Float_t binWidth = TMath::TwoPi()/fNPhi;
+  Int_t   k1       = TMath::FloorNint(phiMin/binWidth);
+  Int_t   k2       = TMath::FloorNint(phiMax/binWidth);
+
+  first = ((k1 % fNPhi) + fNPhi) % fNPhi;
+  nBins = k2-k1+1;
+  if ( nBins > fNPhi ) nBins = fNPhi;
+}
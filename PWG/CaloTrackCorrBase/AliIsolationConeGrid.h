@@ -0,0 +1,100 @@
+#ifndef ALIISOLATIONCONEGRID_H
+#define ALIISOLATIONCONEGRID_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice     */
+
+//_________________________________________________________________________
+/// \class AliIsolationConeGrid
+/// \ingroup CaloTrackCorrelationsBase
+/// \brief Eta-phi grid index of the tracks or clusters of an event.
+///
+/// The particles of an event are bucketed once in (eta,phi) cells, so that
+/// the isolation cone, the UE bands or the perpendicular cones of a candidate
+/// can be evaluated visiting only the cells that overlap with them instead of
+/// the full list of particles.
+///
+/// Two kinds of queries:
+///  * region selection (SelectRegion, several regions can be combined): returns
+///    the indices in the original array of the particles in the selected cells,
+///    in increasing order, to run the same per-particle code on a reduced list.
+///  * cone sums (GetSumPtInCones): sum pT inside several cone radii in one pass.
+///
+/// Phi is internally in [0,2pi[ and the phi distance is wrapped, as in
+/// AliIsolationCut::Radius.
+//_________________________________________________________________________
+
+// --- ROOT system ---
+#include <TObject.h>
+#include <vector>
+
+class AliIsolationConeGrid : public TObject {
+
+ public:
+
+  AliIsolationConeGrid() ;
+  AliIsolationConeGrid(Int_t nEta, Float_t etaMin, Float_t etaMax, Int_t nPhi) ;
+
+  /// Virtual destructor.
+  virtual ~AliIsolationConeGrid() { ; }
+
+  void       SetBinning(Int_t nEta, Float_t etaMin, Float_t etaMax, Int_t nPhi) ;
+
+  // Filling, once per event
+
+  void       Reset() ;
+  void       Add(Float_t eta, Float_t phi, Float_t pt, Int_t index) ;
+  void       Build() ;
+
+  Int_t      GetNParticles()      const { return fEta.size()     ; }
+  Float_t    GetEta  (Int_t slot) const { return fEta  [slot]    ; }
+  Float_t    GetPhi  (Int_t slot) const { return fPhi  [slot]    ; }
+  Float_t    GetPt   (Int_t slot) const { return fPt   [slot]    ; }
+  Int_t      GetIndex(Int_t slot) const { return fIndex[slot]    ; }
+
+  // Queries, per candidate
+
+  void       ClearSelection() ;
+  void       SelectRegion(Float_t etaMin, Float_t etaMax, Float_t phiMin, Float_t phiMax) ;
+  const std::vector<Int_t> & GetSelectedIndices() ;
+
+  void       GetSumPtInCones(Float_t etaC, Float_t phiC, Int_t nRadii,
+                             const Float_t * radii, Float_t * sumPt) const ;
+
+  static Float_t DeltaPhi(Float_t phi1, Float_t phi2) ;
+
+ private:
+
+  Int_t      EtaBin(Float_t eta) const ;
+  Int_t      PhiBin(Float_t phi) const ;
+  void       GetPhiBinRange(Float_t phiMin, Float_t phiMax, Int_t & first, Int_t & nBins) const ;
+
+  Int_t      fNEta;                    ///< Number of cells in eta.
+  Int_t      fNPhi;                    ///< Number of cells in phi, over 2pi.
+  Float_t    fEtaMin;                  ///< Lower eta edge, particles below go to the first cell.
+  Float_t    fEtaMax;                  ///< Upper eta edge, particles above go to the last cell.
+
+  std::vector<Float_t> fEta;           //!<! Eta of each particle.
+  std::vector<Float_t> fPhi;           //!<! Phi of each particle, in [0,2pi[.
+  std::vector<Float_t> fPt;            //!<! pT of each particle.
+  std::vector<Int_t>   fIndex;         //!<! Index of each particle in the original array.
+  std::vector<Int_t>   fCell;          //!<! Cell of each particle.
+  std::vector<Int_t>   fCellOffset;    //!<! Start of each cell in fCellSlots, size number of cells+1.
+  std::vector<Int_t>   fCellSlots;     //!<! Particles sorted by cell.
+
+  std::vector<UInt_t>  fStamp;         //!<! Selection stamp of each particle, avoids double counting of overlapping regions.
+  UInt_t               fCurrentStamp;  //!<! Stamp of the current selection.
+  std::vector<Int_t>   fSelected;      //!<! Selected particles, original indices.
+
+  /// Copy constructor not implemented.
+  AliIsolationConeGrid(              const AliIsolationConeGrid & g) ;
+
+  /// Assignment operator not implemented.
+  AliIsolationConeGrid & operator = (const AliIsolationConeGrid & g) ;
+
+  /// \cond CLASSIMP
+  ClassDef(AliIsolationConeGrid,1) ;
+  /// \endcond
+
+} ;
+
+#endif //ALIISOLATIONCONEGRID_H
@@ -48,8 +48,11 @@ fConeSize(0.),       fPtThreshold(0.),              fPtThresholdMax(10000.),
 fSumPtThreshold(0.), fSumPtThresholdMax(10000.),    fPtFraction(0.),     
 fICMethod(0),        fPartInCone(0),
 fFracIsThresh(1),    fIsTMClusterInConeRejected(1), fDistMinToTrigger(-1.),
-fNeutralOverChargedRatio(0),
+fNeutralOverChargedRatio(0),                        fUseConeGrid(0),
 fDebug(0),           fMomentum(),                   fTrackVector(),
+fTrackGrid(),        fClusterGrid(),
+fTrackGridList(0),   fTrackGridEvent(-1),           fTrackGridEntries(-1),
+fClusterGridList(0), fClusterGridEvent(-1),         fClusterGridEntries(-1),
 fEMCEtaSize(-1),     fEMCPhiMin(-1),                fEMCPhiMax(-1),
 fTPCEtaSize(-1),     fTPCPhiSize(-1),
 // Histograms
@@ -177,11 +180,34 @@ void AliIsolationCut::CalculateCaloSignalInCone
   TObjArray * refclusters  = 0x0;
   Int_t       nclusterrefs = 0;
   
+  // Restrict the loop to the clusters in the grid cells around the cone
+  // and UE bands. Not when all clusters eta-phi are histogrammed.
+  //
+  const std::vector<Int_t> * selected = 0x0;
+  if ( fUseConeGrid && !bgCls && !useRefs && !(fFillHistograms && fFillEtaPhiHistograms) &&
+       UpdateConeGrid(fClusterGrid, plNe, reader, kFALSE, fClusterGridList, fClusterGridEvent, fClusterGridEntries) )
+  {
+    fClusterGrid.ClearSelection();
+    fClusterGrid.SelectRegion(etaC-fConeSize, etaC+fConeSize, phiC-fConeSize, phiC+fConeSize);
+    
+    if ( fICMethod >= kSumBkgSubIC )
+    {
+      fClusterGrid.SelectRegion(etaC-fConeSize, etaC+fConeSize, 0, TMath::TwoPi()); // phi band
+      fClusterGrid.SelectRegion(-100, 100, phiC-fConeSize, phiC+fConeSize);        // eta band
+    }
+    
+    selected = &(fClusterGrid.GetSelectedIndices());
+  }
+  
+  Int_t nLoop = selected ? selected->size() : plNe->GetEntries();
+  
   // Get the clusters
   //
   //printf("Loop calo\n");
-  for(Int_t ipr = 0;ipr < plNe->GetEntries() ; ipr ++ )
+  for(Int_t iloop = 0; iloop < nLoop; iloop++)
   {
+    Int_t ipr = selected ? (*selected)[iloop] : iloop;
+    
     AliVCluster * calo = dynamic_cast<AliVCluster *>(plNe->At(ipr)) ;
     
     if ( calo )
@@ -490,12 +516,45 @@ void AliIsolationCut::CalculateTrackSignalInCone
   TObjArray * reftracks  = 0x0;
   Int_t       ntrackrefs = 0;
     
+  //-----------------------------------------------------------
+  // Restrict the loop to the tracks in the grid cells around the cone,
+  // UE bands and perpendicular cones.
+  // Not when all tracks eta-phi are histogrammed.
+  //-----------------------------------------------------------
+  const std::vector<Int_t> * selected = 0x0;
+  if ( fUseConeGrid && !bgTrk && !useRefs && !(fFillHistograms && fFillEtaPhiHistograms) &&
+       UpdateConeGrid(fTrackGrid, plCTS, reader, kTRUE, fTrackGridList, fTrackGridEvent, fTrackGridEntries) )
+  {
+    fTrackGrid.ClearSelection();
+    fTrackGrid.SelectRegion(etaTrig-fConeSize, etaTrig+fConeSize, phiTrig-fConeSize, phiTrig+fConeSize);
+    
+    if ( fICMethod >= kSumBkgSubIC )
+    {
+      fTrackGrid.SelectRegion(etaTrig-fConeSize, etaTrig+fConeSize, 0, TMath::TwoPi()); // phi band
+      fTrackGrid.SelectRegion(-100, 100, phiTrig-fConeSize, phiTrig+fConeSize);        // eta band
+    }
+    
+    if ( fICMethod == kSumBkgSubIC )
+    {
+      fTrackGrid.SelectRegion(etaTrig-fConeSize, etaTrig+fConeSize,
+                              phiTrig+TMath::PiOver2()-fConeSize, phiTrig+TMath::PiOver2()+fConeSize);
+      fTrackGrid.SelectRegion(etaTrig-fConeSize, etaTrig+fConeSize,
+                              phiTrig-TMath::PiOver2()-fConeSize, phiTrig-TMath::PiOver2()+fConeSize);
+    }
+    
+    selected = &(fTrackGrid.GetSelectedIndices());
+  }
+  
+  Int_t nLoop = selected ? selected->size() : plCTS->GetEntries();
+  
   //-----------------------------------------------------------
   // Get the tracks in cone
   //
   //-----------------------------------------------------------
-  for(Int_t ipr = 0;ipr < plCTS->GetEntries() ; ipr ++ )
+  for(Int_t iloop = 0; iloop < nLoop; iloop++)
   {
+    Int_t ipr = selected ? (*selected)[iloop] : iloop;
+    
     AliVTrack* track = dynamic_cast<AliVTrack*>(plCTS->At(ipr)) ;
     
     if(track)
@@ -869,6 +928,247 @@ void AliIsolationCut::CalculateExcessAreaFractionForChargedAndNeutral
   excessAreaClsPhi = CalculateExcessAreaFraction(excessClsPhi);
 }
 
+//_________________________________________________________________________________________________________________________________
+/// Sum pT of clusters and tracks in several cone radii in a single pass on the
+/// particles in the cells around the largest cone, for cone size studies.
+/// Same particle selection as CalculateCaloSignalInCone and CalculateTrackSignalInCone
+/// (candidate daughters, track-matched clusters, fDistMinToTrigger, same side), on
+/// the reader arrays. Particles at a distance exactly equal to the radius are counted.
+///
+/// \param pCandidate: Kinematics and + of candidate particle for isolation.
+/// \param reader: pointer to AliCaloTrackReader. Needed to access event info.
+/// \param calorimeter: Which input trigger calorimeter used
+/// \param pid: pointer to AliCaloPID. Needed to reject matched clusters in isolation cone.
+/// \param nRadii: number of cone radii.
+/// \param radii: cone radii.
+/// \param sumPtCluster: sum pT of clusters in each cone, output, can be null.
+/// \param sumPtTrack: sum pT of tracks in each cone, output, can be null.
+//_________________________________________________________________________________________________________________________________
+void AliIsolationCut::CalculateSumPtInCones
+(
+ AliCaloTrackParticleCorrelation * pCandidate, AliCaloTrackReader * reader,
+ Int_t     calorimeter        , AliCaloPID * pid,
+ Int_t     nRadii             , const Float_t * radii,
+ Float_t * sumPtCluster       , Float_t * sumPtTrack
+)
+{
+  Float_t rMax = 0;
+  for(Int_t ir = 0; ir < nRadii; ir++)
+  {
+    if ( sumPtCluster ) sumPtCluster[ir] = 0;
+    if ( sumPtTrack   ) sumPtTrack  [ir] = 0;
+    if ( radii[ir] > rMax ) rMax = radii[ir];
+  }
+  
+  Float_t phiC  = pCandidate->Phi() ;
+  if ( phiC < 0 ) phiC+=TMath::TwoPi();
+  Float_t etaC  = pCandidate->Eta() ;
+  
+  Float_t pt  = -100. ;
+  Float_t eta = -100. ;
+  Float_t phi = -100. ;
+  Float_t rad = -100. ;
+  
+  // Clusters
+  //
+  TObjArray * plNe = 0x0;
+  if      ( calorimeter == AliFiducialCut::kPHOS  ) plNe = reader->GetPHOSClusters();
+  else if ( calorimeter == AliFiducialCut::kEMCAL ) plNe = reader->GetEMCALClusters();
+  
+  if ( sumPtCluster && plNe && fPartInCone != kOnlyCharged &&
+       UpdateConeGrid(fClusterGrid, plNe, reader, kFALSE, fClusterGridList, fClusterGridEvent, fClusterGridEntries) )
+  {
+    fClusterGrid.ClearSelection();
+    fClusterGrid.SelectRegion(etaC-rMax, etaC+rMax, phiC-rMax, phiC+rMax);
+    const std::vector<Int_t> & selected = fClusterGrid.GetSelectedIndices();
+    
+    for(UInt_t iloop = 0; iloop < selected.size(); iloop++)
+    {
+      AliVCluster * calo = dynamic_cast<AliVCluster *>(plNe->At(selected[iloop])) ;
+      if ( !calo ) continue ;
+      
+      if ( calo->GetID() == pCandidate->GetCaloLabel(0) ||
+           calo->GetID() == pCandidate->GetCaloLabel(1)   ) continue ;
+      
+      if ( fIsTMClusterInConeRejected && pid && fPartInCone == kNeutralAndCharged &&
+           pid->IsTrackMatched(calo,reader->GetCaloUtils(),reader->GetInputEvent()) ) continue ;
+      
+      Int_t evtIndex = 0 ;
+      if ( reader->GetMixedEvent() )
+        evtIndex=reader->GetMixedEvent()->EventIndexForCaloCluster(calo->GetID()) ;
+      
+      calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
+      
+      pt  = fMomentum.Pt()  ;
+      eta = fMomentum.Eta() ;
+      phi = fMomentum.Phi() ;
+      if ( phi < 0 ) phi+=TMath::TwoPi();
+      
+      rad = Radius(etaC, phiC, eta, phi);
+      
+      if ( rad < fDistMinToTrigger ) continue ;
+      
+      if ( TMath::Abs(phi-phiC) > TMath::PiOver2() ) continue ;
+      
+      for(Int_t ir = 0; ir < nRadii; ir++)
+      {
+        if ( rad <= radii[ir] ) sumPtCluster[ir] += pt;
+      }
+    }
+  }
+  
+  // Tracks
+  //
+  TObjArray * plCTS = reader->GetCTSTracks();
+  
+  if ( sumPtTrack && plCTS && fPartInCone != kOnlyNeutral &&
+       UpdateConeGrid(fTrackGrid, plCTS, reader, kTRUE, fTrackGridList, fTrackGridEvent, fTrackGridEntries) )
+  {
+    fTrackGrid.ClearSelection();
+    fTrackGrid.SelectRegion(etaC-rMax, etaC+rMax, phiC-rMax, phiC+rMax);
+    const std::vector<Int_t> & selected = fTrackGrid.GetSelectedIndices();
+    
+    for(UInt_t iloop = 0; iloop < selected.size(); iloop++)
+    {
+      AliVTrack * track = dynamic_cast<AliVTrack*>(plCTS->At(selected[iloop])) ;
+      if ( !track ) continue ;
+      
+      if ( pCandidate->GetDetectorTag() == AliFiducialCut::kCTS )
+      {
+        Int_t  trackID   = reader->GetTrackID(track) ;
+        Bool_t contained = kFALSE;
+        
+        for(Int_t i = 0; i < 4; i++)
+        {
+          if( trackID == pCandidate->GetTrackLabel(i) ) contained = kTRUE;
+        }
+        
+        if ( contained ) continue ;
+      }
+      
+      fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
+      pt  = fTrackVector.Pt();
+      eta = fTrackVector.Eta();
+      phi = fTrackVector.Phi() ;
+      if ( phi < 0 ) phi+=TMath::TwoPi();
+      
+      rad = Radius(etaC, phiC, eta, phi);
+      
+      if ( rad < fDistMinToTrigger ) continue ;
+      
+      if ( TMath::Abs(phi-phiC) > TMath::PiOver2() ) continue ;
+      
+      for(Int_t ir = 0; ir < nRadii; ir++)
+      {
+        if ( rad <= radii[ir] ) sumPtTrack[ir] += pt;
+      }
+    }
+  }
+}
+
+//_________________________________________________________________________________________________________________________________
+/// Kinematics of a track or cluster of the reader arrays, as in the cone signal methods.
+///
+/// \param obj: AliVTrack, AliVCluster or AliCaloTrackParticle for mixed events.
+/// \param reader: pointer to AliCaloTrackReader. Needed to access event info.
+/// \param isTrack: the object is a track, otherwise a cluster.
+/// \param pt: transverse momentum, output.
+/// \param eta: pseudorapidity, output.
+/// \param phi: azimuthal angle in [0,2pi[, output.
+/// \return kFALSE if the object type is not recognized.
+//_________________________________________________________________________________________________________________________________
+Bool_t AliIsolationCut::GetConeGridKinematics(TObject * obj, AliCaloTrackReader * reader, Bool_t isTrack,
+                                              Float_t & pt, Float_t & eta, Float_t & phi)
+{
+  AliVTrack   * track = isTrack ? dynamic_cast<AliVTrack  *>(obj) : 0x0;
+  AliVCluster * calo  = isTrack ? 0x0 : dynamic_cast<AliVCluster*>(obj);
+  
+  if ( track )
+  {
+    fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
+    pt  = fTrackVector.Pt();
+    eta = fTrackVector.Eta();
+    phi = fTrackVector.Phi();
+  }
+  else if ( calo )
+  {
+    Int_t evtIndex = 0 ;
+    if ( reader->GetMixedEvent() )
+      evtIndex=reader->GetMixedEvent()->EventIndexForCaloCluster(calo->GetID()) ;
+    
+    calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
+    pt  = fMomentum.Pt()  ;
+    eta = fMomentum.Eta() ;
+    phi = fMomentum.Phi() ;
+  }
+  else
+  {// Mixed event stored in AliCaloTrackParticles
+    AliCaloTrackParticle * partmix = dynamic_cast<AliCaloTrackParticle*>(obj) ;
+    if ( !partmix ) return kFALSE;
+    pt  = partmix->Pt();
+    eta = partmix->Eta();
+    phi = partmix->Phi();
+  }
+  
+  if ( phi < 0 ) phi+=TMath::TwoPi();
+  
+  return kTRUE;
+}
+
+//_________________________________________________________________________________________________________________________________
+/// Fill the eta-phi grid with the particles of the reader array, only
+/// once per event and array. The event is identified by the array, the
+/// reader event number, the number of entries and the pT of the first and
+/// last particles, since the arrays are reused from one event to the next.
+///
+/// \param grid: grid to fill, fTrackGrid or fClusterGrid.
+/// \param list: reader array of tracks or clusters.
+/// \param reader: pointer to AliCaloTrackReader. Needed to access event info.
+/// \param isTrack: list contains tracks, otherwise clusters.
+/// \param gridList: array used in the last filling of the grid.
+/// \param gridEvent: event number in the last filling of the grid.
+/// \param gridEntries: array entries in the last filling of the grid.
+/// \return kTRUE if the grid corresponds to the array.
+//_________________________________________________________________________________________________________________________________
+Bool_t AliIsolationCut::UpdateConeGrid(AliIsolationConeGrid & grid, TObjArray * list, AliCaloTrackReader * reader,
+                                       Bool_t isTrack, TObjArray * & gridList, Int_t & gridEvent, Int_t & gridEntries)
+{
+  if ( !list ) return kFALSE;
+  
+  Float_t pt = 0, eta = 0, phi = 0;
+  
+  if ( list == gridList && reader->GetEventNumber() == gridEvent && list->GetEntries() == gridEntries )
+  {
+    Int_t nGrid = grid.GetNParticles();
+    if ( nGrid == 0 ) return kTRUE;
+    
+    Bool_t same = kTRUE;
+    if ( !GetConeGridKinematics(list->At(grid.GetIndex(0)), reader, isTrack, pt, eta, phi) ||
+         pt != grid.GetPt(0) ) same = kFALSE;
+    if ( same && ( !GetConeGridKinematics(list->At(grid.GetIndex(nGrid-1)), reader, isTrack, pt, eta, phi) ||
+                   pt != grid.GetPt(nGrid-1) ) ) same = kFALSE;
+    
+    if ( same ) return kTRUE;
+  }
+  
+  grid.Reset();
+  
+  for(Int_t ipr = 0; ipr < list->GetEntries(); ipr++)
+  {
+    if ( !GetConeGridKinematics(list->At(ipr), reader, isTrack, pt, eta, phi) ) continue;
+    
+    grid.Add(eta, phi, pt, ipr);
+  }
+  
+  grid.Build();
+  
+  gridList    = list;
+  gridEvent   = reader->GetEventNumber();
+  gridEntries = list->GetEntries();
+  
+  return kTRUE;
+}
+
 //_________________________________________________________________________________
 /// Set TPC and EMCal angle limits. Do it once.
 /// Get the hardcoded value set in the fiducial cut class.
@@ -2253,6 +2553,7 @@ void AliIsolationCut::Print(const Option_t * opt) const
   printf("using fraction for high pt leading instead of frac ? %i\n",fFracIsThresh);
   printf("minimum distance to candidate, R>%1.2f\n",fDistMinToTrigger);
   printf("correct cone excess = %d \n",fMakeConeExcessCorr);
+  printf("use eta-phi grid    = %d \n",fUseConeGrid);
   printf("    \n") ;
 }
 
@@ -29,6 +29,7 @@ class AliCaloTrackParticleCorrelation ;
 class AliCaloTrackReader ;
 class AliCaloPID;
 class AliHistogramRanges;
+#include "AliIsolationConeGrid.h"
 
 class AliIsolationCut : public TObject {
 
@@ -98,6 +99,11 @@ class AliIsolationCut : public TObject {
                                         Float_t & coneptsum   , Float_t & coneptLead,  
                                         Float_t & etaBandPtSum, Float_t & phiBandPtSum, 
                                         Float_t & perpBandPtSum,Double_t  histoWeight = 1) ;
+
+  void       CalculateSumPtInCones     (AliCaloTrackParticleCorrelation * aodParticle, AliCaloTrackReader * reader,
+                                        Int_t     calorimeter , AliCaloPID * pid,
+                                        Int_t     nRadii      , const Float_t * radii,
+                                        Float_t * sumPtCluster, Float_t * sumPtTrack) ;
   
   // Cone background studies medthods
 
@@ -164,8 +170,18 @@ class AliIsolationCut : public TObject {
   void       SwitchOnConeExcessCorrectionHistograms ()         { fMakeConeExcessCorr = kTRUE  ; }
   void       SwitchOffConeExcessCorrectionHistograms()         { fMakeConeExcessCorr = kFALSE ; }
   
+  void       SwitchOnConeGrid ()                               { fUseConeGrid = kTRUE  ; }
+  void       SwitchOffConeGrid()                               { fUseConeGrid = kFALSE ; }
+  Bool_t     IsConeGridOn()           const { return fUseConeGrid    ; }
+  
  private:
 
+  Bool_t     GetConeGridKinematics(TObject * obj, AliCaloTrackReader * reader, Bool_t isTrack,
+                                   Float_t & pt, Float_t & eta, Float_t & phi) ;
+  
+  Bool_t     UpdateConeGrid(AliIsolationConeGrid & grid, TObjArray * list, AliCaloTrackReader * reader,
+                            Bool_t isTrack, TObjArray * & gridList, Int_t & gridEvent, Int_t & gridEntries) ;
+
   Bool_t     fFillHistograms;    ///< Fill histograms if GetCreateOuputObjects() was called. 
   Bool_t     fFillEtaPhiHistograms; ///< Fill histograms if GetCreateOuputObjects() was called with eta/phi or band related histograms 
 
@@ -195,12 +211,23 @@ class AliIsolationCut : public TObject {
   
   Float_t    fNeutralOverChargedRatio; ///< Fix ratio of sum pT of neutrals over charged. For perpendicular cones UE subtraction.
   
+  Bool_t     fUseConeGrid;       ///< Bucket tracks and clusters in an eta-phi grid once per event and loop only on the cells around the cone and UE regions.
+  
   Int_t      fDebug;             ///< Debug level.
 
   TLorentzVector fMomentum;      //!<! Momentum of cluster, temporal object.
 
   TVector3   fTrackVector;       //!<! Track moment, temporal object.
   
+  AliIsolationConeGrid fTrackGrid;   //!<! Eta-phi grid of the reader tracks of the current event.
+  AliIsolationConeGrid fClusterGrid; //!<! Eta-phi grid of the reader clusters of the current event.
+  TObjArray * fTrackGridList;        //!<! Track array used to build fTrackGrid.
+  Int_t      fTrackGridEvent;        //!<! Event number used to build fTrackGrid.
+  Int_t      fTrackGridEntries;      //!<! Number of entries of the array used to build fTrackGrid.
+  TObjArray * fClusterGridList;      //!<! Cluster array used to build fClusterGrid.
+  Int_t      fClusterGridEvent;      //!<! Event number used to build fClusterGrid.
+  Int_t      fClusterGridEntries;    //!<! Number of entries of the array used to build fClusterGrid.
+  
   Float_t    fEMCEtaSize;        ///< Eta size of Calo
   Float_t    fEMCPhiMin;         ///< Minimim Phi limit of Calo
   Float_t    fEMCPhiMax;         ///< Maximum Phi limit of Calo
@@ -302,7 +329,7 @@ class AliIsolationCut : public TObject {
   AliIsolationCut & operator = (const AliIsolationCut & g) ; 
 
   /// \cond CLASSIMP
-  ClassDef(AliIsolationCut,12) ;
+  ClassDef(AliIsolationCut,13) ;
   /// \endcond
 
 } ;
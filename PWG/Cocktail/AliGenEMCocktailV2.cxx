@@ -74,7 +74,9 @@ AliGenEMCocktailV2::AliGenEMCocktailV2():AliGenCocktail(),
   fDynPtRange(kFALSE),
   fForceConv(kFALSE),
   fSelectedParticles(kGenHadrons),
-  fUseFixedEP(kFALSE)  
+  fUseFixedEP(kFALSE),
+  fUseTables(kFALSE),
+  fNTablePoints(10000)
 {
   // Constructor
 }
@@ -197,6 +199,11 @@ void AliGenEMCocktailV2::CreateCocktail()
       AliWarning(Form("Centrality for pT parameterization %s differs from centrality for flow parameterization: %s\n",fParametrizationDir.Data(),fV2ParametrizationDir.Data())) ;   
     }
     AliGenEMlibV2::SetFlowParametrizations(fParametrizationFile, fV2ParametrizationDir);
+  }
+
+  if (fUseTables) {
+    AliInfo(Form("pt and v2 parametrizations are tabulated with %d points",fNTablePoints));
+    AliGenEMlibV2::BuildTables(fNTablePoints);
   }    
   
   
@@ -72,6 +72,7 @@ public:
   static  void    SetMtScalingFactors();
   static  Bool_t  SetPtYDistributions();
   void    SetFixedEventPlane(Bool_t toFix=kTRUE){fUseFixedEP=toFix;} //Default is random
+  void    SetUseTabulatedParametrizations(Bool_t useTables=kTRUE, Int_t nPoints=10000) { fUseTables = useTables; fNTablePoints = nPoints; }
  
   // getters
   Bool_t    GetDynamicalPtRangeOption()       const                   { return fDynPtRange;               }
@@ -140,8 +141,10 @@ private:
   Bool_t        fForceConv;                             // select whether you want to force all gammas to convert imidediately
   UInt_t        fSelectedParticles;                     // which particles to simulate, allows to switch on and off 32 different particles
   Bool_t        fUseFixedEP;                            // use random Event Plane or fixed Psi=0
+  Bool_t        fUseTables;                             // use tabulated pt and v2 parametrizations
+  Int_t         fNTablePoints;                          // number of grid points of the tabulated parametrizations
   
-  ClassDef(AliGenEMCocktailV2,9)                        // cocktail for EM physics
+  ClassDef(AliGenEMCocktailV2,10)                        // cocktail for EM physics
 };
 
 #endif
@@ -0,0 +1,138 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+// Tabulated version of a one dimensional parametrization of the EM        //
+// cocktail (pt, y or v2), used by AliGenEMlibV2.                          //
+// The function is sampled once on an equidistant grid; values are then    //
+// obtained by (linear or logarithmic) interpolation.                      //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+#include "TF1.h"
+#include "TMath.h"
+#include "AliGenEMParamTable.h"
+
+ClassImp(AliGenEMParamTable)
+
+//________________________________________________________________________
+AliGenEMParamTable::AliGenEMParamTable():
+  fTF1(0),
+  fFunc(0),
+  fXmin(0.),
+  fXmax(0.),
+  fDx(0.),
+  fInvDx(0.),
+  fLogInterpolation(kFALSE),
+  fF(),
+  fLogF()
+{
+  // Default constructor
+}
+
+//________________________________________________________________________
+AliGenEMParamTable::AliGenEMParamTable(TF1* func, Int_t nPoints, Bool_t logInterpolation):
+  fTF1(0),
+  fFunc(0),
+  fXmin(0.),
+  fXmax(0.),
+  fDx(0.),
+  fInvDx(0.),
+  fLogInterpolation(kFALSE),
+  fF(),
+  fLogF()
+{
+  // Constructor, tabulates func over its range
+  Build(func, nPoints, logInterpolation);
+}
+
+//________________________________________________________________________
+AliGenEMParamTable::AliGenEMParamTable(TableFunc func, Double_t xMin, Double_t xMax, Int_t nPoints, Bool_t logInterpolation):
+  fTF1(0),
+  fFunc(0),
+  fXmin(0.),
+  fXmax(0.),
+  fDx(0.),
+  fInvDx(0.),
+  fLogInterpolation(kFALSE),
+  fF(),
+  fLogF()
+{
+  // Constructor, tabulates func over [xMin,xMax]
+  Build(func, xMin, xMax, nPoints, logInterpolation);
+}
+
+//________________________________________________________________________
+void AliGenEMParamTable::Build(TF1* func, Int_t nPoints, Bool_t logInterpolation)
+{
+  fTF1  = func;
+  fFunc = 0;
+  fXmin = 0.;
+  fXmax = 0.;
+  if (func) func->GetRange(fXmin, fXmax);
+  fF.assign(TMath::Max(nPoints,2), 0.);
+  Fill(logInterpolation);
+}
+
+//________________________________________________________________________
+void AliGenEMParamTable::Build(TableFunc func, Double_t xMin, Double_t xMax, Int_t nPoints, Bool_t logInterpolation)
+{
+  fTF1  = 0;
+  fFunc = func;
+  fXmin = xMin;
+  fXmax = xMax;
+  fF.assign(TMath::Max(nPoints,2), 0.);
+  Fill(logInterpolation);
+}
+
+//________________________________________________________________________
+void AliGenEMParamTable::Fill(Bool_t logInterpolation)
+{
+  // sample the function on the grid
+  Int_t n           = (Int_t)fF.size();
+  fLogInterpolation = logInterpolation;
+  fDx               = (fXmax-fXmin)/(n-1);
+  fInvDx            = (fDx>0.) ? 1./fDx : 0.;
+
+  fLogF.assign(n, 0.);
+  for (Int_t i=0; i<n; i++) {
+    fF[i] = EvalFunction(fXmin+i*fDx);
+    if (fF[i]>0.) fLogF[i] = TMath::Log(fF[i]);
+  }
+}
+
+//________________________________________________________________________
+Double_t AliGenEMParamTable::EvalFunction(Double_t x) const
+{
+  if (fTF1)  return fTF1->Eval(x);
+  if (fFunc) return fFunc(&x, &x);
+  return 0.;
+}
+
+//________________________________________________________________________
+Double_t AliGenEMParamTable::Eval(Double_t x) const
+{
+  if (fF.empty() || fInvDx==0. || x<fXmin || x>fXmax) return EvalFunction(x);
+
+  Int_t n    = (Int_t)fF.size();
+  Double_t t = (x-fXmin)*fInvDx;
+  Int_t i    = (Int_t)t;
+  if (i>n-2) i = n-2;
+  t -= i;
+  if (fLogInterpolation && fF[i]>0. && fF[i+1]>0.)
+    return TMath::Exp(fLogF[i]+t*(fLogF[i+1]-fLogF[i]));
+  return fF[i]+t*(fF[i+1]-fF[i]);
+}
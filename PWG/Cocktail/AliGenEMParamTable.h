@@ -0,0 +1,60 @@
+#ifndef ALIGENEMPARAMTABLE_H
+#define ALIGENEMPARAMTABLE_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+// Tabulated version of a one dimensional parametrization of the EM        //
+// cocktail (pt, y or v2), used by AliGenEMlibV2.                          //
+// The function is sampled once on an equidistant grid; values are then    //
+// obtained by (linear or logarithmic) interpolation.                      //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include "TObject.h"
+
+class TF1;
+
+class AliGenEMParamTable {
+
+public:
+
+  typedef Double_t (*TableFunc) (const Double_t*, const Double_t*);
+
+  AliGenEMParamTable();
+  AliGenEMParamTable(TF1* func, Int_t nPoints, Bool_t logInterpolation=kFALSE);
+  AliGenEMParamTable(TableFunc func, Double_t xMin, Double_t xMax, Int_t nPoints, Bool_t logInterpolation=kFALSE);
+  virtual ~AliGenEMParamTable() { };
+
+  void      Build(TF1* func, Int_t nPoints, Bool_t logInterpolation=kFALSE);
+  void      Build(TableFunc func, Double_t xMin, Double_t xMax, Int_t nPoints, Bool_t logInterpolation=kFALSE);
+
+  // interpolated value, the original function is evaluated outside of the table range
+  Double_t  Eval(Double_t x) const;
+  Double_t  GetXmin() const                                           { return fXmin;                   }
+  Double_t  GetXmax() const                                           { return fXmax;                   }
+  Int_t     GetNPoints() const                                        { return (Int_t)fF.size();        }
+
+private:
+  AliGenEMParamTable(const AliGenEMParamTable &table);
+  AliGenEMParamTable & operator=(const AliGenEMParamTable &table);
+
+  Double_t  EvalFunction(Double_t x) const;
+  void      Fill(Bool_t logInterpolation);
+
+  TF1*                  fTF1;                   //! tabulated TF1 (not owned), or
+  TableFunc             fFunc;                  //! tabulated function
+  Double_t              fXmin;                  // lower edge of the table
+  Double_t              fXmax;                  // upper edge of the table
+  Double_t              fDx;                    // grid spacing
+  Double_t              fInvDx;                 // 1/grid spacing
+  Bool_t                fLogInterpolation;      // interpolate log(f) where f>0 on both sides
+  std::vector<Double_t> fF;                     // function values on the grid
+  std::vector<Double_t> fLogF;                  // log of function values on the grid (0 if f<=0)
+
+  ClassDef(AliGenEMParamTable,2);
+};
+
+#endif
@@ -49,6 +49,13 @@ Int_t AliGenEMlibV2::fgSelectedCentrality       = AliGenEMlibV2::kpp;
 Int_t AliGenEMlibV2::fgSelectedV2Systematic     = AliGenEMlibV2::kNoV2Sys;
 TF1*  AliGenEMlibV2::fV2Parametrization[]={0x0} ;
 Int_t AliGenEMlibV2::fV2RefParameterization[] = {0} ;
+Int_t AliGenEMlibV2::fPtMtScaledBase[]        = {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1};
+Double_t AliGenEMlibV2::fPtMtScaledNorm[]       = {0.};
+Bool_t AliGenEMlibV2::fgTablesBuilt             = kFALSE;
+AliGenEMParamTable* AliGenEMlibV2::fPtTable[]      = {0x0};
+AliGenEMParamTable* AliGenEMlibV2::fV2Table[]      = {0x0};
+AliGenEMParamTable* AliGenEMlibV2::fV2PizeroTable  = NULL;
+std::vector<AliGenEMParamTable*> AliGenEMlibV2::fgTables;
 
 Double_t AliGenEMlibV2::CrossOverLc(double a, double b, double x){
   if(x<b-a/2) return 1.0;
@@ -271,7 +278,7 @@ Int_t AliGenEMlibV2::IpPizero(TRandom *)
 Double_t AliGenEMlibV2::PtPizero( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kPizero]->Eval(pt);
+  return EvalPt(kPizero,pt);
 }
 
 Double_t AliGenEMlibV2::YPizero( const Double_t *py, const Double_t */*dummy*/ )
@@ -283,8 +290,9 @@ Double_t AliGenEMlibV2::V2Pizero( const Double_t *px, const Double_t */*dummy*/
 {
   //If there are parameterizations read from file, use them  
   if(fV2Parametrization[kPizero]){
-    return fV2Parametrization[kPizero]->Eval(px[0]) ;
+    return EvalV2(kPizero,px[0]) ;
   }
+  if(fV2PizeroTable) return fV2PizeroTable->Eval(px[0]);
   
   //else use build-in parameterizations  
   double n1,n2,n3,n4,n5;
@@ -349,7 +357,7 @@ Int_t AliGenEMlibV2::IpEta(TRandom *)
 Double_t AliGenEMlibV2::PtEta( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kEta]->Eval(pt);
+  return EvalPt(kEta,pt);
 }
 
 Double_t AliGenEMlibV2::YEta( const Double_t *py, const Double_t */*dummy*/ )
@@ -361,7 +369,7 @@ Double_t AliGenEMlibV2::V2Eta( const Double_t *px, const Double_t */*dummy*/ )
 {
   //If there are parameterizations read from file, use them  
   if(fV2Parametrization[kEta])
-    return fV2Parametrization[kEta]->Eval(EtScalingV2(px[0], kEta,fV2RefParameterization[kEta]) ) ;
+    return EvalV2(kEta,EtScalingV2(px[0], kEta,fV2RefParameterization[kEta]) ) ;
   
   //else use build-in parameterizations  
   return KEtScal(*px,kEta); //V2Param(px,fgkV2param[1][fgSelectedV2Param]);
@@ -382,7 +390,7 @@ Int_t AliGenEMlibV2::IpRho0(TRandom *)
 Double_t AliGenEMlibV2::PtRho0( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kRho0]->Eval(pt);
+  return EvalPt(kRho0,pt);
 }
 
 Double_t AliGenEMlibV2::YRho0( const Double_t *py, const Double_t */*dummy*/ )
@@ -394,7 +402,7 @@ Double_t AliGenEMlibV2::V2Rho0( const Double_t *px, const Double_t */*dummy*/ )
 {
   //If there are parameterizations read from file, use them  
   if(fV2Parametrization[kRho0])
-    return fV2Parametrization[kRho0]->Eval(EtScalingV2(px[0], kRho0,fV2RefParameterization[kRho0]) ) ;
+    return EvalV2(kRho0,EtScalingV2(px[0], kRho0,fV2RefParameterization[kRho0]) ) ;
   
   //else use build-in parameterizations  
   return KEtScal(*px,kRho0);
@@ -415,7 +423,7 @@ Int_t AliGenEMlibV2::IpOmega(TRandom *)
 Double_t AliGenEMlibV2::PtOmega( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kOmega]->Eval(pt);
+  return EvalPt(kOmega,pt);
 }
 
 Double_t AliGenEMlibV2::YOmega( const Double_t *py, const Double_t */*dummy*/ )
@@ -427,7 +435,7 @@ Double_t AliGenEMlibV2::V2Omega( const Double_t *px, const Double_t */*dummy*/ )
 {
   //If there are parameterizations read from file, use them  
   if(fV2Parametrization[kOmega])
-    return fV2Parametrization[kOmega]->Eval(EtScalingV2(px[0], kOmega,fV2RefParameterization[kOmega])) ;
+    return EvalV2(kOmega,EtScalingV2(px[0], kOmega,fV2RefParameterization[kOmega])) ;
   //else use build-in parameterizations  
   return KEtScal(*px,kOmega);
 
@@ -448,7 +456,7 @@ Int_t AliGenEMlibV2::IpEtaprime(TRandom *)
 Double_t AliGenEMlibV2::PtEtaprime( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kEtaprime]->Eval(pt);
+  return EvalPt(kEtaprime,pt);
 }
 
 Double_t AliGenEMlibV2::YEtaprime( const Double_t *py, const Double_t */*dummy*/ )
@@ -461,7 +469,7 @@ Double_t AliGenEMlibV2::V2Etaprime( const Double_t *px, const Double_t */*dummy*
 {
   //If there are parameterizations read from file, use them  
   if(fV2Parametrization[kEtaprime])
-    return fV2Parametrization[kEtaprime]->Eval(EtScalingV2(px[0], kEtaprime,fV2RefParameterization[kEtaprime])) ;
+    return EvalV2(kEtaprime,EtScalingV2(px[0], kEtaprime,fV2RefParameterization[kEtaprime])) ;
   
   //else use build-in parameterizations  
   return KEtScal(*px,kEtaprime);
@@ -482,7 +490,7 @@ Int_t AliGenEMlibV2::IpPhi(TRandom *)
 Double_t AliGenEMlibV2::PtPhi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kPhi]->Eval(pt);
+  return EvalPt(kPhi,pt);
 }
 
 Double_t AliGenEMlibV2::YPhi( const Double_t *py, const Double_t */*dummy*/ )
@@ -494,7 +502,7 @@ Double_t AliGenEMlibV2::V2Phi( const Double_t *px, const Double_t */*dummy*/ )
 {
   //If there are parameterizations read from file, use them  
   if(fV2Parametrization[kPhi])
-    return fV2Parametrization[kPhi]->Eval(EtScalingV2(px[0], kPhi,fV2RefParameterization[kPhi])) ;
+    return EvalV2(kPhi,EtScalingV2(px[0], kPhi,fV2RefParameterization[kPhi])) ;
   
   //else use build-in parameterizations  
   return KEtScal(*px,kPhi);
@@ -515,7 +523,7 @@ Int_t AliGenEMlibV2::IpJpsi(TRandom *)
 Double_t AliGenEMlibV2::PtJpsi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kJpsi]->Eval(pt);
+  return EvalPt(kJpsi,pt);
 }
 
 Double_t AliGenEMlibV2::YJpsi( const Double_t *py, const Double_t */*dummy*/ )
@@ -527,7 +535,7 @@ Double_t AliGenEMlibV2::V2Jpsi( const Double_t *px, const Double_t */*dummy*/ )
 {
   //If there are parameterizations read from file, use them  
   if(fV2Parametrization[kJpsi])
-    return fV2Parametrization[kJpsi]->Eval(EtScalingV2(px[0], kJpsi,fV2RefParameterization[kJpsi])) ;
+    return EvalV2(kJpsi,EtScalingV2(px[0], kJpsi,fV2RefParameterization[kJpsi])) ;
   
   //else use build-in parameterizations  
   const static Double_t v2Param[16] = { 1.156000e-01, 8.936854e-01, 0.000000e+00, 4.000000e+00, 6.222375e+00, -1.600314e-01, 8.766676e-01, 7.824143e+00, 1.156000e-01, 3.484503e-02, 4.413685e-01, 0, 1, 3.484503e-02, 4.413685e-01, 7.2 };
@@ -558,7 +566,7 @@ Int_t AliGenEMlibV2::IpSigma0(TRandom *)
 Double_t AliGenEMlibV2::PtSigma0( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kSigma0]->Eval(pt);
+  return EvalPt(kSigma0,pt);
 }
 
 Double_t AliGenEMlibV2::YSigma0( const Double_t *py, const Double_t */*dummy*/ )
@@ -571,7 +579,7 @@ Double_t AliGenEMlibV2::V2Sigma0( const Double_t *px, const Double_t */*dummy*/
 {
   //If there are parameterizations read from file, use them  
   if(fV2Parametrization[kSigma0])
-    return fV2Parametrization[kSigma0]->Eval(EtScalingV2(px[0], kSigma0,fV2RefParameterization[kSigma0])) ;
+    return EvalV2(kSigma0,EtScalingV2(px[0], kSigma0,fV2RefParameterization[kSigma0])) ;
   
   //else use build-in parameterizations  
   return KEtScal(*px,kSigma0,3);
@@ -592,7 +600,7 @@ Int_t AliGenEMlibV2::IpK0short(TRandom *)
 Double_t AliGenEMlibV2::PtK0short( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kK0s]->Eval(pt);
+  return EvalPt(kK0s,pt);
 }
 
 Double_t AliGenEMlibV2::YK0short( const Double_t *py, const Double_t */*dummy*/ )
@@ -605,7 +613,7 @@ Double_t AliGenEMlibV2::V2K0short( const Double_t *px, const Double_t */*dummy*/
 {
   //If there are parameterizations read from file, use them  
   if(fV2Parametrization[kK0s])
-    return fV2Parametrization[kK0s]->Eval(EtScalingV2(px[0], kK0s,fV2RefParameterization[kK0s])) ;
+    return EvalV2(kK0s,EtScalingV2(px[0], kK0s,fV2RefParameterization[kK0s])) ;
   
   //else use build-in parameterizations  
   return KEtScal(*px,kK0s);
@@ -626,7 +634,7 @@ Int_t AliGenEMlibV2::IpK0long(TRandom *)
 Double_t AliGenEMlibV2::PtK0long( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kK0l]->Eval(pt);
+  return EvalPt(kK0l,pt);
 }
 
 Double_t AliGenEMlibV2::YK0long( const Double_t *py, const Double_t */*dummy*/ )
@@ -639,7 +647,7 @@ Double_t AliGenEMlibV2::V2K0long( const Double_t *px, const Double_t */*dummy*/
 {
   //If there are parameterizations read from file, use them  
   if(fV2Parametrization[kK0l])
-    return fV2Parametrization[kK0l]->Eval(EtScalingV2(px[0], kK0l,fV2RefParameterization[kK0l])) ;
+    return EvalV2(kK0l,EtScalingV2(px[0], kK0l,fV2RefParameterization[kK0l])) ;
   
   //else use build-in parameterizations  
   return KEtScal(*px,kK0l);
@@ -660,7 +668,7 @@ Int_t AliGenEMlibV2::IpLambda(TRandom *)
 Double_t AliGenEMlibV2::PtLambda( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kLambda]->Eval(pt);
+  return EvalPt(kLambda,pt);
 }
 
 Double_t AliGenEMlibV2::YLambda( const Double_t *py, const Double_t */*dummy*/ )
@@ -673,7 +681,7 @@ Double_t AliGenEMlibV2::V2Lambda( const Double_t *px, const Double_t */*dummy*/
 {
   //If there are parameterizations read from file, use them  
   if(fV2Parametrization[kLambda])
-    return fV2Parametrization[kLambda]->Eval(EtScalingV2(px[0], kLambda,fV2RefParameterization[kLambda])) ;
+    return EvalV2(kLambda,EtScalingV2(px[0], kLambda,fV2RefParameterization[kLambda])) ;
   
   //else use build-in parameterizations  
   return KEtScal(*px,kLambda);
@@ -694,7 +702,7 @@ Int_t AliGenEMlibV2::IpDeltaPlPl(TRandom *)
 Double_t AliGenEMlibV2::PtDeltaPlPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kDeltaPlPl]->Eval(pt);
+  return EvalPt(kDeltaPlPl,pt);
 }
 
 Double_t AliGenEMlibV2::YDeltaPlPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -707,7 +715,7 @@ Double_t AliGenEMlibV2::V2DeltaPlPl( const Double_t *px, const Double_t */*dummy
 {
   //If there are parameterizations read from file, use them  
   if(fV2Parametrization[kDeltaPlPl])
-    return fV2Parametrization[kDeltaPlPl]->Eval(EtScalingV2(px[0], kDeltaPlPl,fV2RefParameterization[kDeltaPlPl])) ;
+    return EvalV2(kDeltaPlPl,EtScalingV2(px[0], kDeltaPlPl,fV2RefParameterization[kDeltaPlPl])) ;
   
   //else use build-in parameterizations  
   return KEtScal(*px,kDeltaPlPl,3);
@@ -728,7 +736,7 @@ Int_t AliGenEMlibV2::IpDeltaPl(TRandom *)
 Double_t AliGenEMlibV2::PtDeltaPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kDeltaPl]->Eval(pt);
+  return EvalPt(kDeltaPl,pt);
 }
 
 Double_t AliGenEMlibV2::YDeltaPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -741,7 +749,7 @@ Double_t AliGenEMlibV2::V2DeltaPl( const Double_t *px, const Double_t */*dummy*/
 {
   //If there are parameterizations read from file, use them  
   if(fV2Parametrization[kDeltaPl])
-    return fV2Parametrization[kDeltaPl]->Eval(EtScalingV2(px[0], kDeltaPl,fV2RefParameterization[kDeltaPl])) ;
+    return EvalV2(kDeltaPl,EtScalingV2(px[0], kDeltaPl,fV2RefParameterization[kDeltaPl])) ;
   
   //else use build-in parameterizations  
   return KEtScal(*px,kDeltaPl,3);
@@ -762,7 +770,7 @@ Int_t AliGenEMlibV2::IpDeltaMi(TRandom *)
 Double_t AliGenEMlibV2::PtDeltaMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kDeltaMi]->Eval(pt);
+  return EvalPt(kDeltaMi,pt);
 }
 
 Double_t AliGenEMlibV2::YDeltaMi( const Double_t *py, const Double_t */*dummy*/ )
@@ -775,7 +783,7 @@ Double_t AliGenEMlibV2::V2DeltaMi( const Double_t *px, const Double_t */*dummy*/
 {
   //If there are parameterizations read from file, use them  
   if(fV2Parametrization[kDeltaMi])
-    return fV2Parametrization[kDeltaMi]->Eval(EtScalingV2(px[0], kDeltaMi,fV2RefParameterization[kDeltaMi])) ;
+    return EvalV2(kDeltaMi,EtScalingV2(px[0], kDeltaMi,fV2RefParameterization[kDeltaMi])) ;
   
   //else use build-in parameterizations  
   return KEtScal(*px,kDeltaMi,3);
@@ -796,7 +804,7 @@ Int_t AliGenEMlibV2::IpDeltaZero(TRandom *)
 Double_t AliGenEMlibV2::PtDeltaZero( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kDeltaZero]->Eval(pt);
+  return EvalPt(kDeltaZero,pt);
 }
 
 Double_t AliGenEMlibV2::YDeltaZero( const Double_t *py, const Double_t */*dummy*/ )
@@ -809,7 +817,7 @@ Double_t AliGenEMlibV2::V2DeltaZero( const Double_t *px, const Double_t */*dummy
 {
   //If there are parameterizations read from file, use them  
   if(fV2Parametrization[kDeltaZero])
-    return fV2Parametrization[kDeltaZero]->Eval(EtScalingV2(px[0], kDeltaZero,fV2RefParameterization[kDeltaZero])) ;
+    return EvalV2(kDeltaZero,EtScalingV2(px[0], kDeltaZero,fV2RefParameterization[kDeltaZero])) ;
   
   //else use build-in parameterizations  
   return KEtScal(*px,kDeltaZero,3);
@@ -830,7 +838,7 @@ Int_t AliGenEMlibV2::IpRhoPl(TRandom *)
 Double_t AliGenEMlibV2::PtRhoPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kRhoPl]->Eval(pt);
+  return EvalPt(kRhoPl,pt);
 }
 
 Double_t AliGenEMlibV2::YRhoPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -843,7 +851,7 @@ Double_t AliGenEMlibV2::V2RhoPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   //If there are parameterizations read from file, use them  
   if(fV2Parametrization[kRhoPl])
-    return fV2Parametrization[kRhoPl]->Eval(EtScalingV2(px[0], kRhoPl,fV2RefParameterization[kRhoPl])) ;
+    return EvalV2(kRhoPl,EtScalingV2(px[0], kRhoPl,fV2RefParameterization[kRhoPl])) ;
   
   //else use build-in parameterizations  
   return KEtScal(*px,kRhoPl);
@@ -864,7 +872,7 @@ Int_t AliGenEMlibV2::IpRhoMi(TRandom *)
 Double_t AliGenEMlibV2::PtRhoMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kRhoMi]->Eval(pt);
+  return EvalPt(kRhoMi,pt);
 }
 
 Double_t AliGenEMlibV2::YRhoMi( const Double_t *py, const Double_t */*dummy*/ )
@@ -877,7 +885,7 @@ Double_t AliGenEMlibV2::V2RhoMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   //If there are parameterizations read from file, use them  
   if(fV2Parametrization[kRhoMi])
-    return fV2Parametrization[kRhoMi]->Eval(EtScalingV2(px[0], kRhoMi,fV2RefParameterization[kRhoMi])) ;
+    return EvalV2(kRhoMi,EtScalingV2(px[0], kRhoMi,fV2RefParameterization[kRhoMi])) ;
   
   //else use build-in parameterizations  
   return KEtScal(*px,kRhoMi);
@@ -898,7 +906,7 @@ Int_t AliGenEMlibV2::IpK0star(TRandom *)
 Double_t AliGenEMlibV2::PtK0star( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kK0star]->Eval(pt);
+  return EvalPt(kK0star,pt);
 }
 
 Double_t AliGenEMlibV2::YK0star( const Double_t *py, const Double_t */*dummy*/ )
@@ -911,7 +919,7 @@ Double_t AliGenEMlibV2::V2K0star( const Double_t *px, const Double_t */*dummy*/
 {
   //If there are parameterizations read from file, use them  
   if(fV2Parametrization[kK0star])
-    return fV2Parametrization[kK0star]->Eval(EtScalingV2(px[0], kK0star,fV2RefParameterization[kK0star])) ;
+    return EvalV2(kK0star,EtScalingV2(px[0], kK0star,fV2RefParameterization[kK0star])) ;
   
   //else use build-in parameterizations  
   return KEtScal(*px,kK0star);
@@ -932,7 +940,7 @@ Int_t AliGenEMlibV2::IpKPl(TRandom *)
 Double_t AliGenEMlibV2::PtKPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kKPl]->Eval(pt);
+  return EvalPt(kKPl,pt);
 }
 
 Double_t AliGenEMlibV2::YKPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -944,7 +952,7 @@ Double_t AliGenEMlibV2::V2KPl( const Double_t *px, const Double_t */*dummy*/ )
 {
    //If there are parameterizations read from file, use them  
   if(fV2Parametrization[kKPl])
-     return fV2Parametrization[kKPl]->Eval(px[0]) ;
+     return EvalV2(kKPl,px[0]) ;
   
   else //use build-in parameterizations  
      return KEtScal(*px,kKPl);
@@ -965,7 +973,7 @@ Int_t AliGenEMlibV2::IpKMi(TRandom *)
 Double_t AliGenEMlibV2::PtKMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kKMi]->Eval(pt);
+  return EvalPt(kKMi,pt);
 }
 
 Double_t AliGenEMlibV2::YKMi( const Double_t *py, const Double_t */*dummy*/ )
@@ -977,7 +985,7 @@ Double_t AliGenEMlibV2::V2KMi( const Double_t *px, const Double_t */*dummy*/ )
 {
     //If there are parameterizations read from file, use them  
     if(fV2Parametrization[kKPl])  //assume same flow for K+,K-
-       return fV2Parametrization[kKPl]->Eval(px[0]) ;
+       return EvalV2(kKPl,px[0]) ;
     else
        return KEtScal(*px,kKMi);
 }
@@ -997,7 +1005,7 @@ Int_t AliGenEMlibV2::IpOmegaPl(TRandom *)
 Double_t AliGenEMlibV2::PtOmegaPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kOmegaPl]->Eval(pt);
+  return EvalPt(kOmegaPl,pt);
 }
 
 Double_t AliGenEMlibV2::YOmegaPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -1025,7 +1033,7 @@ Int_t AliGenEMlibV2::IpOmegaMi(TRandom *)
 Double_t AliGenEMlibV2::PtOmegaMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kOmegaMi]->Eval(pt);
+  return EvalPt(kOmegaMi,pt);
 }
 
 Double_t AliGenEMlibV2::YOmegaMi( const Double_t *py, const Double_t */*dummy*/ )
@@ -1053,7 +1061,7 @@ Int_t AliGenEMlibV2::IpXiPl(TRandom *)
 Double_t AliGenEMlibV2::PtXiPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kXiPl]->Eval(pt);
+  return EvalPt(kXiPl,pt);
 }
 
 Double_t AliGenEMlibV2::YXiPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -1081,7 +1089,7 @@ Int_t AliGenEMlibV2::IpXiMi(TRandom *)
 Double_t AliGenEMlibV2::PtXiMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kXiMi]->Eval(pt);
+  return EvalPt(kXiMi,pt);
 }
 
 Double_t AliGenEMlibV2::YXiMi( const Double_t *py, const Double_t */*dummy*/ )
@@ -1109,7 +1117,7 @@ Int_t AliGenEMlibV2::IpSigmaPl(TRandom *)
 Double_t AliGenEMlibV2::PtSigmaPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kSigmaPl]->Eval(pt);
+  return EvalPt(kSigmaPl,pt);
 }
 
 Double_t AliGenEMlibV2::YSigmaPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -1137,7 +1145,7 @@ Int_t AliGenEMlibV2::IpSigmaMi(TRandom *)
 Double_t AliGenEMlibV2::PtSigmaMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kSigmaMi]->Eval(pt);
+  return EvalPt(kSigmaMi,pt);
 }
 
 Double_t AliGenEMlibV2::YSigmaMi( const Double_t *py, const Double_t */*dummy*/ )
@@ -1228,6 +1236,11 @@ TF1* AliGenEMlibV2::MtScal(Int_t np, TString name, Bool_t isMeson)
   }
   formulaBaseScaled = formulaBaseScaledTemp;
 
+  if (np>=0 && np<26) {
+    fPtMtScaledNorm[np] = norm;
+    fPtMtScaledBase[np] = (!isMeson && fPtParametrizationProton) ? 26 : 0;
+  }
+
   TF1* result = new TF1(name.Data(), Form("%.10f * (x/%s) * (%s)", norm, scaledPt.Data(), formulaBaseScaled.Data()), xmin, xmax);
   if (!isMeson && fPtParametrizationProton) {
     for (Int_t i=0; i<nPar; i++) {
@@ -1327,6 +1340,8 @@ Double_t AliGenEMlibV2::GetTAA(Int_t cent){
 //--------------------------------------------------------------------------
 Bool_t AliGenEMlibV2::SetPtParametrizations(TString fileName, TString dirName) {
 
+  ClearTables();
+
   // open parametrizations file
   TFile* fParametrizationFile = TFile::Open(fileName.Data());
   if (!fParametrizationFile) AliFatalClass(Form("File %s not found",fileName.Data()));
@@ -1371,6 +1386,7 @@ Bool_t AliGenEMlibV2::SetPtParametrizations(TString fileName, TString dirName) {
         fPtParametrization[i]->SetParameter(iparam,fPtParametrizationTemp->GetParameter(iparam));
       }
       fPtParametrization[i]->SetName(Form("%d_pt", ip));
+      fPtMtScaledBase[i] = -1;
 
     } else {
       if (i==7 || i==9 || i==10 || i==11 || i==12 || i==17 || (i>=20 && i<=25))
@@ -1393,6 +1409,7 @@ Bool_t AliGenEMlibV2::SetFlowParametrizations(TString fileName, TString dirName)
   //If dirname is not zero, read parameterizations from file
   //for particles with missing parametrizations the Mt scaling is applied
 
+  ClearTables();
   if(dirName.Length()==0){ //use built-in parameterizations, do nothing
     return kTRUE;
   }
@@ -1626,6 +1643,105 @@ TH2F* AliGenEMlibV2::GetPtYDistribution(Int_t np) {
 }
 
 
+//--------------------------------------------------------------------------
+//
+//                     tabulated parametrizations
+//
+//--------------------------------------------------------------------------
+void AliGenEMlibV2::BuildTables(Int_t nPoints) {
+  // Tabulate pt and v2 parametrizations, to be called after they are set.
+  // pt spectra are interpolated logarithmically, mt scaled spectra are
+  // evaluated from the table of the pi0 (proton) spectrum. v2 parametrizations
+  // copied from the kaon/pi0 one for Et scaling share the table of the latter.
+
+  ClearTables();
+
+  for (Int_t i=0; i<26; i++) {
+    if (!fPtParametrization[i] || fPtMtScaledBase[i]>=0) continue;
+    fPtTable[i] = new AliGenEMParamTable(fPtParametrization[i], nPoints, kTRUE);
+    fgTables.push_back(fPtTable[i]);
+  }
+  if (fPtParametrizationProton) {
+    fPtTable[26] = new AliGenEMParamTable(fPtParametrizationProton, nPoints, kTRUE);
+    fgTables.push_back(fPtTable[26]);
+  }
+
+  // reference parametrizations first, then the ones sharing them
+  for (Int_t pass=0; pass<2; pass++) {
+    for (Int_t i=0; i<27; i++) {
+      if (!fV2Parametrization[i]) continue;
+      Int_t ref = (i>0) ? fV2RefParameterization[i] : i;
+      if ((pass==0) != (ref==i)) continue;
+      if (ref!=i && fV2Table[ref]) {
+        fV2Table[i] = fV2Table[ref];
+      } else {
+        fV2Table[i] = new AliGenEMParamTable(fV2Parametrization[i], nPoints);
+        fgTables.push_back(fV2Table[i]);
+      }
+    }
+  }
+  if (!fV2Parametrization[kPizero]) {
+    // built-in pi0 v2, also the base of the Et scaled built-in v2 of the other particles
+    AliGenEMParamTable* table = new AliGenEMParamTable(V2Pizero, 0., 300., nPoints);
+    fgTables.push_back(table);
+    fV2PizeroTable = table;
+  }
+
+  fgTablesBuilt = kTRUE;
+}
+
+//--------------------------------------------------------------------------
+void AliGenEMlibV2::ClearTables() {
+  // delete the tabulated parametrizations, the original ones are used again
+  fgTablesBuilt = kFALSE;
+  for (Int_t i=0; i<27; i++) {
+    fPtTable[i] = NULL;
+    fV2Table[i] = NULL;
+  }
+  fV2PizeroTable = NULL;
+  for (size_t i=0; i<fgTables.size(); i++) delete fgTables[i];
+  fgTables.clear();
+}
+
+//--------------------------------------------------------------------------
+AliGenEMParamTable* AliGenEMlibV2::GetPtTable(Int_t np) {
+  if (np>=0 && np<27)
+    return fPtTable[np];
+  else
+    return NULL;
+}
+
+//--------------------------------------------------------------------------
+AliGenEMParamTable* AliGenEMlibV2::GetV2Table(Int_t np) {
+  if (np>=0 && np<27)
+    return fV2Table[np];
+  else
+    return NULL;
+}
+
+//--------------------------------------------------------------------------
+Double_t AliGenEMlibV2::EvalPt(Int_t np, Double_t pt) {
+  if (fgTablesBuilt) {
+    if (fPtTable[np]) return fPtTable[np]->Eval(pt);
+    Int_t base = fPtMtScaledBase[np];
+    if (base>=0 && fPtTable[base]) {
+      Double_t mBase = (base==26) ? 0.9382720 : fgkHM[0];
+      Double_t mt2   = pt*pt + fgkHM[np]*fgkHM[np] - mBase*mBase;
+      if (mt2<=0.) return 0.;
+      Double_t scaledPt = TMath::Sqrt(mt2);
+      return fPtMtScaledNorm[np] * (pt/scaledPt) * fPtTable[base]->Eval(scaledPt);
+    }
+  }
+  return fPtParametrization[np]->Eval(pt);
+}
+
+//--------------------------------------------------------------------------
+Double_t AliGenEMlibV2::EvalV2(Int_t np, Double_t pt) {
+  if (fV2Table[np]) return fV2Table[np]->Eval(pt);
+  return fV2Parametrization[np]->Eval(pt);
+}
+
+
 //==========================================================================
 //
 //                     Set Getters
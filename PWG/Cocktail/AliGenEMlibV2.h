@@ -14,7 +14,9 @@
 //                                                                         //
 /////////////////////////////////////////////////////////////////////////////
 
+#include <vector>
 #include "AliGenLib.h"
+#include "AliGenEMParamTable.h"
 #include "TRandom.h"
 #include "TObject.h"
 #include "TF1.h"
@@ -53,6 +55,7 @@ public:
     fgSelectedCollisionsSystem  = collisionSystem;
     fgSelectedCentrality        = centSelect;
     fgSelectedV2Systematic      = v2sys;
+    ClearTables(); // built-in parametrizations depend on the selection
   }
   
   GenFunc   GetPt(Int_t param, const char * tname=0) const;
@@ -69,6 +72,16 @@ public:
   static TH1D*  GetMtScalingFactors();
   static TH2F*  GetPtYDistribution(Int_t np);
 
+  // Tabulated parametrizations: pt and v2 parametrizations are sampled once on a grid and then interpolated,
+  // mt scaled pt spectra and Et scaled v2 share the table of the particle they are scaled from
+  static void   BuildTables(Int_t nPoints=10000);
+  static void   ClearTables();
+  static Bool_t AreTablesBuilt()                                      { return fgTablesBuilt;             }
+  static AliGenEMParamTable* GetPtTable(Int_t np);
+  static AliGenEMParamTable* GetV2Table(Int_t np);
+  static Double_t EvalPt(Int_t np, Double_t pt);
+  static Double_t EvalV2(Int_t np, Double_t pt);
+
   static Int_t fgSelectedCollisionsSystem;                                                      // selected pT parameter
   static Int_t fgSelectedCentrality;                                                            // selected Centrality
   static Int_t fgSelectedV2Systematic;                                                          // selected v2 systematics, usefully values: -1,0,1
@@ -273,8 +286,15 @@ private:
   static TH2F*    fPtYDistribution[26];       // pt-y distributions
   static TF1*     fV2Parametrization[27];     // pt paramtrizations
   static Int_t    fV2RefParameterization[27]; // ID of a hadron used for parameterization of V2 for Et scaling
+  static Int_t    fPtMtScaledBase[26];        // -1: own pt parametrization, 0: mt scaled from pi0, 26: mt scaled from proton
+  static Double_t fPtMtScaledNorm[26];        // normalization of mt scaled pt parametrizations
+  static Bool_t   fgTablesBuilt;              // tabulated parametrizations are used
+  static AliGenEMParamTable* fPtTable[27];             // tabulated pt parametrizations, 26: proton (not owned)
+  static AliGenEMParamTable* fV2Table[27];             // tabulated v2 parametrizations from file (not owned)
+  static AliGenEMParamTable* fV2PizeroTable;           // tabulated built-in pi0 v2 (not owned)
+  static std::vector<AliGenEMParamTable*> fgTables;    // owner of the tabulated parametrizations
 
-  ClassDef(AliGenEMlibV2,7);
+  ClassDef(AliGenEMlibV2,8);
 };
 
 #endif
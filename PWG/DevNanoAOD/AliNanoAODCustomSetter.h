@@ -23,6 +23,13 @@ public:
   virtual ~AliNanoAODCustomSetter() {;}
   virtual void SetNanoAODHeader(const AliAODEvent * event   , AliNanoAODHeader * head , TString varListHeader  ) =0;
   virtual void SetNanoAODTrack (const AliAODTrack * aodTrack, AliNanoAODTrack * spTrack) =0;
+  // Set custom variables for all tracks of an event at once. Overload this
+  // to hoist per-event work (index lookups, calibration access) out of the track loop
+  virtual void SetNanoAODTracks(Int_t nTracks, const AliAODTrack * const * aodTracks, AliNanoAODTrack * const * spTracks)
+  {
+    for (Int_t i = 0; i < nTracks; i++)
+      SetNanoAODTrack(aodTracks[i], spTracks[i]);
+  }
 
   ClassDef(AliNanoAODCustomSetter, 1)
 };
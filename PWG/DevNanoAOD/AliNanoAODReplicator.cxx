@@ -46,6 +46,7 @@ class AliAODRecoDecay;
 #include "AliPIDResponse.h"
 #include <iostream>
 #include <cassert>
+#include <unordered_set>
 #include "TObjArray.h"
 #include "AliAnalysisFilter.h"
 #include "AliNanoAODTrack.h"
@@ -109,7 +110,9 @@ AliAODBranchReplicator(),
   fInputArrayName(""),
   fOutputArrayName("tracks"),
   fKeepDaughters(),
-  fClonedVertices()
+  fClonedVertices(),
+  fSelectedAODTracks(),
+  fSelectedNanoTracks()
   {
   // Default ctor. we need it to avoid instantiating a wrong mapping when reading from file
   }
@@ -146,7 +149,9 @@ AliNanoAODReplicator::AliNanoAODReplicator(const char* name, const char* title)
   fInputArrayName(""),
   fOutputArrayName("tracks"),
   fKeepDaughters(),
-  fClonedVertices()
+  fClonedVertices(),
+  fSelectedAODTracks(),
+  fSelectedNanoTracks()
 {
   // default ctor
 }
@@ -515,8 +520,9 @@ AliAODVertex* AliNanoAODReplicator::CloneAndStoreVertex(AliAODVertex* toClone)
 {
   // Clone vertex if not yet cloned. Update list of to store daughter objects.
   
-  if (fClonedVertices.find(toClone) != fClonedVertices.end())
-    return fClonedVertices[toClone];
+  std::unordered_map<AliAODVertex*, AliAODVertex*>::const_iterator cloned = fClonedVertices.find(toClone);
+  if (cloned != fClonedVertices.end())
+    return cloned->second;
   
   AliAODVertex* copiedVertex = new((*fVertices)[fVertices->GetEntriesFast()]) AliAODVertex(*toClone);
   copiedVertex->SetUniqueID(0); // avoid reusing old unique ID which confuses TRef
@@ -687,7 +693,15 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
     }
   }
   
-  std::map<TObject*, AliNanoAODTrack*> trackAssociation;
+  // tracks needed for V0s, cascades and conversions, looked up once per track below
+  std::unordered_set<TObject*> keepDaughters;
+  for (std::map<AliAODVertex*, std::vector<TObject*> >::iterator it = fKeepDaughters.begin(); it != fKeepDaughters.end(); it++)
+    keepDaughters.insert(it->second.begin(), it->second.end());
+  std::unordered_set<Int_t> keepIDs(trackIDs.begin(), trackIDs.end());
+
+  std::unordered_map<TObject*, AliNanoAODTrack*> trackAssociation;
+  fSelectedAODTracks.clear();
+  fSelectedNanoTracks.clear();
   
   // Tracks
   Int_t ntracks(0);
@@ -703,13 +717,11 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
       selected = kTRUE;
     
     // store tracks needed for V0s
-    for (std::map<AliAODVertex*, std::vector<TObject*> >::iterator it = fKeepDaughters.begin(); it != fKeepDaughters.end(); it++) {
-      if (std::find(it->second.begin(), it->second.end(), aodtrack) != it->second.end())
-        selected = kTRUE;
-    }
+    if (!selected && keepDaughters.find(aodtrack) != keepDaughters.end())
+      selected = kTRUE;
     
     // store tracks needed for conversions
-    if (std::find(trackIDs.begin(), trackIDs.end(), aodtrack->GetID()) != trackIDs.end())
+    if (!selected && keepIDs.find(aodtrack->GetID()) != keepIDs.end())
       selected = kTRUE;
     
     if (!selected)
@@ -717,11 +729,16 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
 
     AliNanoAODTrack* nanoTrack = new((*fTracks)[ntracks++]) AliNanoAODTrack (aodtrack, fVarList);
 
-    for (std::list<AliNanoAODCustomSetter*>::iterator it = fCustomSetters.begin(); it != fCustomSetters.end(); ++it)
-      (*it)->SetNanoAODTrack(aodtrack, nanoTrack);
-    
+    fSelectedAODTracks.push_back(aodtrack);
+    fSelectedNanoTracks.push_back(nanoTrack);
     trackAssociation[aodtrack] = nanoTrack;
   }
+
+  // custom variables are set for all selected tracks of the event at once
+  if (ntracks > 0) {
+    for (std::list<AliNanoAODCustomSetter*>::iterator it = fCustomSetters.begin(); it != fCustomSetters.end(); ++it)
+      (*it)->SetNanoAODTracks(ntracks, &fSelectedAODTracks[0], &fSelectedNanoTracks[0]);
+  }
   
   // Replace references to stored tracks. 
   // NOTE this has to respect the order in which they were stored (e.g. for a V0 the first daugther needs to be the positive one).
@@ -730,10 +747,12 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
       //Printf("Vertex %p Track %p", it->first, *it2);
       auto track = dynamic_cast<AliAODTrack*> (*it2);
       auto vertex = dynamic_cast<AliAODVertex*> (*it2);
-      if (track != nullptr && trackAssociation.find(*it2) != trackAssociation.end())
-        it->first->AddDaughter(trackAssociation[*it2]);
-      else if (vertex != nullptr && fClonedVertices.find(vertex) != fClonedVertices.end())
-        it->first->AddDaughter(fClonedVertices[vertex]);
+      std::unordered_map<TObject*, AliNanoAODTrack*>::const_iterator nanoTrack = trackAssociation.find(*it2);
+      std::unordered_map<AliAODVertex*, AliAODVertex*>::const_iterator clonedVertex = fClonedVertices.find(vertex);
+      if (track != nullptr && nanoTrack != trackAssociation.end())
+        it->first->AddDaughter(nanoTrack->second);
+      else if (vertex != nullptr && clonedVertex != fClonedVertices.end())
+        it->first->AddDaughter(clonedVertex->second);
       else {
         Printf("Dumping useful information before abort.");
         it->first->Dump();
@@ -16,6 +16,9 @@
 
 #include <iostream>
 #include <list>
+#include <map>
+#include <unordered_map>
+#include <vector>
 
 //
 // Implementation of a branch replicator 
@@ -143,12 +146,14 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   TString fOutputArrayName; // name of the output array, where the NanoAODTracks are stored
   
   std::map<AliAODVertex*, std::vector<TObject*> > fKeepDaughters; //! Tracks needed as references to V0s and cascades
-  std::map<AliAODVertex*, AliAODVertex*> fClonedVertices; //! avoid that vertices are stored several times
+  std::unordered_map<AliAODVertex*, AliAODVertex*> fClonedVertices; //! avoid that vertices are stored several times
+  std::vector<const AliAODTrack*> fSelectedAODTracks; //! source tracks of the nano tracks of the current event, for the custom setters
+  std::vector<AliNanoAODTrack*> fSelectedNanoTracks; //! nano tracks of the current event, for the custom setters
 
   AliNanoAODReplicator(const AliNanoAODReplicator&);
   AliNanoAODReplicator& operator=(const AliNanoAODReplicator&);
 
-  ClassDef(AliNanoAODReplicator, 6) // Branch replicator for ESD to muon AOD.
+  ClassDef(AliNanoAODReplicator, 7) // Branch replicator for ESD to muon AOD.
 };
 
 #endif
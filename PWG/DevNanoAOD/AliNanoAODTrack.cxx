@@ -43,6 +43,7 @@ AliNanoAODTrack::AliNanoAODTrack() :
   fProdVertex(0),
   fNanoFlags(0),
   fDetectorPID(0),
+  fMapping(0),
   fAODEvent(NULL)
 {
   // default constructor
@@ -56,16 +57,18 @@ AliNanoAODTrack::AliNanoAODTrack(AliAODTrack * aodTrack, const char * vars) :
   fProdVertex(0),
   fNanoFlags(0),
   fDetectorPID(0),
+  fMapping(0),
   fAODEvent(NULL)
 {
   // constructor
 
   Double_t position[3];
   aodTrack->GetXYZ(position); // GetXYZ() returns kTRUE, if it's DCA information
-  AliNanoAODTrackMapping::GetInstance(vars);
+  const AliNanoAODTrackMapping* mapping = AliNanoAODTrackMapping::GetInstance(vars); // resolved once for all variables below
+  fMapping = mapping;
 
   // Create internal structure
-  AllocateInternalStorage(AliNanoAODTrackMapping::GetInstance()->GetSize(), AliNanoAODTrackMapping::GetInstance()->GetSizeInt());
+  AllocateInternalStorage(mapping->GetSize(), mapping->GetSizeInt());
   
   // Get DCA correctly (covers both kases with and without kIsDCA bit set)
   Float_t dcaXY = 0;
@@ -73,55 +76,55 @@ AliNanoAODTrack::AliNanoAODTrack(AliAODTrack * aodTrack, const char * vars) :
   aodTrack->GetImpactParameters(dcaXY, dcaZ);
   
   // fill content
-  if (AliNanoAODTrackMapping::GetInstance()->GetPt() != -1)               SetVar(AliNanoAODTrackMapping::GetInstance()->GetPt()               , aodTrack->Pt()                      );
-  if (AliNanoAODTrackMapping::GetInstance()->GetPhi() != -1)              SetVar(AliNanoAODTrackMapping::GetInstance()->GetPhi()              , aodTrack->Phi()                     );
-  if (AliNanoAODTrackMapping::GetInstance()->GetTheta() != -1)            SetVar(AliNanoAODTrackMapping::GetInstance()->GetTheta()            , aodTrack->Theta()                   );
-  if (AliNanoAODTrackMapping::GetInstance()->GetChi2PerNDF() != -1)       SetVar(AliNanoAODTrackMapping::GetInstance()->GetChi2PerNDF()       , aodTrack->Chi2perNDF()              );  
-  if (AliNanoAODTrackMapping::GetInstance()->GetPosX() != -1)             SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosX()             , position[0]                         );
-  if (AliNanoAODTrackMapping::GetInstance()->GetPosY() != -1)             SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosY()             , position[1]                         );
-  if (AliNanoAODTrackMapping::GetInstance()->GetPosZ() != -1)             SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosZ()             , position[2]                         );
-  if (AliNanoAODTrackMapping::GetInstance()->GetPosDCAx() != -1)          SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosDCAx()          , aodTrack->XAtDCA()                  );
-  if (AliNanoAODTrackMapping::GetInstance()->GetPosDCAy() != -1)          SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosDCAy()          , aodTrack->YAtDCA()                  );
-  if (AliNanoAODTrackMapping::GetInstance()->GetPosDCAz() != -1)          SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosDCAz()          , dcaZ                                );
-  if (AliNanoAODTrackMapping::GetInstance()->GetPDCAX() != -1)            SetVar(AliNanoAODTrackMapping::GetInstance()->GetPDCAX()            , aodTrack->PxAtDCA()                 );
-  if (AliNanoAODTrackMapping::GetInstance()->GetPDCAY() != -1)            SetVar(AliNanoAODTrackMapping::GetInstance()->GetPDCAY()            , aodTrack->PyAtDCA()                 );
-  if (AliNanoAODTrackMapping::GetInstance()->GetPDCAZ() != -1)            SetVar(AliNanoAODTrackMapping::GetInstance()->GetPDCAZ()            , aodTrack->PzAtDCA()                 );
-  if (AliNanoAODTrackMapping::GetInstance()->GetDCA() != -1)              SetVar(AliNanoAODTrackMapping::GetInstance()->GetDCA()              , dcaXY                               );
-  if (AliNanoAODTrackMapping::GetInstance()->GetRAtAbsorberEnd() != -1)   SetVar(AliNanoAODTrackMapping::GetInstance()->GetRAtAbsorberEnd()   , aodTrack->GetRAtAbsorberEnd()       );
-  if (AliNanoAODTrackMapping::GetInstance()->GetTPCncls() != -1)          SetVarInt(AliNanoAODTrackMapping::GetInstance()->GetTPCncls()       , aodTrack->GetTPCNcls()              );
-  if (AliNanoAODTrackMapping::GetInstance()->GetID() != -1)               SetVar(AliNanoAODTrackMapping::GetInstance()->GetID()               , aodTrack->GetID()                   );
-  if (AliNanoAODTrackMapping::GetInstance()->GetTPCnclsF() != -1)         SetVarInt(AliNanoAODTrackMapping::GetInstance()->GetTPCnclsF()      , aodTrack->GetTPCNclsF()             );
-  if (AliNanoAODTrackMapping::GetInstance()->GetTPCNCrossedRows() != -1)  SetVarInt(AliNanoAODTrackMapping::GetInstance()->GetTPCNCrossedRows(), aodTrack->GetTPCNCrossedRows()     );
-  if (AliNanoAODTrackMapping::GetInstance()->GetTrackPhiOnEMCal() != -1)  SetVar(AliNanoAODTrackMapping::GetInstance()->GetTrackPhiOnEMCal()  , aodTrack->GetTrackPhiOnEMCal()      );
-  if (AliNanoAODTrackMapping::GetInstance()->GetTrackEtaOnEMCal() != -1)  SetVar(AliNanoAODTrackMapping::GetInstance()->GetTrackEtaOnEMCal()  , aodTrack->GetTrackEtaOnEMCal()      );
-  if (AliNanoAODTrackMapping::GetInstance()->GetTrackPtOnEMCal() != -1)   SetVar(AliNanoAODTrackMapping::GetInstance()->GetTrackPtOnEMCal()   , aodTrack->GetTrackPtOnEMCal()       );
-  if (AliNanoAODTrackMapping::GetInstance()->GetITSsignal() != -1)        SetVar(AliNanoAODTrackMapping::GetInstance()->GetITSsignal()        , aodTrack->GetITSsignal()            );
-  if (AliNanoAODTrackMapping::GetInstance()->GetTPCsignal() != -1)        SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCsignal()        , aodTrack->GetTPCsignal()            );
-  if (AliNanoAODTrackMapping::GetInstance()->GetTPCsignalTuned() != -1)   SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCsignalTuned()   , aodTrack->GetTPCsignalTunedOnData() );
-  if (AliNanoAODTrackMapping::GetInstance()->GetTPCsignalN() != -1)       SetVarInt(AliNanoAODTrackMapping::GetInstance()->GetTPCsignalN()    , aodTrack->GetTPCsignalN()           );
-  if (AliNanoAODTrackMapping::GetInstance()->GetTPCmomentum() != -1)      SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCmomentum()      , aodTrack->GetTPCmomentum()          );
-  if (AliNanoAODTrackMapping::GetInstance()->GetTPCTgl() != -1)           SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCTgl()           , aodTrack->GetTPCTgl()               );
-  if (AliNanoAODTrackMapping::GetInstance()->GetTOFsignal() != -1)        SetVar(AliNanoAODTrackMapping::GetInstance()->GetTOFsignal()        , aodTrack->GetTOFsignal()            );
-  if (AliNanoAODTrackMapping::GetInstance()->GetintegratedLength() != -1) SetVar(AliNanoAODTrackMapping::GetInstance()->GetintegratedLength() , aodTrack->GetIntegratedLength()     );
-  if (AliNanoAODTrackMapping::GetInstance()->GetTOFsignalTuned() != -1)   SetVar(AliNanoAODTrackMapping::GetInstance()->GetTOFsignalTuned()   , aodTrack->GetTOFsignalTunedOnData() );
-  if (AliNanoAODTrackMapping::GetInstance()->GetHMPIDsignal() != -1)      SetVar(AliNanoAODTrackMapping::GetInstance()->GetHMPIDsignal()      , aodTrack->GetHMPIDsignal()          );
-  if (AliNanoAODTrackMapping::GetInstance()->GetHMPIDoccupancy() != -1)   SetVar(AliNanoAODTrackMapping::GetInstance()->GetHMPIDoccupancy()   , aodTrack->GetHMPIDoccupancy()       );
-  if (AliNanoAODTrackMapping::GetInstance()->GetTRDsignal() != -1)        SetVar(AliNanoAODTrackMapping::GetInstance()->GetTRDsignal()        , aodTrack->GetTRDsignal()            );
-  if (AliNanoAODTrackMapping::GetInstance()->GetTRDChi2() != -1)          SetVar(AliNanoAODTrackMapping::GetInstance()->GetTRDChi2()          , aodTrack->GetTRDchi2()              );
-  if (AliNanoAODTrackMapping::GetInstance()->GetTRDnSlices() != -1)       SetVar(AliNanoAODTrackMapping::GetInstance()->GetTRDnSlices()       , aodTrack->GetNumberOfTRDslices()    );  
-  if (AliNanoAODTrackMapping::GetInstance()->GetTRDntrackletsPID() != -1) SetVarInt(AliNanoAODTrackMapping::GetInstance()->GetTRDntrackletsPID(), aodTrack->GetTRDntrackletsPID()   );  
-  if (AliNanoAODTrackMapping::GetInstance()->GetTPCnclsS() != -1)         SetVarInt(AliNanoAODTrackMapping::GetInstance()->GetTPCnclsS()      , aodTrack->GetTPCnclsS()             );
-  if (AliNanoAODTrackMapping::GetInstance()->GetFilterMap() != -1)        SetVarInt(AliNanoAODTrackMapping::GetInstance()->GetFilterMap()     , aodTrack->GetFilterMap()            );
-  if (AliNanoAODTrackMapping::GetInstance()->GetTOFBunchCrossing() != -1) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTOFBunchCrossing() , aodTrack->GetTOFBunchCrossing()     );
-  if (AliNanoAODTrackMapping::GetInstance()->GetCovMat(0) != -1)  {
+  if (mapping->GetPt() != -1)               SetVar(mapping->GetPt()               , aodTrack->Pt()                      );
+  if (mapping->GetPhi() != -1)              SetVar(mapping->GetPhi()              , aodTrack->Phi()                     );
+  if (mapping->GetTheta() != -1)            SetVar(mapping->GetTheta()            , aodTrack->Theta()                   );
+  if (mapping->GetChi2PerNDF() != -1)       SetVar(mapping->GetChi2PerNDF()       , aodTrack->Chi2perNDF()              );  
+  if (mapping->GetPosX() != -1)             SetVar(mapping->GetPosX()             , position[0]                         );
+  if (mapping->GetPosY() != -1)             SetVar(mapping->GetPosY()             , position[1]                         );
+  if (mapping->GetPosZ() != -1)             SetVar(mapping->GetPosZ()             , position[2]                         );
+  if (mapping->GetPosDCAx() != -1)          SetVar(mapping->GetPosDCAx()          , aodTrack->XAtDCA()                  );
+  if (mapping->GetPosDCAy() != -1)          SetVar(mapping->GetPosDCAy()          , aodTrack->YAtDCA()                  );
+  if (mapping->GetPosDCAz() != -1)          SetVar(mapping->GetPosDCAz()          , dcaZ                                );
+  if (mapping->GetPDCAX() != -1)            SetVar(mapping->GetPDCAX()            , aodTrack->PxAtDCA()                 );
+  if (mapping->GetPDCAY() != -1)            SetVar(mapping->GetPDCAY()            , aodTrack->PyAtDCA()                 );
+  if (mapping->GetPDCAZ() != -1)            SetVar(mapping->GetPDCAZ()            , aodTrack->PzAtDCA()                 );
+  if (mapping->GetDCA() != -1)              SetVar(mapping->GetDCA()              , dcaXY                               );
+  if (mapping->GetRAtAbsorberEnd() != -1)   SetVar(mapping->GetRAtAbsorberEnd()   , aodTrack->GetRAtAbsorberEnd()       );
+  if (mapping->GetTPCncls() != -1)          SetVarInt(mapping->GetTPCncls()       , aodTrack->GetTPCNcls()              );
+  if (mapping->GetID() != -1)               SetVar(mapping->GetID()               , aodTrack->GetID()                   );
+  if (mapping->GetTPCnclsF() != -1)         SetVarInt(mapping->GetTPCnclsF()      , aodTrack->GetTPCNclsF()             );
+  if (mapping->GetTPCNCrossedRows() != -1)  SetVarInt(mapping->GetTPCNCrossedRows(), aodTrack->GetTPCNCrossedRows()     );
+  if (mapping->GetTrackPhiOnEMCal() != -1)  SetVar(mapping->GetTrackPhiOnEMCal()  , aodTrack->GetTrackPhiOnEMCal()      );
+  if (mapping->GetTrackEtaOnEMCal() != -1)  SetVar(mapping->GetTrackEtaOnEMCal()  , aodTrack->GetTrackEtaOnEMCal()      );
+  if (mapping->GetTrackPtOnEMCal() != -1)   SetVar(mapping->GetTrackPtOnEMCal()   , aodTrack->GetTrackPtOnEMCal()       );
+  if (mapping->GetITSsignal() != -1)        SetVar(mapping->GetITSsignal()        , aodTrack->GetITSsignal()            );
+  if (mapping->GetTPCsignal() != -1)        SetVar(mapping->GetTPCsignal()        , aodTrack->GetTPCsignal()            );
+  if (mapping->GetTPCsignalTuned() != -1)   SetVar(mapping->GetTPCsignalTuned()   , aodTrack->GetTPCsignalTunedOnData() );
+  if (mapping->GetTPCsignalN() != -1)       SetVarInt(mapping->GetTPCsignalN()    , aodTrack->GetTPCsignalN()           );
+  if (mapping->GetTPCmomentum() != -1)      SetVar(mapping->GetTPCmomentum()      , aodTrack->GetTPCmomentum()          );
+  if (mapping->GetTPCTgl() != -1)           SetVar(mapping->GetTPCTgl()           , aodTrack->GetTPCTgl()               );
+  if (mapping->GetTOFsignal() != -1)        SetVar(mapping->GetTOFsignal()        , aodTrack->GetTOFsignal()            );
+  if (mapping->GetintegratedLength() != -1) SetVar(mapping->GetintegratedLength() , aodTrack->GetIntegratedLength()     );
+  if (mapping->GetTOFsignalTuned() != -1)   SetVar(mapping->GetTOFsignalTuned()   , aodTrack->GetTOFsignalTunedOnData() );
+  if (mapping->GetHMPIDsignal() != -1)      SetVar(mapping->GetHMPIDsignal()      , aodTrack->GetHMPIDsignal()          );
+  if (mapping->GetHMPIDoccupancy() != -1)   SetVar(mapping->GetHMPIDoccupancy()   , aodTrack->GetHMPIDoccupancy()       );
+  if (mapping->GetTRDsignal() != -1)        SetVar(mapping->GetTRDsignal()        , aodTrack->GetTRDsignal()            );
+  if (mapping->GetTRDChi2() != -1)          SetVar(mapping->GetTRDChi2()          , aodTrack->GetTRDchi2()              );
+  if (mapping->GetTRDnSlices() != -1)       SetVar(mapping->GetTRDnSlices()       , aodTrack->GetNumberOfTRDslices()    );  
+  if (mapping->GetTRDntrackletsPID() != -1) SetVarInt(mapping->GetTRDntrackletsPID(), aodTrack->GetTRDntrackletsPID()   );  
+  if (mapping->GetTPCnclsS() != -1)         SetVarInt(mapping->GetTPCnclsS()      , aodTrack->GetTPCnclsS()             );
+  if (mapping->GetFilterMap() != -1)        SetVarInt(mapping->GetFilterMap()     , aodTrack->GetFilterMap()            );
+  if (mapping->GetTOFBunchCrossing() != -1) SetVar(mapping->GetTOFBunchCrossing() , aodTrack->GetTOFBunchCrossing()     );
+  if (mapping->GetCovMat(0) != -1)  {
       Double_t covMatrix[21];
       aodTrack->GetCovarianceXYZPxPyPz(covMatrix);
       for (Int_t i=0;i<21;i++)
-          SetVar(AliNanoAODTrackMapping::GetInstance()->GetCovMat(i)       , covMatrix[i]                        );
+          SetVar(mapping->GetCovMat(i)       , covMatrix[i]                        );
   }
-  if (AliNanoAODTrackMapping::GetInstance()->GetStatus() != -1)   {
-    SetVarInt(AliNanoAODTrackMapping::GetInstance()->GetStatus(), aodTrack->GetStatus() >> 32);
-    SetVarInt(AliNanoAODTrackMapping::GetInstance()->GetStatus()+1, aodTrack->GetStatus() & 0xffffffff);
+  if (mapping->GetStatus() != -1)   {
+    SetVarInt(mapping->GetStatus(), aodTrack->GetStatus() >> 32);
+    SetVarInt(mapping->GetStatus()+1, aodTrack->GetStatus() & 0xffffffff);
   }
 
   fLabel = aodTrack->GetLabel();
@@ -158,6 +161,8 @@ AliNanoAODTrack::AliNanoAODTrack(AliESDTrack * /*esdTrack*/, const char * /*vars
   fLabel(0),
   fProdVertex(0),
   fNanoFlags(0),
+  fDetectorPID(0),
+  fMapping(0),
   fAODEvent(NULL)
 {
   // ctor: Creates a special track by copying the requested variables from an ESD track
@@ -171,13 +176,15 @@ AliNanoAODTrack::AliNanoAODTrack(const char * vars) :
   fLabel(0),
   fProdVertex(0),
   fNanoFlags(0),
+  fDetectorPID(0),
+  fMapping(0),
   fAODEvent(NULL)
 {
    // ctor: Creates a special track simply allocating the required variables
   AliNanoAODTrackMapping::GetInstance(vars);
 
   // Create internal structure
-  AllocateInternalStorage(AliNanoAODTrackMapping::GetInstance()->GetSize(), AliNanoAODTrackMapping::GetInstance()->GetSizeInt());
+  AllocateInternalStorage(Mapping()->GetSize(), Mapping()->GetSizeInt());
 }
 
 //______________________________________________________________________________
@@ -194,16 +201,15 @@ AliNanoAODTrack::AliNanoAODTrack(const AliNanoAODTrack& trk) :
   fLabel(trk.fLabel),
   fProdVertex(trk.fProdVertex),
   fNanoFlags(trk.fNanoFlags),
+  fDetectorPID(0),
+  fMapping(trk.fMapping),
   fAODEvent(trk.fAODEvent)
 {
   // Copy constructor
   // std::cout << "Copy Ctor" << std::endl;
   
-  AllocateInternalStorage(AliNanoAODTrackMapping::GetInstance()->GetSize(), AliNanoAODTrackMapping::GetInstance()->GetSizeInt());
-  for (Int_t isize = 0; isize<AliNanoAODTrackMapping::GetInstance()->GetSize(); isize++)
-    SetVar(isize, trk.GetVar(isize));    
-  for (Int_t isize = 0; isize<AliNanoAODTrackMapping::GetInstance()->GetSizeInt(); isize++)
-    SetVarInt(isize, trk.GetVarInt(isize));    
+  // copy the variable block at once rather than variable by variable
+  AliNanoAODStorage::operator=(trk);
 }
 
 //______________________________________________________________________________
@@ -218,6 +224,7 @@ AliNanoAODTrack& AliNanoAODTrack::operator=(const AliNanoAODTrack& trk)
     fLabel      = trk.fLabel;
     fProdVertex = trk.fProdVertex;
     fNanoFlags   = trk.fNanoFlags;
+    fMapping    = trk.fMapping;
     fAODEvent   = trk.fAODEvent;
     
   }
@@ -339,18 +346,18 @@ template <typename T> void AliNanoAODTrack::SetP(const T *p, const Bool_t cartes
       Double_t pt2 = p[0]*p[0] + p[1]*p[1];
       Double_t pp  = TMath::Sqrt(pt2 + p[2]*p[2]);
         
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetPt() ,TMath::Sqrt(pt2)); // pt
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetPhi() , (pt2 != 0.) ? TMath::Pi()+TMath::ATan2(-p[1], -p[0]) : -999); // phi
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetTheta() , (pp != 0.) ? TMath::ACos(p[2] / pp) : -999.); // theta
+      SetVar(Mapping()->GetPt() ,TMath::Sqrt(pt2)); // pt
+      SetVar(Mapping()->GetPhi() , (pt2 != 0.) ? TMath::Pi()+TMath::ATan2(-p[1], -p[0]) : -999); // phi
+      SetVar(Mapping()->GetTheta() , (pp != 0.) ? TMath::ACos(p[2] / pp) : -999.); // theta
     } else {
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetPt()      , p[0]);  
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetPhi()     , p[1]);  
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetTheta()   , p[2]);  
+      SetVar(Mapping()->GetPt()      , p[0]);  
+      SetVar(Mapping()->GetPhi()     , p[1]);  
+      SetVar(Mapping()->GetTheta()   , p[2]);  
     }
   } else {
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetPt()      , p[0]);  
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetPhi()     , p[1]);  
-      SetVar(AliNanoAODTrackMapping::GetInstance()->GetTheta()   , p[2]);  
+      SetVar(Mapping()->GetPt()      , p[0]);  
+      SetVar(Mapping()->GetPhi()     , p[1]);  
+      SetVar(Mapping()->GetTheta()   , p[2]);  
   }
 }
 
@@ -388,21 +395,21 @@ void AliNanoAODTrack::SetDCA(Double_t d, Double_t z)
 {
   // set the dca 
 
-  SetVar(AliNanoAODTrackMapping::GetInstance()->GetDCA(), d);
-  SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosDCAz(), z);
+  SetVar(Mapping()->GetDCA(), d);
+  SetVar(Mapping()->GetPosDCAz(), z);
 }
 
 //______________________________________________________________________________
 void AliNanoAODTrack::Print(Option_t* /* option */) const
 {
   // prints information about AliNanoAODTrack
-  //  std::cout << "Size: " << AliNanoAODTrackMapping::GetInstance()->GetSize() << std::endl;
-  AliNanoAODTrackMapping::GetInstance()->Print();
+  //  std::cout << "Size: " << Mapping()->GetSize() << std::endl;
+  Mapping()->Print();
 
-  for (Int_t index = 0; index<AliNanoAODTrackMapping::GetInstance()->GetSize(); index++)
-    printf(" - [%2.2d] %-10s : %f\n", index, AliNanoAODTrackMapping::GetInstance()->GetVarName(index), GetVar(index));    
-  for (Int_t index = 0; index<AliNanoAODTrackMapping::GetInstance()->GetSizeInt(); index++)
-    printf(" - [%2.2d] %-10s : %f\n", index, AliNanoAODTrackMapping::GetInstance()->GetVarNameInt(index), GetVar(index));    
+  for (Int_t index = 0; index<Mapping()->GetSize(); index++)
+    printf(" - [%2.2d] %-10s : %f\n", index, Mapping()->GetVarName(index), GetVar(index));    
+  for (Int_t index = 0; index<Mapping()->GetSizeInt(); index++)
+    printf(" - [%2.2d] %-10s : %f\n", index, Mapping()->GetVarNameInt(index), GetVar(index));    
 
   printf("\n");
 }
@@ -421,7 +428,7 @@ Bool_t AliNanoAODTrack::PropagateToDCA(const AliVVertex *vtx,
   // return kFALSE is something went wrong
 
   // allowed only for tracks inside the beam pipe
-  Float_t xstart2 = GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosX())*GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosX())+GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosY())*GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosY());
+  Float_t xstart2 = GetVar(Mapping()->GetPosX())*GetVar(Mapping()->GetPosX())+GetVar(Mapping()->GetPosY())*GetVar(Mapping()->GetPosY());
 
   if(xstart2 > 3.*3.) { // outside beampipe radius
     AliError("This method can be used only for propagation inside the beam pipe");
@@ -472,12 +479,12 @@ Bool_t AliNanoAODTrack::GetXYZAt(Double_t x, Double_t b, Double_t *r) const
   //maybe some of this code can be moved to AliVTrack to avoid code duplication
   const double kSafe = 1e-5;
   Double_t alpha=0.0;
-  Double_t radPos2 = GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosX())*GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosX())+GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosY())*GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosY());
+  Double_t radPos2 = GetVar(Mapping()->GetPosX())*GetVar(Mapping()->GetPosX())+GetVar(Mapping()->GetPosY())*GetVar(Mapping()->GetPosY());
   Double_t radMax  = 45.; // approximately ITS outer radius
   if (radPos2 < radMax*radMax) { // inside the ITS     
     alpha = TMath::ATan2(Py(),Px());
   } else { // outside the ITS
-    Float_t phiPos = TMath::Pi()+TMath::ATan2(-GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosY()), -GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosX()));
+    Float_t phiPos = TMath::Pi()+TMath::ATan2(-GetVar(Mapping()->GetPosY()), -GetVar(Mapping()->GetPosX()));
      alpha = 
      TMath::DegToRad()*(20*((((Int_t)(phiPos*TMath::RadToDeg()))/20))+10);
   }
@@ -496,7 +503,7 @@ Bool_t AliNanoAODTrack::GetXYZAt(Double_t x, Double_t b, Double_t *r) const
   }
   
   // Get the vertex of origin and the momentum
-  TVector3 ver(GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosX()), GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosY()), GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosZ()));
+  TVector3 ver(GetVar(Mapping()->GetPosX()), GetVar(Mapping()->GetPosY()), GetVar(Mapping()->GetPosZ()));
   TVector3 mom(Px(),Py(),Pz());
   //
   // avoid momenta along axis
@@ -537,7 +544,7 @@ Bool_t AliNanoAODTrack::GetCovarianceXYZPxPyPz(Double_t cv[21]) const
     
     for (Int_t i=0; i<21; i++){
         
-        cv[i]=GetVar(AliNanoAODTrackMapping::GetInstance()->GetCovMat(i));
+        cv[i]=GetVar(Mapping()->GetCovMat(i));
         
     }
     
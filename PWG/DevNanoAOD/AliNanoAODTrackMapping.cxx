@@ -62,7 +62,9 @@ AliNanoAODTrackMapping::AliNanoAODTrackMapping() :
   fTOFchi2{-1},
   fTOFsignalDz{-1},
   fTOFsignalDx{-1},
-  fStatus{-1}
+  fStatus{-1},
+  fMapCstVar(),
+  fVarIndexTable()
 { 
   /// default ctor
 
@@ -120,7 +122,9 @@ AliNanoAODTrackMapping::AliNanoAODTrackMapping(const char * mappingString) :
   fTOFchi2{-1},
   fTOFsignalDz{-1},
   fTOFsignalDx{-1},
-  fStatus{-1}
+  fStatus{-1},
+  fMapCstVar(),
+  fVarIndexTable()
 {
   /// ctor
 
@@ -213,62 +217,46 @@ AliNanoAODTrackMapping::AliNanoAODTrackMapping(const char * mappingString) :
 }
 
 Int_t AliNanoAODTrackMapping::GetVarIndex(TString varName){
+  /// Index of the variable varName (-1 if not allocated).
+  /// All names are resolved once into a hash table, so that a lookup does not go through
+  /// the full list of string comparisons
 
-    if     (varName == "pt"               ) return fPt               ;
-    else if(varName == "phi"              ) return fPhi              ;
-    else if(varName == "theta"            ) return fTheta            ; 
-    else if(varName == "chi2perNDF"       ) return fChi2PerNDF       ;
-    else if(varName == "posx"             ) return fPosX             ;
-    else if(varName == "posy"             ) return fPosY             ;
-    else if(varName == "posz"             ) return fPosZ             ;
-    else if(varName == "pDCAx"            ) return fPDCAX            ;
-    else if(varName == "pDCAy"            ) return fPDCAY            ;
-    else if(varName == "pDCAz"            ) return fPDCAZ            ;
-    else if(varName == "posDCAx"          ) return fPosDCAx          ;
-    else if(varName == "posDCAy"          ) return fPosDCAy          ;
-    else if(varName == "posDCAz"          ) return fPosDCAz          ;
-    else if(varName == "DCA"              ) return fDCA              ;
-    else if(varName == "RAtAbsorberEnd"   ) return fRAtAbsorberEnd   ;
-    else if(varName == "TPCncls"          ) return fTPCncls          ;
-    else if(varName == "ID"               ) return fID               ;
-    else if(varName == "TPCnclsF"         ) return fTPCnclsF         ;
-    else if(varName == "TPCNCrossedRows"  ) return fTPCNCrossedRows  ;
-    else if(varName == "TrackPhiOnEMCal"  ) return fTrackPhiOnEMCal  ;
-    else if(varName == "TrackEtaOnEMCal"  ) return fTrackEtaOnEMCal  ;
-    else if(varName == "TrackPtOnEMCal"   ) return fTrackPtOnEMCal   ;
-    else if(varName == "ITSsignal"        ) return fITSsignal        ;
-    else if(varName == "TPCsignal"        ) return fTPCsignal        ;
-    else if(varName == "TPCsignalTuned"   ) return fTPCsignalTuned   ;
-    else if(varName == "TPCsignalN"       ) return fTPCsignalN       ;
-    else if(varName == "TPCmomentum"      ) return fTPCmomentum      ;
-    else if(varName == "TPCTgl"           ) return fTPCTgl           ;
-    else if(varName == "TOFsignal"        ) return fTOFsignal        ;
-    else if(varName == "integratedLength" ) return fintegratedLength ;
-    else if(varName == "TOFsignalTuned"   ) return fTOFsignalTuned   ;
-    else if(varName == "HMPIDsignal"      ) return fHMPIDsignal      ;
-    else if(varName == "HMPIDoccupancy"   ) return fHMPIDoccupancy   ;
-    else if(varName == "TRDsignal"        ) return fTRDsignal        ;
-    else if(varName == "TRDChi2"          ) return fTRDChi2          ;
-    else if(varName == "TRDnSlices"       ) return fTRDnSlices       ;
-    else if(varName == "TRDntrackletsPID" ) return fTRDntrackletsPID ;
-    else if(varName == "TRDnClusters"     ) return fTRDnClusters     ;
-    else if(varName == "TPCnclsS"         ) return fTPCnclsS         ;
-    else if(varName == "FilterMap"        ) return fFilterMap        ;
-    else if(varName == "TOFBunchCrossing" ) return fTOFBunchCrossing ;
-    else if(varName == "covmat0"          ) return fcovmat[0]        ;
-    else if(varName == "TOFchi2"          ) return fTOFchi2          ;
-    else if(varName == "TOFsignalDz"      ) return fTOFsignalDz      ;
-    else if(varName == "TOFsignalDx"      ) return fTOFsignalDx      ;
-    else if(varName == "Status"           ) return fStatus           ;
+  if (fVarIndexTable.empty())
+    BuildVarIndexTable();
 
-    std::map<TString,Int_t>::iterator it = fMapCstVar.find(varName); // FIXME: do I need to delete "it"?
-    if(it != fMapCstVar.end()) {
-      //element found;
-	return it->second;
-    }
+  std::unordered_map<std::string,Int_t>::const_iterator it = fVarIndexTable.find(varName.Data());
+  if (it != fVarIndexTable.end())
+    return it->second;
 
-    return -1;
-  
+  return -1;
+}
+
+void AliNanoAODTrackMapping::BuildVarIndexTable() {
+  /// Fill name -> index table for all standard and custom variables
+
+  static const char * names[] = { "pt", "phi", "theta", "chi2perNDF", "posx", "posy", "posz", "pDCAx", "pDCAy", "pDCAz",
+                                  "posDCAx", "posDCAy", "posDCAz", "DCA", "RAtAbsorberEnd", "TPCncls", "ID", "TPCnclsF",
+                                  "TPCNCrossedRows", "TrackPhiOnEMCal", "TrackEtaOnEMCal", "TrackPtOnEMCal", "ITSsignal",
+                                  "TPCsignal", "TPCsignalTuned", "TPCsignalN", "TPCmomentum", "TPCTgl", "TOFsignal",
+                                  "integratedLength", "TOFsignalTuned", "HMPIDsignal", "HMPIDoccupancy", "TRDsignal",
+                                  "TRDChi2", "TRDnSlices", "TRDntrackletsPID", "TRDnClusters", "TPCnclsS", "FilterMap",
+                                  "TOFBunchCrossing", "covmat0", "TOFchi2", "TOFsignalDz", "TOFsignalDx", "Status" };
+  const Int_t indexes[] = { fPt, fPhi, fTheta, fChi2PerNDF, fPosX, fPosY, fPosZ, fPDCAX, fPDCAY, fPDCAZ,
+                            fPosDCAx, fPosDCAy, fPosDCAz, fDCA, fRAtAbsorberEnd, fTPCncls, fID, fTPCnclsF,
+                            fTPCNCrossedRows, fTrackPhiOnEMCal, fTrackEtaOnEMCal, fTrackPtOnEMCal, fITSsignal,
+                            fTPCsignal, fTPCsignalTuned, fTPCsignalN, fTPCmomentum, fTPCTgl, fTOFsignal,
+                            fintegratedLength, fTOFsignalTuned, fHMPIDsignal, fHMPIDoccupancy, fTRDsignal,
+                            fTRDChi2, fTRDnSlices, fTRDntrackletsPID, fTRDnClusters, fTPCnclsS, fFilterMap,
+                            fTOFBunchCrossing, fcovmat[0], fTOFchi2, fTOFsignalDz, fTOFsignalDx, fStatus };
+  static_assert(sizeof(names)/sizeof(names[0]) == sizeof(indexes)/sizeof(indexes[0]), "names and indexes out of sync");
+
+  fVarIndexTable.clear();
+  for (std::map<TString,Int_t>::const_iterator it = fMapCstVar.begin(); it != fMapCstVar.end(); ++it)
+    fVarIndexTable[it->first.Data()] = it->second;
+
+  // standard names are filled last, so they win over a custom variable of the same name as in the old lookup
+  for (UInt_t i=0; i<sizeof(indexes)/sizeof(indexes[0]); i++)
+    fVarIndexTable[names[i]] = indexes[i];
 }
 
 const char * AliNanoAODTrackMapping::GetVarName(Int_t index) const {
@@ -9,6 +9,9 @@
 #include "TSystem.h"
 #include "TTree.h"
 #include "TDirectory.h"
+#include <map>
+#include <string>
+#include <unordered_map>
 
 class AliNanoAODTrackMapping : public TObject
 {
@@ -31,7 +34,7 @@ public:
 
   const char * GetVarName(Int_t index) const;
   const char * GetVarNameInt(Int_t index) const;
-  Int_t GetVarIndex(TString varName); // cannot be const (uses stl map)
+  Int_t GetVarIndex(TString varName); // cannot be const (builds the lookup table on first use)
 
   //TODO: implement custom variables
 
@@ -92,6 +95,7 @@ public:
 private:
 
   static void  LoadInstance() ;
+  void  BuildVarIndexTable();
   
   Int_t fSize; ///< Number of variables actually allocated
   Int_t fSizeInt; ///< Number of int variables actually allocated
@@ -146,7 +150,8 @@ private:
   static AliNanoAODTrackMapping * fInstance; ///< instance, needed for the singleton implementation
   static TString fMappingString; ///< the string which this class was initialized with
   std::map<TString,int> fMapCstVar;// Map of indexes of custom variables: CACHE THIS TO CONST INTs IN YOUR TASK TO AVOID CONTINUOUS STRING COMPARISONS
-  ClassDef(AliNanoAODTrackMapping, 3)
+  std::unordered_map<std::string,Int_t> fVarIndexTable; //! name -> index for all allocated variables, filled on first GetVarIndex call
+  ClassDef(AliNanoAODTrackMapping, 4)
   
 };
 
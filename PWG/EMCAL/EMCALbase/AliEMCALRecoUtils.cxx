@@ -59,6 +59,10 @@ AliEMCALRecoUtils::AliEMCALRecoUtils():
   fUseL1PhaseInTimeRecalibration(kFALSE), fEMCALL1PhaseInTimeRecalibration(),     fDoUseMergedBC(kFALSE),
   fUseRunCorrectionFactors(kFALSE),       
   fRemoveBadChannels(kFALSE),             fRecalDistToBadChannels(kFALSE),        fEMCALBadChannelMap(),
+  fCalibTableValid(kFALSE),               fCalibTableSM(),                        fCalibTableStatus(),
+  fCalibTableBad(),                       fCalibTableEnergy(),                    fCalibTableTime(),
+  fCalibTableL1Phase(),                   fCalibTableNeighbours(),
+  fCellEnergyByAbsId(),                   fCellTimeByAbsId(),
   fNCellsFromEMCALBorder(0),              fNoEMCALBorderAtEta0(kTRUE),
   fRejectExoticCluster(kFALSE),           fRejectExoticCells(kFALSE), 
   fExoticCellFraction(0),                 fExoticCellDiffTime(0),                 fExoticCellMinAmplitude(0),
@@ -117,6 +121,11 @@ AliEMCALRecoUtils::AliEMCALRecoUtils(const AliEMCALRecoUtils & reco)
   fUseRunCorrectionFactors(reco.fUseRunCorrectionFactors),   
   fRemoveBadChannels(reco.fRemoveBadChannels),               fRecalDistToBadChannels(reco.fRecalDistToBadChannels),
   fEMCALBadChannelMap(NULL),
+  fCalibTableValid(kFALSE),                                  fCalibTableSM(),
+  fCalibTableStatus(),                                       fCalibTableBad(),
+  fCalibTableEnergy(),                                       fCalibTableTime(),
+  fCalibTableL1Phase(),                                      fCalibTableNeighbours(),
+  fCellEnergyByAbsId(),                                      fCellTimeByAbsId(),
   fNCellsFromEMCALBorder(reco.fNCellsFromEMCALBorder),       fNoEMCALBorderAtEta0(reco.fNoEMCALBorderAtEta0),
   fRejectExoticCluster(reco.fRejectExoticCluster),           fRejectExoticCells(reco.fRejectExoticCells), 
   fExoticCellFraction(reco.fExoticCellFraction),             fExoticCellDiffTime(reco.fExoticCellDiffTime),               
@@ -318,6 +327,9 @@ AliEMCALRecoUtils & AliEMCALRecoUtils::operator = (const AliEMCALRecoUtils & rec
   for (Int_t j = 0; j < 4  ; j++) 
    fBadStatusSelection[j] = reco.fBadStatusSelection[j] ; 
   
+  // rebuilt from the calibration histograms at first use
+  fCalibTableValid = kFALSE;
+  
   if(fEMCALBadChannelMap) delete fEMCALBadChannelMap;
   if(reco.fEMCALBadChannelMap) {
     // Copy constructor - not taking ownership over calibration histograms
@@ -405,55 +417,79 @@ Bool_t AliEMCALRecoUtils::AcceptCalibrateCell(Int_t absID, Int_t bc,
                                               Float_t  & amp,    Double_t & time, 
                                               AliVCaloCells* cells) 
 {  
-  AliEMCALGeometry* geom = AliEMCALGeometry::GetInstance();
+  if (!fCalibTableValid) BuildCalibrationTable();
+  if (!fCalibTableValid) return kFALSE;
+
+  if (!AcceptCellFromTable(absID, amp, time)) return kFALSE;
   
-  if(!geom)
-  {
-    AliError("No instance of the geometry is available");
-    return kFALSE;
-  }
+  amp  = cells->GetCellAmplitude(absID);
+  time = cells->GetCellTime(absID);
+  Bool_t isLowGain = !(cells->GetCellHighGain(absID));//HG = false -> LG = true
+
+  CalibrateCellFromTable(absID, bc, isLowGain, amp, time);
 
-  if ( absID < 0 || absID >= 24*48*geom->GetNumberOfSuperModules() ) 
+  return kTRUE;
+}
+
+///
+/// Check with the calibration table that the cell exists and is not bad.
+/// The calibration table must be valid.
+///
+/// \param absID: absolute cell ID number
+/// \param amp: set to 0 if the cell does not exist
+/// \param time: set to 1 s if the cell does not exist
+///
+/// \return bool quality of cell, exists or not 
+///
+//_______________________________________________________________________________
+Bool_t AliEMCALRecoUtils::AcceptCellFromTable(Int_t absID, Float_t & amp, Double_t & time) const
+{
+  if ( absID < 0 || absID >= (Int_t) fCalibTableSM.size() ) 
     return kFALSE;
   
-  Int_t imod = -1, iphi =-1, ieta=-1,iTower = -1, iIphi = -1, iIeta = -1, status=0; 
-  
-  if (!geom->GetCellIndex(absID,imod,iTower,iIphi,iIeta)) 
+  if ( fCalibTableSM[absID] < 0 )
   {
     // cell absID does not exist
     amp=0; time = 1.e9;
     return kFALSE; 
   }
   
-  geom->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi, iIeta,iphi,ieta);  
-
   // Do not include bad channels found in analysis,
   if ( IsBadChannelsRemovalSwitchedOn() )
   {
-    Bool_t bad = GetEMCALChannelStatus(imod, ieta, iphi,status);
-    
-    if ( status > 0 )
-      AliDebug(1,Form("Channel absId %d, status %d, set as bad %d",absID, status, bad));
+    if ( fCalibTableStatus[absID] > 0 )
+      AliDebug(1,Form("Channel absId %d, status %d, set as bad %d",absID, fCalibTableStatus[absID], fCalibTableBad[absID]));
     
-    if ( bad ) return kFALSE;
+    if ( fCalibTableBad[absID] ) return kFALSE;
   }
   
+  return kTRUE;
+}
+
+///
+/// Calibrate energy and time of an accepted cell with the calibration table.
+///
+/// \param absID: absolute cell ID number
+/// \param bc: bunch crossing number
+/// \param isLowGain: cell in low gain
+/// \param amp: input cell energy amplitude, output calibrated amplitude
+/// \param time: input cell time, output calibrated time
+///
+//_______________________________________________________________________________
+void AliEMCALRecoUtils::CalibrateCellFromTable(Int_t absID, Int_t bc, Bool_t isLowGain,
+                                               Float_t & amp, Double_t & time) const
+{
   //Recalibrate energy
-  amp  = cells->GetCellAmplitude(absID);
   if (!fCellsRecalibrated && IsRecalibrationOn())
-    amp *= GetEMCALChannelRecalibrationFactor(imod,ieta,iphi);
+    amp *= fCalibTableEnergy[absID];
   
   // Recalibrate time
-  time = cells->GetCellTime(absID);
   time-=fConstantTimeShift*1e-9; // only in case of old Run1 simulation
-  Bool_t isLowGain = !(cells->GetCellHighGain(absID));//HG = false -> LG = true
 
   RecalibrateCellTime(absID,bc,time,isLowGain);
   
   //Recalibrate time with L1 phase 
-  RecalibrateCellTimeL1Phase(imod, bc, time);
-
-  return kTRUE;
+  RecalibrateCellTimeL1Phase(fCalibTableSM[absID], bc, time);
 }
 
 ///
@@ -555,30 +591,27 @@ Bool_t AliEMCALRecoUtils::CheckCellFiducialRegion(const AliEMCALGeometry* geom,
 /// \return bool, true if cluster contains a bad channel
 ///
 //_______________________________________________________________________________
-Bool_t AliEMCALRecoUtils::ClusterContainsBadChannel(const AliEMCALGeometry* geom, 
+Bool_t AliEMCALRecoUtils::ClusterContainsBadChannel(const AliEMCALGeometry* /*geom*/, 
                                                     const UShort_t* cellList, 
                                                     Int_t nCells)
 {  
   if (!fRemoveBadChannels)  return kFALSE;
   if (!fEMCALBadChannelMap) return kFALSE;
   
-  Int_t icol = -1;
-  Int_t irow = -1;
-  Int_t imod = -1;
+  if (!fCalibTableValid) BuildCalibrationTable();
+  if (!fCalibTableValid) return kFALSE;
+
+  Int_t nSMInMap = fEMCALBadChannelMap->GetEntries();
   for (Int_t iCell = 0; iCell<nCells; iCell++) 
   {
-    //Get the column and row
-    Int_t iTower = -1, iIphi = -1, iIeta = -1; 
-    geom->GetCellIndex(cellList[iCell],imod,iTower,iIphi,iIeta); 
+    Int_t absId = cellList[iCell];
+    if (absId >= (Int_t) fCalibTableSM.size()) continue;
   
-    if (fEMCALBadChannelMap->GetEntries() <= imod) continue;
-    
-    geom->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi, iIeta,irow,icol);      
+    if (nSMInMap <= fCalibTableSM[absId]) continue;
     
-    Int_t status = 0;
-    if (GetEMCALChannelStatus(imod, icol, irow, status)) 
+    if (fCalibTableBad[absId]) 
     {
-      AliDebug(2,Form("Cluster with bad channel: SM %d, col %d, row %d, status %d\n",imod, icol, irow, status));
+      AliDebug(2,Form("Cluster with bad channel: absId %d, SM %d, status %d\n",absId, fCalibTableSM[absId], fCalibTableStatus[absId]));
       return kTRUE;
     }
   }// cell cluster loop
@@ -601,65 +634,27 @@ Bool_t AliEMCALRecoUtils::ClusterContainsBadChannel(const AliEMCALGeometry* geom
 Float_t AliEMCALRecoUtils::GetECross(Int_t absID, Double_t tcell,
                                      AliVCaloCells* cells, Int_t bc)
 {  
-  AliEMCALGeometry * geom = AliEMCALGeometry::GetInstance();
-  
-  if(!geom)
-  {
-    AliError("No instance of the geometry is available");
-    return -1;
-  }
+  if (!fCalibTableValid) BuildCalibrationTable();
+  if (!fCalibTableValid) return -1;
+
+  if (absID < 0 || absID >= (Int_t) fCalibTableSM.size()) return 0;
 
-  Int_t imod = -1, iphi =-1, ieta=-1,iTower = -1, iIphi = -1, iIeta = -1; 
-  geom->GetCellIndex(absID,imod,iTower,iIphi,iIeta); 
-  geom->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi, iIeta,iphi,ieta);  
-  
   // Get close cells index, energy and time, not in corners
+  const Int_t* absIDCross = &fCalibTableNeighbours[4*absID];
   
-  Int_t absID1 = -1;
-  Int_t absID2 = -1;
-  
-  if ( iphi < AliEMCALGeoParams::fgkEMCALRows-1) absID1 = geom->GetAbsCellIdFromCellIndexes(imod, iphi+1, ieta);
-  if ( iphi > 0 )                                absID2 = geom->GetAbsCellIdFromCellIndexes(imod, iphi-1, ieta);
-  
-  // In case of cell in eta = 0 border, depending on SM shift the cross cell index
-  
-  Int_t absID3 = -1;
-  Int_t absID4 = -1;
-  
-  if ( ieta == AliEMCALGeoParams::fgkEMCALCols-1 && !(imod%2) ) 
+  Float_t eCross = 0;
+  for (Int_t i = 0; i < 4; i++)
   {
-    absID3 = geom-> GetAbsCellIdFromCellIndexes(imod+1, iphi, 0);
-    absID4 = geom-> GetAbsCellIdFromCellIndexes(imod,   iphi, ieta-1); 
-  } 
-  else if ( ieta == 0 && imod%2 ) 
-  {
-    absID3 = geom-> GetAbsCellIdFromCellIndexes(imod,   iphi, ieta+1);
-    absID4 = geom-> GetAbsCellIdFromCellIndexes(imod-1, iphi, AliEMCALGeoParams::fgkEMCALCols-1); 
-  } 
-  else 
-  {
-    if ( ieta < AliEMCALGeoParams::fgkEMCALCols-1 ) 
-      absID3 = geom-> GetAbsCellIdFromCellIndexes(imod, iphi, ieta+1);
-    if ( ieta > 0 )                                 
-      absID4 = geom-> GetAbsCellIdFromCellIndexes(imod, iphi, ieta-1); 
+    Float_t  ecellCross = 0;
+    Double_t tcellCross = 0;
+    AcceptCalibrateCell(absIDCross[i], bc, ecellCross, tcellCross, cells); 
+    
+    if (TMath::Abs(tcell-tcellCross)*1.e9 > fExoticCellDiffTime) ecellCross = 0 ;
+    
+    eCross += ecellCross;
   }
   
-  //printf("IMOD %d, AbsId %d, a %d, b %d, c %d e %d \n",imod,absID,absID1,absID2,absID3,absID4);
-  
-  Float_t  ecell1  = 0, ecell2  = 0, ecell3  = 0, ecell4  = 0;
-  Double_t tcell1  = 0, tcell2  = 0, tcell3  = 0, tcell4  = 0;
-
-  AcceptCalibrateCell(absID1,bc, ecell1,tcell1,cells); 
-  AcceptCalibrateCell(absID2,bc, ecell2,tcell2,cells); 
-  AcceptCalibrateCell(absID3,bc, ecell3,tcell3,cells); 
-  AcceptCalibrateCell(absID4,bc, ecell4,tcell4,cells); 
-  
-  if (TMath::Abs(tcell-tcell1)*1.e9 > fExoticCellDiffTime) ecell1 = 0 ;
-  if (TMath::Abs(tcell-tcell2)*1.e9 > fExoticCellDiffTime) ecell2 = 0 ;
-  if (TMath::Abs(tcell-tcell3)*1.e9 > fExoticCellDiffTime) ecell3 = 0 ;
-  if (TMath::Abs(tcell-tcell4)*1.e9 > fExoticCellDiffTime) ecell4 = 0 ;
-  
-  return ecell1+ecell2+ecell3+ecell4;
+  return eCross;
 }
 
 ///
@@ -697,6 +692,87 @@ Bool_t AliEMCALRecoUtils::IsExoticCell(Int_t absID, AliVCaloCells* cells, Int_t
   return kFALSE;
 }
 
+///
+/// Flag the exotic cells of the full list of cells at once, same result as
+/// IsExoticCell() for each cell. The cells are calibrated once and stored by
+/// absId, so that the cross energy is obtained without searching the cells.
+///
+/// \param cells: full list of cells
+/// \param bc: bunch crossing number
+/// \param isExotic: filled with the flag of each cell, by position in cells
+///
+/// \return number of exotic cells
+///
+//_____________________________________________________________________________________________
+Int_t AliEMCALRecoUtils::FlagExoticCells(AliVCaloCells* cells, Int_t bc, std::vector<Bool_t> & isExotic)
+{
+  Int_t nCells = cells ? cells->GetNumberOfCells() : 0;
+  isExotic.assign(nCells, kFALSE);
+  
+  if (!fRejectExoticCells || !nCells) return 0;
+  
+  if (!fCalibTableValid) BuildCalibrationTable();
+  if (!fCalibTableValid) return 0;
+  
+  // Calibrated energy and time by absId, 0 for cells not in the list or rejected
+  fCellEnergyByAbsId.assign(fCalibTableSM.size(), 0.);
+  fCellTimeByAbsId  .assign(fCalibTableSM.size(), 0.);
+  
+  for (Int_t iCell = 0; iCell < nCells; iCell++)
+  {
+    Int_t    absId = cells->GetCellNumber(iCell);
+    Float_t  ecell = 0;
+    Double_t tcell = 0;
+    if (!AcceptCellFromTable(absId, ecell, tcell)) 
+    {
+      isExotic[iCell] = kTRUE; // reject this cell
+      continue;
+    }
+    
+    ecell = cells->GetAmplitude(iCell);
+    tcell = cells->GetTime(iCell);
+    CalibrateCellFromTable(absId, bc, !(cells->GetHighGain(iCell)), ecell, tcell);
+    
+    fCellEnergyByAbsId[absId] = ecell;
+    fCellTimeByAbsId  [absId] = tcell;
+  }
+  
+  Int_t nExotic = 0;
+  for (Int_t iCell = 0; iCell < nCells; iCell++)
+  {
+    if (isExotic[iCell]) 
+    {
+      nExotic++;
+      continue;
+    }
+    
+    Int_t    absId = cells->GetCellNumber(iCell);
+    Float_t  ecell = fCellEnergyByAbsId[absId];
+    Double_t tcell = fCellTimeByAbsId  [absId];
+    
+    if (ecell < fExoticCellMinAmplitude) continue; // do not reject low energy cells
+    
+    const Int_t* absIdCross = &fCalibTableNeighbours[4*absId];
+    Float_t eCross = 0;
+    for (Int_t i = 0; i < 4; i++)
+    {
+      if (absIdCross[i] < 0) continue;
+      if (TMath::Abs(tcell-fCellTimeByAbsId[absIdCross[i]])*1.e9 > fExoticCellDiffTime) continue;
+      eCross += fCellEnergyByAbsId[absIdCross[i]];
+    }
+    
+    if (1-eCross/ecell > fExoticCellFraction) 
+    {
+      AliDebug(2,Form("AliEMCALRecoUtils::FlagExoticCells() - EXOTIC CELL id %d, eCell %f, eCross %f, 1-eCross/eCell %f\n",
+                      absId,ecell,eCross,1-eCross/ecell));
+      isExotic[iCell] = kTRUE;
+      nExotic++;
+    }
+  }
+  
+  return nExotic;
+}
+
 ///
 /// Check if the cluster highest energy tower is exotic.
 ///
@@ -1348,6 +1424,8 @@ void AliEMCALRecoUtils::SetEMCALBadChannelStatusSelection(Bool_t all, Bool_t dea
   fBadStatusSelection[1] = dead; 
   fBadStatusSelection[2] = hot; 
   fBadStatusSelection[3] = warm; 
+  
+  fCalibTableValid = kFALSE;
 }
 
 ///
@@ -1401,6 +1479,131 @@ Bool_t AliEMCALRecoUtils::GetEMCALChannelStatus(Int_t iSM , Int_t iCol, Int_t iR
   return kFALSE; // if everything fails, accept it.
 }
 
+///
+/// \return declare channel as bad (true) or not good (false), from the calibration table,
+/// same as GetEMCALChannelStatus(iSM, iCol, iRow, status)
+///
+/// \param absId: cell absolute ID number
+/// \param status: channel status
+///
+//____________________________________________________________________
+Bool_t AliEMCALRecoUtils::GetEMCALChannelStatus(Int_t absId, Int_t & status)
+{
+  if (!fCalibTableValid) BuildCalibrationTable();
+  
+  if (absId < 0 || absId >= (Int_t) fCalibTableSM.size() || fCalibTableSM[absId] < 0)
+  {
+    status = 0;
+    return kFALSE;
+  }
+  
+  status = fCalibTableStatus[absId];
+  return fCalibTableBad[absId];
+}
+
+///
+/// Fill the calibration table from the calibration histograms: super module, 
+/// bad channel status, energy factor, time shifts and cross neighbours of each
+/// cell, indexed by absId, and L1 phase of each super module.
+/// Done at first use after the histograms changed, so that the cell
+/// calibration does not need geometry conversions nor histogram lookups.
+///
+//____________________________________________________________________
+void AliEMCALRecoUtils::BuildCalibrationTable()
+{
+  AliEMCALGeometry* geom = AliEMCALGeometry::GetInstance();
+  
+  if(!geom)
+  {
+    AliError("No instance of the geometry is available");
+    return;
+  }
+  
+  const Int_t nSM    = geom->GetNumberOfSuperModules();
+  const Int_t nCells = 24*48*nSM;
+  
+  fCalibTableSM       .assign(  nCells, -1);
+  fCalibTableStatus   .assign(  nCells,  0);
+  fCalibTableBad      .assign(  nCells, kFALSE);
+  fCalibTableEnergy   .assign(  nCells,  1.);
+  fCalibTableTime     .assign(8*nCells,  0.);
+  fCalibTableNeighbours.assign(4*nCells, -1);
+  fCalibTableL1Phase  .assign(  nSM,     0);
+  
+  const Int_t nLG = fLowGain ? 2 : 1;
+  
+  for (Int_t absId = 0; absId < nCells; absId++)
+  {
+    Int_t imod = -1, iphi =-1, ieta=-1,iTower = -1, iIphi = -1, iIeta = -1; 
+    if (!geom->GetCellIndex(absId,imod,iTower,iIphi,iIeta)) continue;
+    geom->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi, iIeta,iphi,ieta);  
+    
+    fCalibTableSM[absId] = imod;
+    
+    // Bad channel status
+    if (!fEMCALBadChannelMap || fEMCALBadChannelMap->At(imod))
+    {
+      Int_t status = 0;
+      fCalibTableBad[absId]    = GetEMCALChannelStatus(imod, ieta, iphi, status);
+      fCalibTableStatus[absId] = status;
+    }
+    
+    // Energy
+    if (fEMCALRecalibrationFactors && fEMCALRecalibrationFactors->At(imod))
+      fCalibTableEnergy[absId] = GetEMCALChannelRecalibrationFactor(imod, ieta, iphi);
+    
+    // Time, per BC and gain
+    if (fEMCALTimeRecalibrationFactors)
+    {
+      for (Int_t iLG = 0; iLG < nLG; iLG++)
+      {
+        for (Int_t iBC = 0; iBC < 4; iBC++)
+        {
+          Int_t ihist = fDoUseMergedBC ? iLG : iBC+4*iLG;
+          if (fEMCALTimeRecalibrationFactors->At(ihist))
+            fCalibTableTime[8*absId+4*iLG+iBC] = GetEMCALChannelTimeRecalibrationFactor(iBC, absId, iLG);
+        }
+      }
+    }
+    
+    // Cells in cross, not in corners
+    Int_t* absIdCross = &fCalibTableNeighbours[4*absId];
+    
+    if ( iphi < AliEMCALGeoParams::fgkEMCALRows-1) absIdCross[0] = geom->GetAbsCellIdFromCellIndexes(imod, iphi+1, ieta);
+    if ( iphi > 0 )                                absIdCross[1] = geom->GetAbsCellIdFromCellIndexes(imod, iphi-1, ieta);
+    
+    // In case of cell in eta = 0 border, depending on SM shift the cross cell index
+    if ( ieta == AliEMCALGeoParams::fgkEMCALCols-1 && !(imod%2) ) 
+    {
+      absIdCross[2] = geom-> GetAbsCellIdFromCellIndexes(imod+1, iphi, 0);
+      absIdCross[3] = geom-> GetAbsCellIdFromCellIndexes(imod,   iphi, ieta-1); 
+    } 
+    else if ( ieta == 0 && imod%2 ) 
+    {
+      absIdCross[2] = geom-> GetAbsCellIdFromCellIndexes(imod,   iphi, ieta+1);
+      absIdCross[3] = geom-> GetAbsCellIdFromCellIndexes(imod-1, iphi, AliEMCALGeoParams::fgkEMCALCols-1); 
+    } 
+    else 
+    {
+      if ( ieta < AliEMCALGeoParams::fgkEMCALCols-1 ) 
+        absIdCross[2] = geom-> GetAbsCellIdFromCellIndexes(imod, iphi, ieta+1);
+      if ( ieta > 0 )                                 
+        absIdCross[3] = geom-> GetAbsCellIdFromCellIndexes(imod, iphi, ieta-1); 
+    }
+  }
+  
+  // L1 phase
+  if (fEMCALL1PhaseInTimeRecalibration && fEMCALL1PhaseInTimeRecalibration->At(0))
+  {
+    for (Int_t iSM = 0; iSM < nSM; iSM++)
+      fCalibTableL1Phase[iSM] = GetEMCALL1PhaseInTimeRecalibrationForSM(iSM);
+  }
+  
+  fCalibTableValid = kTRUE;
+  
+  AliDebug(1,Form("Calibration table filled for %d cells in %d super modules",nCells,nSM));
+}
+
 ///
 /// For a given CaloCluster gets the absId of the cell 
 /// with maximum energy deposit.
@@ -1462,7 +1665,7 @@ void AliEMCALRecoUtils::GetMaxEnergyCell(const AliEMCALGeometry *geom,
     }
 
     if (!fCellsRecalibrated && IsRecalibrationOn()) 
-      recalFactor = GetEMCALChannelRecalibrationFactor(iSupMod,ieta,iphi);
+      recalFactor = GetCellRecalibrationFactor(cellAbsId);
     
     eCell  = cells->GetCellAmplitude(cellAbsId)*fraction*recalFactor;
     //printf("b Cell %d, id, %d, amp %f, fraction %f\n",iDig,cellAbsId,eCell,fraction);
@@ -1588,6 +1791,8 @@ void AliEMCALRecoUtils::InitParameters()
 void AliEMCALRecoUtils::InitEMCALRecalibrationFactors()
 {
   AliDebug(2,"AliCalorimeterUtils::InitEMCALRecalibrationFactors()");
+
+  fCalibTableValid = kFALSE;
   
   // In order to avoid rewriting the same histograms
   Bool_t oldStatus = TH1::AddDirectoryStatus();
@@ -1624,6 +1829,8 @@ void AliEMCALRecoUtils::InitEMCALTimeRecalibrationFactors()
 {
   AliDebug(2,"AliCalorimeterUtils::InitEMCALRecalibrationFactors()");
 
+  fCalibTableValid = kFALSE;
+
   // In order to avoid rewriting the same histograms
   Bool_t oldStatus = TH1::AddDirectoryStatus();
   TH1::AddDirectory(kFALSE);
@@ -1690,6 +1897,8 @@ void AliEMCALRecoUtils::InitEMCALBadChannelStatusMap()
 {
   AliDebug(2,"AliEMCALRecoUtils::InitEMCALBadChannelStatusMap()");
 
+  fCalibTableValid = kFALSE;
+
   // In order to avoid rewriting the same histograms
   Bool_t oldStatus = TH1::AddDirectoryStatus();
   TH1::AddDirectory(kFALSE);
@@ -1714,6 +1923,8 @@ void AliEMCALRecoUtils::InitEMCALBadChannelStatusMap()
 void AliEMCALRecoUtils::InitEMCALL1PhaseInTimeRecalibration()
 {
   AliDebug(2,"AliEMCALRecoUtils::InitEMCALL1PhaseInTimeRecalibrationFactors()");
+
+  fCalibTableValid = kFALSE;
  
   // In order to avoid rewriting the same histograms
   Bool_t oldStatus = TH1::AddDirectoryStatus();
@@ -1743,7 +1954,7 @@ void AliEMCALRecoUtils::InitEMCALL1PhaseInTimeRecalibration()
 /// \param bc: bunch crossing number returned by esdevent->GetBunchCrossNumber()
 ///
 //____________________________________________________________________________
-void AliEMCALRecoUtils::RecalibrateClusterEnergy(const AliEMCALGeometry* geom, 
+void AliEMCALRecoUtils::RecalibrateClusterEnergy(const AliEMCALGeometry* /*geom*/, 
                                                  AliVCluster * cluster, 
                                                  AliVCaloCells * cells, 
                                                  Int_t bc)
@@ -1762,11 +1973,19 @@ void AliEMCALRecoUtils::RecalibrateClusterEnergy(const AliEMCALGeometry* geom,
   // Initialize some used variables
   Float_t energy = 0;
   Int_t   absId  =-1;
-  Int_t   icol   =-1, irow =-1, imod=1;
+  Int_t   imod   = 1;
   Float_t factor = 1, frac = 0;
   Int_t   absIdMax = -1;
   Float_t emax     = 0;
   
+  Bool_t recalibrate = (!fCellsRecalibrated && IsRecalibrationOn());
+  Int_t  nSMRecalib  = 0;
+  if (recalibrate)
+  {
+    if (!fCalibTableValid) BuildCalibrationTable();
+    nSMRecalib = fEMCALRecalibrationFactors->GetEntries();
+  }
+  
   // Loop on the cells, get the cell amplitude and recalibration factor, multiply and and to the new energy
   for (Int_t icell = 0; icell < ncells; icell++)
   {
@@ -1774,18 +1993,17 @@ void AliEMCALRecoUtils::RecalibrateClusterEnergy(const AliEMCALGeometry* geom,
     frac =  fraction[icell];
     if (frac < 1e-5) frac = 1; //in case of EMCAL, this is set as 0 since unfolding is off
     
-    if (!fCellsRecalibrated && IsRecalibrationOn()) 
+    if (recalibrate) 
     {
       // Energy  
-      Int_t iTower = -1, iIphi = -1, iIeta = -1; 
-      geom->GetCellIndex(absId,imod,iTower,iIphi,iIeta); 
-      if (fEMCALRecalibrationFactors->GetEntries() <= imod) 
+      if (absId < (Int_t) fCalibTableSM.size() && fCalibTableSM[absId] >= 0)
+        imod = fCalibTableSM[absId];
+      if (nSMRecalib <= imod) 
         continue;
-      geom->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi, iIeta,irow,icol);      
-      factor = GetEMCALChannelRecalibrationFactor(imod,icol,irow);
+      factor = GetCellRecalibrationFactor(absId);
       
-      AliDebug(2,Form("AliEMCALRecoUtils::RecalibrateClusterEnergy - recalibrate cell: module %d, col %d, row %d, cell fraction %f,recalibration factor %f, cell energy %f\n",
-                      imod,icol,irow,frac,factor,cells->GetCellAmplitude(absId)));
+      AliDebug(2,Form("AliEMCALRecoUtils::RecalibrateClusterEnergy - recalibrate cell: absId %d, module %d, cell fraction %f,recalibration factor %f, cell energy %f\n",
+                      absId,imod,frac,factor,cells->GetCellAmplitude(absId)));
       
     } 
     
@@ -1848,13 +2066,23 @@ void AliEMCALRecoUtils::RecalibrateCells(AliVCaloCells * cells, Int_t bc)
   Int_t  mclabel = -1;
   Double_t efrac = 0;
   
+  if (!fCalibTableValid) BuildCalibrationTable();
+  if (!fCalibTableValid) return;
+  
+  // Cell amplitude, time and gain taken by position, no search by absId
   Int_t nEMcell  = cells->GetNumberOfCells() ;  
   for (Int_t iCell = 0; iCell < nEMcell; iCell++) 
   { 
     cells->GetCell( iCell, absId, ecellin, tcellin, mclabel, efrac );
     
-    accept = AcceptCalibrateCell(absId, bc, ecell ,tcell ,cells); 
-    if (!accept)
+    accept = AcceptCellFromTable(absId, ecell, tcell);
+    if (accept)
+    {
+      ecell = ecellin;
+      tcell = tcellin;
+      CalibrateCellFromTable(absId, bc, !(cells->GetHighGain(iCell)), ecell, tcell);
+    }
+    else
     {
       ecell = 0;
       tcell = -1;
@@ -1879,10 +2107,11 @@ void AliEMCALRecoUtils::RecalibrateCells(AliVCaloCells * cells, Int_t bc)
 void AliEMCALRecoUtils::RecalibrateCellTime(Int_t absId, Int_t bc, Double_t & celltime, Bool_t isLGon) const
 {  
   if (!fCellsRecalibrated && IsTimeRecalibrationOn() && bc >= 0) {
-    if(fLowGain)
-      celltime -= GetEMCALChannelTimeRecalibrationFactor(bc%4,absId,isLGon)*1.e-9;
+    Bool_t isLG = fLowGain && isLGon;
+    if(fCalibTableValid && absId >= 0 && absId < (Int_t) fCalibTableSM.size())
+      celltime -= fCalibTableTime[8*absId+4*isLG+bc%4]*1.e-9;
     else
-      celltime -= GetEMCALChannelTimeRecalibrationFactor(bc%4,absId,kFALSE)*1.e-9;
+      celltime -= GetEMCALChannelTimeRecalibrationFactor(bc%4,absId,isLG)*1.e-9;
   }
 }
 
@@ -1901,7 +2130,11 @@ void AliEMCALRecoUtils::RecalibrateCellTimeL1Phase(Int_t iSM, Int_t bc, Double_t
     bc=bc%4;
 
     Float_t offsetPerSM=0.;
-    Int_t l1PhaseShift = GetEMCALL1PhaseInTimeRecalibrationForSM(iSM);
+    Int_t l1PhaseShift = 0;
+    if (fCalibTableValid && iSM >= 0 && iSM < (Int_t) fCalibTableL1Phase.size())
+      l1PhaseShift = fCalibTableL1Phase[iSM];
+    else
+      l1PhaseShift = GetEMCALL1PhaseInTimeRecalibrationForSM(iSM);
     Int_t l1Phase=l1PhaseShift & 3; //bit operation
 
     if(bc >= l1Phase)
@@ -2094,7 +2327,7 @@ void AliEMCALRecoUtils::RecalculateClusterPositionFromTowerGlobal(const AliEMCAL
       geom->GetCellIndex(absId,iSM,iTower,iIphi,iIeta); 
       geom->GetCellPhiEtaIndexInSModule(iSM,iTower,iIphi, iIeta,iphi,ieta);      
       if (IsRecalibrationOn()) {
-        recalFactor = GetEMCALChannelRecalibrationFactor(iSM,ieta,iphi);
+        recalFactor = GetCellRecalibrationFactor(absId);
       }
     }
     
@@ -2189,7 +2422,7 @@ void AliEMCALRecoUtils::RecalculateClusterPositionFromTowerIndex(const AliEMCALG
     if (!fCellsRecalibrated)
     {
       if (IsRecalibrationOn()) {
-        recalFactor = GetEMCALChannelRecalibrationFactor(iSupMod,ieta,iphi);
+        recalFactor = GetCellRecalibrationFactor(absId);
       }
     }
     
@@ -2421,7 +2654,7 @@ void AliEMCALRecoUtils::RecalculateClusterShowerShapeParametersWithCellCuts(cons
     if (fraction < 1e-4) fraction = 1.; // in case unfolding is off
     
     if (IsRecalibrationOn()) 
-      recalFactor = GetEMCALChannelRecalibrationFactor(iSupMod,ieta,iphi);
+      recalFactor = GetCellRecalibrationFactor(absId);
     
     eCell  = cells->GetCellAmplitude(absId)*fraction*recalFactor;
     tCell  = cells->GetCellTime     (absId);
@@ -2453,7 +2686,7 @@ void AliEMCALRecoUtils::RecalculateClusterShowerShapeParametersWithCellCuts(cons
     if (fraction < 1e-4) fraction = 1.; // in case unfolding is off
     
     if (!fCellsRecalibrated && IsRecalibrationOn()) 
-        recalFactor = GetEMCALChannelRecalibrationFactor(iSupMod,ieta,iphi);
+        recalFactor = GetCellRecalibrationFactor(absId);
     
     eCell  = cells->GetCellAmplitude(absId)*fraction*recalFactor;
     tCell  = cells->GetCellTime     (absId);
@@ -2543,7 +2776,7 @@ void AliEMCALRecoUtils::RecalculateClusterShowerShapeParametersWithCellCuts(cons
     fraction  = cluster->GetCellAmplitudeFraction(iDigit);
     if (fraction < 1e-4) fraction = 1.; // in case unfolding is off
     if (IsRecalibrationOn()) 
-      recalFactor = GetEMCALChannelRecalibrationFactor(iSupMod,ieta,iphi);
+      recalFactor = GetCellRecalibrationFactor(absId);
     
     eCell  = cells->GetCellAmplitude(absId)*fraction*recalFactor;
     tCell  = cells->GetCellTime     (absId);
@@ -3717,6 +3950,7 @@ void AliEMCALRecoUtils::SetTracksMatchedToCluster(const AliVEvent *event)
 }
 
 void AliEMCALRecoUtils::SetEMCALChannelRecalibrationFactors(const TObjArray *map) { 
+  fCalibTableValid = kFALSE;
   if(fEMCALRecalibrationFactors) fEMCALRecalibrationFactors->Clear();
   else {
     fEMCALRecalibrationFactors = new TObjArray(map->GetEntries());
@@ -3734,6 +3968,7 @@ void AliEMCALRecoUtils::SetEMCALChannelRecalibrationFactors(const TObjArray *map
 }
 
 void AliEMCALRecoUtils::SetEMCALChannelRecalibrationFactors(Int_t iSM , const TH2F* h) { 
+  fCalibTableValid = kFALSE;
   if(!fEMCALRecalibrationFactors){
     fEMCALRecalibrationFactors = new TObjArray(iSM);
     fEMCALRecalibrationFactors->SetOwner(true);
@@ -3746,6 +3981,7 @@ void AliEMCALRecoUtils::SetEMCALChannelRecalibrationFactors(Int_t iSM , const TH
 }
 
 void AliEMCALRecoUtils::SetEMCALChannelStatusMap(const TObjArray *map) { 
+  fCalibTableValid = kFALSE;
   if(fEMCALBadChannelMap) fEMCALBadChannelMap->Clear();
   else {
     fEMCALBadChannelMap = new TObjArray(map->GetEntries());
@@ -3763,6 +3999,7 @@ void AliEMCALRecoUtils::SetEMCALChannelStatusMap(const TObjArray *map) {
 }
 
 void AliEMCALRecoUtils::SetEMCALChannelStatusMap(Int_t iSM , const TH2I* h) {
+  fCalibTableValid = kFALSE;
   if(!fEMCALBadChannelMap){
     fEMCALBadChannelMap = new TObjArray(iSM);
     fEMCALBadChannelMap->SetOwner(true);
@@ -3775,6 +4012,7 @@ void AliEMCALRecoUtils::SetEMCALChannelStatusMap(Int_t iSM , const TH2I* h) {
 }
 
 void  AliEMCALRecoUtils::SetEMCALChannelTimeRecalibrationFactors(const TObjArray *map) { 
+  fCalibTableValid = kFALSE;
   if(fEMCALTimeRecalibrationFactors) fEMCALTimeRecalibrationFactors->Clear();
   else {
     fEMCALTimeRecalibrationFactors = new TObjArray(map->GetEntries());
@@ -3792,6 +4030,7 @@ void  AliEMCALRecoUtils::SetEMCALChannelTimeRecalibrationFactors(const TObjArray
 }
 
 void  AliEMCALRecoUtils::SetEMCALChannelTimeRecalibrationFactors(Int_t bc, const TH1* h){ 
+  fCalibTableValid = kFALSE;
   if(!fEMCALTimeRecalibrationFactors){
     fEMCALTimeRecalibrationFactors = new TObjArray(bc);
     fEMCALTimeRecalibrationFactors->SetOwner(true);
@@ -3810,6 +4049,7 @@ void  AliEMCALRecoUtils::SetEMCALChannelTimeRecalibrationFactors(Int_t bc, const
 }
 
 void AliEMCALRecoUtils::SetEMCALL1PhaseInTimeRecalibrationForAllSM(const TObjArray *map) { 
+  fCalibTableValid = kFALSE;
   if(fEMCALL1PhaseInTimeRecalibration) fEMCALL1PhaseInTimeRecalibration->Clear();
   else {
     fEMCALL1PhaseInTimeRecalibration = new TObjArray(map->GetEntries());
@@ -3827,6 +4067,7 @@ void AliEMCALRecoUtils::SetEMCALL1PhaseInTimeRecalibrationForAllSM(const TObjArr
 }
 
 void AliEMCALRecoUtils::SetEMCALL1PhaseInTimeRecalibrationForAllSM(const TH1C* h) { 
+  fCalibTableValid = kFALSE;
   if(!fEMCALL1PhaseInTimeRecalibration){
     fEMCALL1PhaseInTimeRecalibration = new TObjArray(1);
     fEMCALL1PhaseInTimeRecalibration->SetOwner(true);
@@ -31,6 +31,9 @@
 ///
 ///////////////////////////////////////////////////////////////////////////////
 
+// C++ includes
+#include <vector>
+
 // Root includes
 #include <TNamed.h>
 #include <TMath.h>
@@ -166,6 +169,16 @@ public:
   void     RecalibrateClusterEnergy(const AliEMCALGeometry* geom, AliVCluster* cluster, AliVCaloCells * cells, Int_t bc=-1) ; // Energy and time
   void     ResetCellsCalibrated()                        { fCellsRecalibrated = kFALSE; }
 
+  // Flat calibration table, indexed by absId, filled from the calibration histograms
+  // at first use. Setters below invalidate it, call InvalidateCalibrationTable() if
+  // the histograms are modified directly.
+  void     BuildCalibrationTable() ;
+  void     InvalidateCalibrationTable()                  { fCalibTableValid = kFALSE ; }
+  Bool_t   IsCalibrationTableValid()               const { return fCalibTableValid ; }
+  Float_t  GetCellRecalibrationFactor(Int_t absId)       { if(!fCalibTableValid) BuildCalibrationTable() ;
+                                                           if(absId < 0 || absId >= (Int_t) fCalibTableEnergy.size()) return 1 ;
+                                                           return fCalibTableEnergy[absId] ; }
+
   // Energy recalibration
   Bool_t   IsRecalibrationOn()                     const { return fRecalibration ; }
   void     SwitchOffRecalibration()                      { fRecalibration = kFALSE ; }
@@ -182,7 +195,7 @@ public:
     else return 1 ; } 
   void     SetEMCALChannelRecalibrationFactor(Int_t iSM , Int_t iCol, Int_t iRow, Double_t c = 1) { 
     if(!fEMCALRecalibrationFactors) InitEMCALRecalibrationFactors() ;
-    ((TH2F*)fEMCALRecalibrationFactors->At(iSM))->SetBinContent(iCol,iRow,c) ; }
+    ((TH2F*)fEMCALRecalibrationFactors->At(iSM))->SetBinContent(iCol,iRow,c) ; fCalibTableValid = kFALSE ; }
   
   // Recalibrate channels energy with run dependent corrections
   Bool_t   IsRunDepRecalibrationOn()               const { return fUseRunCorrectionFactors ; }
@@ -190,7 +203,7 @@ public:
   void     SwitchOnRunDepCorrection()                    { fUseRunCorrectionFactors = kTRUE  ; 
                                                            SwitchOnRecalibration()           ; }      
   // Time Recalibration
-  void     SetUseOneHistForAllBCs(Bool_t useOneHist)     { fDoUseMergedBC = useOneHist ; }
+  void     SetUseOneHistForAllBCs(Bool_t useOneHist)     { fDoUseMergedBC = useOneHist ; fCalibTableValid = kFALSE ; }
   void     SetConstantTimeShift(Float_t shift)           { fConstantTimeShift = shift  ; }
 
   void     RecalibrateCellTime(Int_t absId, Int_t bc, Double_t & time,Bool_t isLGon = kFALSE) const;
@@ -211,6 +224,7 @@ public:
     } else return 0 ; } 
   void     SetEMCALChannelTimeRecalibrationFactor(Int_t bc, Int_t absID, Double_t c = 0, Bool_t isLGon=kFALSE) { 
     if(!fEMCALTimeRecalibrationFactors) InitEMCALTimeRecalibrationFactors() ;
+    fCalibTableValid = kFALSE ;
     if(fDoUseMergedBC)
       ((TH1S*)fEMCALTimeRecalibrationFactors->At(isLGon))->SetBinContent(absID,c) ;
     else
@@ -221,8 +235,8 @@ public:
   void     SetEMCALChannelTimeRecalibrationFactors(Int_t bc , const TH1* h);
 
   Bool_t   IsLGOn()const { return fLowGain   ; }
-  void     SwitchOffLG() { fLowGain = kFALSE ; }
-  void     SwitchOnLG()  { fLowGain = kTRUE  ; }
+  void     SwitchOffLG() { fLowGain = kFALSE ; fCalibTableValid = kFALSE ; }
+  void     SwitchOnLG()  { fLowGain = kTRUE  ; fCalibTableValid = kFALSE ; }
 
 
   // Time Recalibration with L1 phase
@@ -240,7 +254,7 @@ public:
     else return 0 ; } 
   void     SetEMCALL1PhaseInTimeRecalibrationForSM(Int_t iSM, Int_t c = 0) { 
     if(!fEMCALL1PhaseInTimeRecalibration) InitEMCALL1PhaseInTimeRecalibration();
-    ((TH1C*)fEMCALL1PhaseInTimeRecalibration->At(0))->SetBinContent(iSM,c) ; }  
+    ((TH1C*)fEMCALL1PhaseInTimeRecalibration->At(0))->SetBinContent(iSM,c) ; fCalibTableValid = kFALSE ; }  
   
   TH1C *   GetEMCALL1PhaseInTimeRecalibrationForAllSM()const       { return (TH1C*)fEMCALL1PhaseInTimeRecalibration->At(0) ; }	
   void     SetEMCALL1PhaseInTimeRecalibrationForAllSM(const TObjArray *map);
@@ -274,15 +288,16 @@ public:
   void     InitEMCALBadChannelStatusMap() ;
   void     SetEMCALBadChannelStatusSelection(Bool_t all, Bool_t dead, Bool_t hot, Bool_t warm);
   void     SetWarmChannelAsGood() 
-           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kWarning] = kFALSE; }
+           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kWarning] = kFALSE; fCalibTableValid = kFALSE; }
   void     SetDeadChannelAsGood() 
-           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kDead]    = kFALSE; }
+           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kDead]    = kFALSE; fCalibTableValid = kFALSE; }
   void     SetHotChannelAsGood() 
-           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kHot]     = kFALSE; } 
+           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kHot]     = kFALSE; fCalibTableValid = kFALSE; } 
   Bool_t   GetEMCALChannelStatus(Int_t iSM , Int_t iCol, Int_t iRow, Int_t & status) const ;
+  Bool_t   GetEMCALChannelStatus(Int_t absId, Int_t & status) ;
   void     SetEMCALChannelStatus(Int_t iSM , Int_t iCol, Int_t iRow, Double_t status = 1) { 
     if(!fEMCALBadChannelMap)InitEMCALBadChannelStatusMap()               ;
-    ((TH2I*)fEMCALBadChannelMap->At(iSM))->SetBinContent(iCol,iRow,status)    ; }
+    ((TH2I*)fEMCALBadChannelMap->At(iSM))->SetBinContent(iCol,iRow,status)    ; fCalibTableValid = kFALSE ; }
   TH2I *   GetEMCALChannelStatusMap(Int_t iSM)     const { return (TH2I*)fEMCALBadChannelMap->At(iSM) ; }
   void     SetEMCALChannelStatusMap(const TObjArray *map);
   void     SetEMCALChannelStatusMap(Int_t iSM , const TH2I* h);
@@ -420,6 +435,7 @@ public:
   Bool_t   IsRejectExoticCell()                 const { return fRejectExoticCells      ; }
   Float_t  GetECross(Int_t absID, Double_t tcell,
                      AliVCaloCells* cells, Int_t bc);
+  Int_t    FlagExoticCells(AliVCaloCells* cells, Int_t bc, std::vector<Bool_t> & isExotic) ;
   Float_t  GetExoticCellFractionCut()           const { return fExoticCellFraction     ; }
   Float_t  GetExoticCellDiffTimeCut()           const { return fExoticCellDiffTime     ; }
   Float_t  GetExoticCellMinAmplitudeCut()       const { return fExoticCellMinAmplitude ; }
@@ -459,6 +475,9 @@ public:
                                                       Float_t & amp, TArrayI & labeArr, TArrayF & eDepArr ) const;
 private:  
   
+  Bool_t   AcceptCellFromTable(Int_t absID, Float_t & amp, Double_t & time) const ;
+  void     CalibrateCellFromTable(Int_t absID, Int_t bc, Bool_t isLowGain, Float_t & amp, Double_t & time) const ;
+
   // Position recalculation
   Float_t    fMisalTransShift[15];       ///< Cluster position translation shift parameters
   Float_t    fMisalRotShift[15];         ///< Cluster position rotation shift parameters
@@ -510,6 +529,18 @@ private:
                                          ///<   2- Set hot as good if false
                                          ///<   3- Set warm as good if false
   
+  // Calibration table, same content as the histograms above, indexed by absId
+  Bool_t               fCalibTableValid;       //!<! Table up to date with the calibration histograms
+  std::vector<Short_t> fCalibTableSM;          //!<! Super module of each cell, -1 if the cell does not exist
+  std::vector<Int_t>   fCalibTableStatus;      //!<! Bad channel map status
+  std::vector<Bool_t>  fCalibTableBad;         //!<! Cell considered bad with the current status selection
+  std::vector<Float_t> fCalibTableEnergy;      //!<! Energy recalibration factor
+  std::vector<Float_t> fCalibTableTime;        //!<! Time shift in ns, 8 per cell: [4*isLowGain+bc%4]
+  std::vector<Int_t>   fCalibTableL1Phase;     //!<! L1 phase shift, per super module
+  std::vector<Int_t>   fCalibTableNeighbours;  //!<! absId of the 4 cells in cross, -1 if none
+  std::vector<Float_t> fCellEnergyByAbsId;     //!<! Calibrated energy of the cells of the event, see FlagExoticCells
+  std::vector<Double_t> fCellTimeByAbsId;      //!<! Calibrated time of the cells of the event, see FlagExoticCells
+
   // Border cells
   Int_t      fNCellsFromEMCALBorder;     ///< Number of cells from EMCAL border the cell with maximum amplitude has to be.
   Bool_t     fNoEMCALBorderAtEta0;       ///< Do fiducial cut in EMCAL region eta = 0?
@@ -569,7 +600,7 @@ private:
   Bool_t     fMCGenerToAcceptForTrack;   ///<  Activate the removal of tracks entering the track matching that come from a particular generator
   
   /// \cond CLASSIMP
-  ClassDef(AliEMCALRecoUtils, 30) ;
+  ClassDef(AliEMCALRecoUtils, 31) ;
   /// \endcond
 
 };
@@ -24,7 +24,13 @@
  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
  ************************************************************************************/
+#include <map>
+#include <string>
+#include <vector>
+#include <TArrayI.h>
+#include <TBufferFile.h>
 #include <TClonesArray.h>
+#include "AliAnalysisManager.h"
 #include "AliVEvent.h"
 #include "AliLog.h"
 #include "AliNamedArrayI.h"
@@ -37,6 +43,24 @@
 
 ClassImp(AliEmcalContainer);
 
+/**
+ * @struct AliEmcalContainer::AcceptanceCache
+ * @brief Selection result and kinematics of all objects of an array in the current event,
+ * stored column-wise and shared between containers with identical configuration
+ */
+struct AliEmcalContainer::AcceptanceCache {
+  Long64_t                  fEntry;                          ///< Entry of the analysis manager the cache belongs to
+  const TClonesArray       *fArray;                          ///< Array the cache was filled for
+  Int_t                     fNEntries;                       ///< Number of objects in the array at filling time
+  Bool_t                    fValid;                          ///< Cache filled for the current event
+  std::vector<UChar_t>      fAccepted;                       ///< Acceptance flag per object
+  std::vector<UInt_t>       fRejectionReason;                ///< Rejection reason per object
+  std::vector<Double_t>     fKinematics[kNCacheColumns];     ///< pt, eta, phi, E, m per object
+  std::vector<Int_t>        fAcceptIndices;                  ///< Indices of the accepted objects
+
+  AcceptanceCache() : fEntry(-1), fArray(0), fNEntries(0), fValid(kFALSE), fAccepted(), fRejectionReason(), fAcceptIndices() {}
+};
+
 AliEmcalContainer::AliEmcalContainer():
   TObject(),
   fName(),
@@ -56,10 +80,12 @@ AliEmcalContainer::AliEmcalContainer():
   fMaxMCLabel(-1),
   fMassHypothesis(-1),
   fIsEmbedding(kFALSE),
+  fUseAcceptanceCache(kFALSE),
   fClArray(0),
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fAcceptanceCache(0),
   fClassName()
 {
   fVertex[0] = 0;
@@ -86,10 +112,12 @@ AliEmcalContainer::AliEmcalContainer(const char *name):
   fMaxMCLabel(-1),
   fMassHypothesis(-1),
   fIsEmbedding(kFALSE),
+  fUseAcceptanceCache(kFALSE),
   fClArray(0),
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fAcceptanceCache(0),
   fClassName()
 {
   fVertex[0] = 0;
@@ -165,9 +193,124 @@ void AliEmcalContainer::NextEvent(const AliVEvent * event)
   if (!event) return;
 
   GetVertexFromEvent(event);
+
+  if (fUseAcceptanceCache) {
+    if (!fAcceptanceCache) AttachAcceptanceCache();
+
+    // The cache is shared: only the first container on the array in this event resets it.
+    // Without analysis manager the event cannot be identified, then it is reset each time.
+    AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+    Long64_t entry = mgr ? mgr->GetCurrentEntry() : -1;
+    if (entry < 0 || entry != fAcceptanceCache->fEntry || fAcceptanceCache->fArray != fClArray) {
+      fAcceptanceCache->fEntry = entry;
+      fAcceptanceCache->fArray = fClArray;
+      fAcceptanceCache->fValid = kFALSE;
+    }
+  }
+}
+
+void AliEmcalContainer::AttachAcceptanceCache()
+{
+  // Containers are identical if their streamed configuration is identical. The
+  // container name is only a label, it is excluded from the comparison.
+  static std::map<std::string, AcceptanceCache *> registry;
+
+  TBufferFile buffer(TBuffer::kWrite);
+  TString name(fName);
+  fName = "";
+  Streamer(buffer);
+  fName = name;
+
+  std::string key(IsA()->GetName());
+  key.append(1, '\0');
+  key.append(buffer.Buffer(), buffer.Length());
+
+  AcceptanceCache *&cache = registry[key];
+  if (!cache) {
+    cache = new AcceptanceCache;
+    AliDebug(1, Form("%s: new acceptance cache for array %s", GetName(), fClArrayName.Data()));
+  }
+  else {
+    AliDebug(1, Form("%s: sharing acceptance cache for array %s", GetName(), fClArrayName.Data()));
+  }
+  fAcceptanceCache = cache;
+}
+
+AliEmcalContainer::AcceptanceCache *AliEmcalContainer::GetAcceptanceCache() const
+{
+  if (!fAcceptanceCache) return 0;
+
+  AcceptanceCache &cache = *fAcceptanceCache;
+  const Int_t n = GetNEntries();
+  if (cache.fValid && cache.fNEntries == n) return fAcceptanceCache;
+
+  cache.fNEntries = n;
+  cache.fAccepted.resize(n);
+  cache.fRejectionReason.resize(n);
+  for (Int_t icol = 0; icol < kNCacheColumns; icol++) cache.fKinematics[icol].resize(n);
+  cache.fAcceptIndices.clear();
+
+  for (Int_t index = 0; index < n; index++) {
+    UInt_t rejectionReason = 0;
+    Bool_t accepted = AcceptObject(index, rejectionReason);
+    cache.fAccepted[index] = accepted;
+    cache.fRejectionReason[index] = rejectionReason;
+    if (accepted) cache.fAcceptIndices.push_back(index);
+
+    for (Int_t icol = 0; icol < kNCacheColumns; icol++) cache.fKinematics[icol][index] = 0;
+
+    AliTLorentzVector mom;
+    if (!GetMomentum(mom, index)) continue;
+    cache.fKinematics[kCacheE][index] = mom.E();
+    cache.fKinematics[kCacheM][index] = mom.M();
+    if (mom.Pt() > 0) {
+      cache.fKinematics[kCachePt][index]  = mom.Pt();
+      cache.fKinematics[kCacheEta][index] = mom.Eta();
+      cache.fKinematics[kCachePhi][index] = mom.Phi_0_2pi();
+    }
+  }
+  cache.fValid = kTRUE;
+
+  return fAcceptanceCache;
+}
+
+Bool_t AliEmcalContainer::GetCachedAcceptIndices(TArrayI &indices) const
+{
+  const AcceptanceCache *cache = GetAcceptanceCache();
+  if (!cache) return kFALSE;
+
+  indices.Set(cache->fAcceptIndices.size());
+  for (UInt_t i = 0; i < cache->fAcceptIndices.size(); i++) indices[i] = cache->fAcceptIndices[i];
+  return kTRUE;
+}
+
+Bool_t AliEmcalContainer::AcceptObjectCached(Int_t i, UInt_t &rejectionReason) const
+{
+  const AcceptanceCache *cache = GetAcceptanceCache();
+  if (!cache || i < 0 || i >= cache->fNEntries) return AcceptObject(i, rejectionReason);
+
+  rejectionReason |= cache->fRejectionReason[i];
+  return cache->fAccepted[i];
+}
+
+const Double_t *AliEmcalContainer::GetCachedKinematics(EAcceptanceCacheColumn column) const
+{
+  const AcceptanceCache *cache = GetAcceptanceCache();
+  if (!cache || cache->fNEntries == 0 || column < 0 || column >= kNCacheColumns) return 0;
+  return &(cache->fKinematics[column][0]);
+}
+
+const UInt_t *AliEmcalContainer::GetCachedRejectionReasons() const
+{
+  const AcceptanceCache *cache = GetAcceptanceCache();
+  if (!cache || cache->fNEntries == 0) return 0;
+  return &(cache->fRejectionReason[0]);
 }
 
 Int_t AliEmcalContainer::GetNAcceptEntries() const{
+  const AcceptanceCache *cache = GetAcceptanceCache();
+  if (cache) return cache->fAcceptIndices.size();
+
   Int_t result = 0;
   for(int index = 0; index < GetNEntries(); index++){
     UInt_t rejectionReason = 0;
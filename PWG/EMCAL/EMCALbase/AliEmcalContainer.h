@@ -36,6 +36,7 @@ class AliTLorentzVector;
 class AliVEvent;
 class AliNamedArrayI;
 class AliVParticle;
+class TArrayI;
 
 #include <TNamed.h>
 #include <TClonesArray.h>
@@ -97,6 +98,16 @@ typedef EMCALIterableContainer::AliEmcalIterableContainerT<TObject, EMCALIterabl
  * ~~~
  *
  * The usage of EMCAL containers is described under \subpage EMCALcontainers
+ *
+ * Optionally (SetUseAcceptanceCache) the result of the selection is cached per event:
+ * at the first request the acceptance, the rejection reason and the kinematics (\f$ p_{t} \f$,
+ * \f$ \eta \f$, \f$ \phi \f$, E, m) of all objects are evaluated once and stored column-wise.
+ * Iterations over accepted objects and GetNAcceptEntries are then served from the cache.
+ * The cache is shared between all containers in the process with identical configuration
+ * (same class, array and selection settings), so that in a train the selection is evaluated
+ * only once per event even if many wagons use their own container on the same array.
+ * The configuration is fixed at the first event; the cache must not be used if the content
+ * of the array changes within an event after the first request.
  */
 class AliEmcalContainer : public TObject {
  public:
@@ -144,6 +155,19 @@ class AliEmcalContainer : public TObject {
     kOverlapTpcHole = 1<<29             ///<Cut  on the regions of acceptance with bad sectors 
   };
 
+  /**
+   * @enum EAcceptanceCacheColumn
+   * @brief Kinematic columns stored in the acceptance cache
+   */
+  enum EAcceptanceCacheColumn {
+    kCachePt = 0,                        ///< \f$ p_{t} \f$
+    kCacheEta = 1,                       ///< \f$ \eta \f$
+    kCachePhi = 2,                       ///< \f$ \phi \f$ (in [0, 2\pi])
+    kCacheE = 3,                         ///< Energy
+    kCacheM = 4,                         ///< Mass
+    kNCacheColumns = 5                   ///< Number of columns
+  };
+
   /**
    * @brief Default constructor. 
    * 
@@ -229,6 +253,43 @@ class AliEmcalContainer : public TObject {
    */
   Int_t                       GetNAcceptEntries() const;
 
+  /**
+   * @brief Switch the per-event acceptance cache on or off
+   *
+   * Must be set before the first event is processed.
+   * @param[in] b If true the selection is cached per event and shared with identical containers
+   */
+  void                        SetUseAcceptanceCache(Bool_t b)       { fUseAcceptanceCache = b           ; }
+  Bool_t                      GetUseAcceptanceCache()         const { return fUseAcceptanceCache        ; }
+
+  /**
+   * @brief Indices of the accepted objects, from the acceptance cache
+   * @param[out] indices Indices of the accepted objects in the container
+   * @return False if the cache is not in use (indices are not set in this case)
+   */
+  Bool_t                      GetCachedAcceptIndices(TArrayI &indices) const;
+
+  /**
+   * @brief Acceptance of the object at index i, from the acceptance cache
+   * @param[in] i Index of the object in the container
+   * @param[out] rejectionReason Bitmap for reason why object is rejected
+   * @return True if the object is accepted (AcceptObject is used if the cache is not in use)
+   */
+  Bool_t                      AcceptObjectCached(Int_t i, UInt_t &rejectionReason) const;
+
+  /**
+   * @brief Column of the acceptance cache, indexed like the container
+   * @param[in] column Kinematic quantity
+   * @return Pointer to the first element, NULL if the cache is not in use or empty
+   */
+  const Double_t             *GetCachedKinematics(EAcceptanceCacheColumn column) const;
+
+  /**
+   * @brief Rejection reasons from the acceptance cache, indexed like the container
+   * @return Pointer to the first element, NULL if the cache is not in use or empty
+   */
+  const UInt_t               *GetCachedRejectionReasons() const;
+
   /**
    * @brief Reset the iterator to a given index
    * 
@@ -372,6 +433,10 @@ class AliEmcalContainer : public TObject {
    */
   void                        GetVertexFromEvent(const AliVEvent * event);
 
+  struct AcceptanceCache;
+  void                        AttachAcceptanceCache();
+  AcceptanceCache            *GetAcceptanceCache() const;
+
   TString                     fName;                    ///< object name
   TString                     fClArrayName;             ///< name of branch
   TString                     fBaseClassName;           ///< name of the base class that this container can handle
@@ -389,11 +454,13 @@ class AliEmcalContainer : public TObject {
   Int_t                       fMaxMCLabel;              ///< maximum MC label
   Double_t                    fMassHypothesis;          ///< if < 0 it will use a PID mass when available
   Bool_t                      fIsEmbedding;             ///< if true, this container will connect to an external event
+  Bool_t                      fUseAcceptanceCache;      ///< if true, the selection is cached per event and shared between identical containers
   TClonesArray               *fClArray;                 //!<! Pointer to array in input event
   Int_t                       fCurrentID;               //!<! current ID for automatic loops
   AliNamedArrayI             *fLabelMap;                //!<! Label-Index map
   Double_t                    fVertex[3];               //!<! event vertex array
   TClass                     *fLoadedClass;             //!<! Class of the objects contained in the TClonesArray
+  AcceptanceCache            *fAcceptanceCache;         //!<! Per-event acceptance cache (owned by the registry, shared)
 
  private:
   TString                     fClassName;               ///< name of the class in the TClonesArray
@@ -401,6 +468,6 @@ class AliEmcalContainer : public TObject {
   AliEmcalContainer(const AliEmcalContainer& obj); // copy constructor
   AliEmcalContainer& operator=(const AliEmcalContainer& other); // assignment
 
-  ClassDef(AliEmcalContainer,9);
+  ClassDef(AliEmcalContainer,10);
 };
 #endif
@@ -329,10 +329,12 @@ T *AliEmcalIterableContainerT<T, STAR>::operator[](int index) const {
 /**
  * Build list of accepted indices inside the container.
  * For this all objects inside the container are checked
- * for being accepted or not.
+ * for being accepted or not. Containers using the
+ * acceptance cache provide the list directly.
  */
 template <typename T, typename STAR>
 void AliEmcalIterableContainerT<T, STAR>::BuildAcceptIndices(){
+  if(fkContainer->GetCachedAcceptIndices(fAcceptIndices)) return;
   fAcceptIndices.Set(fkContainer->GetNAcceptEntries());
   int acceptCounter = 0;
   for(int index = 0; index < fkContainer->GetNEntries(); index++){
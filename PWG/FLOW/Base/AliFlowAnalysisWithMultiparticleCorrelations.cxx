@@ -64,6 +64,7 @@ AliFlowAnalysisWithMultiparticleCorrelations::AliFlowAnalysisWithMultiparticleCo
  fQvectorFlagsPro(NULL),
  fCalculateQvector(kFALSE),
  fCalculateDiffQvectors(kFALSE),
+ fCorrelator(),
  // 3.) Correlations:
  fCorrelationsList(NULL),
  fCorrelationsFlagsPro(NULL),
@@ -740,6 +741,8 @@ void AliFlowAnalysisWithMultiparticleCorrelations::CalculateCorrelations(AliFlow
  Double_t dMultRP = fSelectRandomlyRPs ? fnSelectedRandomlyRPs : anEvent->GetNumberOfRPs(); // TBI shall I promote this variable into data member? 
  if(fSkipSomeIntervals){ dMultRP = dMultRP - fNumberOfSkippedRPParticles; }
  
+ // Bin labels are cast into harmonics only once, then all correlators are evaluated with the generic
+ // recursion, which shares sub-correlators between harmonic combinations and between cos and sin: 
  for(Int_t cs=0;cs<2;cs++) // cos/sin 
  {
   if(fCalculateOnlyCos && 1==cs){continue;}
@@ -747,15 +750,27 @@ void AliFlowAnalysisWithMultiparticleCorrelations::CalculateCorrelations(AliFlow
   for(Int_t co=0;co<8;co++) // correlator order (TBI hardwired 8) 
   {
    if(dMultRP < co+1){break;} // defines min. number of particles in an event for a certain correlator to make sense
-   Int_t nBins = 0;
-   if(fCorrelationsPro[cs][co]){nBins = fCorrelationsPro[cs][co]->GetNbinsX();}
-   else{continue;}
+   if(!fCorrelationsPro[cs][co]){continue;}
+   std::vector<Int_t> &harmonics = fCorrelationsHarmonics[cs][co];
+   if(harmonics.empty())
+   {
+    Int_t nBins = fCorrelationsPro[cs][co]->GetNbinsX();
+    for(Int_t b=1;b<=nBins;b++)
+    {
+     const char *binLabel = fCorrelationsPro[cs][co]->GetXaxis()->GetBinLabel(b);
+     if(TString(binLabel).EqualTo("")){break;} 
+     Int_t n[8] = {0,0,0,0,0,0,0,0};
+     Bool_t bRealPart = kTRUE;
+     if(co+1 != CastStringToHarmonics(binLabel,n,bRealPart)){Fatal(sMethodName.Data(),"Bin label '%s' is not a %d-p correlation",binLabel,co+1);}
+     harmonics.insert(harmonics.end(),n,n+co+1);
+    }
+   } // if(harmonics.empty())
+   Int_t nBins = harmonics.size()/(co+1);
+   Double_t den = fCorrelator.NumberOfCombinations(co+1);
    for(Int_t b=1;b<=nBins;b++)
    {
-    TString sBinLabel = fCorrelationsPro[cs][co]->GetXaxis()->GetBinLabel(b);
-    if(sBinLabel.EqualTo("")){break;} 
-    Double_t num = CastStringToCorrelation(sBinLabel.Data(),kTRUE);
-    Double_t den = CastStringToCorrelation(sBinLabel.Data(),kFALSE);
+    std::complex<Double_t> corr = fCorrelator.Correlator(co+1,&harmonics[(b-1)*(co+1)]);
+    Double_t num = (0==cs) ? corr.real() : corr.imag();
     Double_t weight = den; // TBI: add support for other options for the weight eventually
     if(den>0.) 
     {
@@ -873,13 +888,13 @@ void AliFlowAnalysisWithMultiparticleCorrelations::CalculateEtaGaps(AliFlowEvent
   {
    // Access kinematic variables for RP and corresponding weights:
    dPhi = pTrack->Phi(); // azimuthal angle
-   if(fUseWeights[0][0]){wPhi = Weight(dPhi,"RP","phi");} // corresponding phi weight
+   if(fUseWeights[0][0]){wPhi = Weight(dPhi,0,0);} // corresponding phi weight
    //if(dPhi < 0.){dPhi += TMath::TwoPi();} TBI
    //if(dPhi > TMath::TwoPi()){dPhi -= TMath::TwoPi();} TBI
    dPt = pTrack->Pt();
-   if(fUseWeights[0][1]){wPt = Weight(dPt,"RP","pt");} // corresponding pT weight
+   if(fUseWeights[0][1]){wPt = Weight(dPt,0,1);} // corresponding pT weight
    dEta = pTrack->Eta();
-   if(fUseWeights[0][2]){wEta = Weight(dEta,"RP","eta");} // corresponding eta weight
+   if(fUseWeights[0][2]){wEta = Weight(dEta,0,2);} // corresponding eta weight
    if(fUseWeights[0][0]||fUseWeights[0][1]||fUseWeights[0][2]){wToPowerP = wPhi*wPt*wEta;}
    // Calculate Qa and Qb vectors:
    if(dEta<0.) // Qa
@@ -934,15 +949,33 @@ Double_t AliFlowAnalysisWithMultiparticleCorrelations::CastStringToCorrelation(c
  // If you issue a call to this method with setting numerator = kFALSE, then you are getting back for free
  // the corresponding denumerator (a.k.a. weight 'number of combinations').
 
+ // Correlations are evaluated with the generic recursion of fCorrelator from the current Q-vector
+ // components, so repeated calls for the same harmonics in one event are cheap.
+
+ Int_t n[8] = {0,0,0,0,0,0,0,0}; // harmonics, supporting up to 8p correlations
+ Bool_t bRealPart = kTRUE;
+ Int_t whichCorr = this->CastStringToHarmonics(string,n,bRealPart);
+
+ if(!numerator){return fCorrelator.NumberOfCombinations(whichCorr);}
+ std::complex<Double_t> corr = fCorrelator.Correlator(whichCorr,n);
+ return bRealPart ? corr.real() : corr.imag();
+
+} // Double_t AliFlowAnalysisWithMultiparticleCorrelations::CastStringToCorrelation(const char *string, Bool_t numerator)
+
+//=======================================================================================================================
+
+Int_t AliFlowAnalysisWithMultiparticleCorrelations::CastStringToHarmonics(const char *string, Int_t *n, Bool_t &bRealPart)
+{
+ // Cast string of the generic form Cos/Sin(-n_1,-n_2,...,n_{k-1},n_k) into harmonics n[0..k-1] (n shall hold 8
+ // entries) and Cos/Sin into bRealPart. Returns k, the order of correlation.
+
  // TBI:
  // a) add protection against cases a la:
  //     string = Cos(-3,-4,5,6,5,6,-3)
  //     method = Six(-3,-4,5,6,5,-3).Re()
  // b) cross-check with nested loops this method 
 
- Double_t dValue = 0.; // return value
-
- TString sMethodName = "AliFlowAnalysisWithMultiparticleCorrelations::CastStringToCorrelation(const char *string, Bool_t numerator)"; 
+ TString sMethodName = "AliFlowAnalysisWithMultiparticleCorrelations::CastStringToHarmonics(const char *string, Int_t *n, Bool_t &bRealPart)"; 
 
  if(!(TString(string).BeginsWith("Cos") || TString(string).BeginsWith("Sin")))
  {
@@ -950,11 +983,10 @@ Double_t AliFlowAnalysisWithMultiparticleCorrelations::CastStringToCorrelation(c
   Fatal(sMethodName.Data(),"!(TString(string).BeginsWith(...");
  }
 
- Bool_t bRealPart = kTRUE;
+ bRealPart = kTRUE;
  if(TString(string).BeginsWith("Sin")){bRealPart = kFALSE;}
 
- Int_t n[8] = {0,0,0,0,0,0,0,0}; // harmonics, supporting up to 8p correlations
- UInt_t whichCorr = 0;   
+ Int_t whichCorr = 0;   
  for(Int_t t=0;t<=TString(string).Length();t++)
  {
   if(TString(string[t]).EqualTo(",") || TString(string[t]).EqualTo(")")) // TBI this is just ugly
@@ -973,64 +1005,15 @@ Double_t AliFlowAnalysisWithMultiparticleCorrelations::CastStringToCorrelation(c
   } // if(TString(string[t]).EqualTo(",") || TString(string[t]).EqualTo(")")) // TBI this is just ugly
  } // for(UInt_t t=0;t<=TString(string).Length();t++)
 
- switch(whichCorr)
+ if(0==whichCorr)
  {
-  case 1:
-   if(!numerator){dValue = One(0).Re();}
-   else if(bRealPart){dValue = One(n[0]).Re();} 
-   else{dValue = One(n[0]).Im();}
-  break;
-
-  case 2: 
-   if(!numerator){dValue = Two(0,0).Re();}
-   else if(bRealPart){dValue = Two(n[0],n[1]).Re();}
-   else{dValue = Two(n[0],n[1]).Im();}
-  break;
-
-  case 3: 
-   if(!numerator){dValue = Three(0,0,0).Re();}
-   else if(bRealPart){dValue = Three(n[0],n[1],n[2]).Re();}
-   else{dValue = Three(n[0],n[1],n[2]).Im();}
-  break;
-
-  case 4: 
-   if(!numerator){dValue = Four(0,0,0,0).Re();}
-   else if(bRealPart){dValue = Four(n[0],n[1],n[2],n[3]).Re();}
-   else{dValue = Four(n[0],n[1],n[2],n[3]).Im();}
-  break;
-
-  case 5: 
-   if(!numerator){dValue = Five(0,0,0,0,0).Re();}
-   else if(bRealPart){dValue = Five(n[0],n[1],n[2],n[3],n[4]).Re();}
-   else{dValue = Five(n[0],n[1],n[2],n[3],n[4]).Im();}
-  break;
-
-  case 6: 
-   if(!numerator){dValue = Six(0,0,0,0,0,0).Re();}
-   else if(bRealPart){dValue = Six(n[0],n[1],n[2],n[3],n[4],n[5]).Re();}
-   else{dValue = Six(n[0],n[1],n[2],n[3],n[4],n[5]).Im();}
-  break;
-
-  case 7: 
-   if(!numerator){dValue = Seven(0,0,0,0,0,0,0).Re();}
-   else if(bRealPart){dValue = Seven(n[0],n[1],n[2],n[3],n[4],n[5],n[6]).Re();}
-   else{dValue = Seven(n[0],n[1],n[2],n[3],n[4],n[5],n[6]).Im();}
-   break;
-
-  case 8: 
-   if(!numerator){dValue = Eight(0,0,0,0,0,0,0,0).Re();}
-   else if(bRealPart){dValue = Eight(n[0],n[1],n[2],n[3],n[4],n[5],n[6],n[7]).Re();} 
-   else{dValue = Eight(n[0],n[1],n[2],n[3],n[4],n[5],n[6],n[7]).Im();} 
-  break;
-
-  default:
-   cout<<Form("And the fatal 'whichCorr' value is... %d. Congratulations!!",whichCorr)<<endl; 
-   Fatal(sMethodName.Data(),"switch(whichCorr)"); 
- } // switch(whichCorr)
+  cout<<Form("And the fatal string is... '%s'. Congratulations!!",string)<<endl; 
+  Fatal(sMethodName.Data(),"whichCorr==0"); 
+ }
  
- return dValue;
+ return whichCorr;
 
-} // Double_t AliFlowAnalysisWithMultiparticleCorrelations::CastStringToCorrelation(const char *string, Bool_t numerator)
+} // Int_t AliFlowAnalysisWithMultiparticleCorrelations::CastStringToHarmonics(const char *string, Int_t *n, Bool_t &bRealPart)
 
 //=======================================================================================================================
 
@@ -2001,6 +1984,7 @@ void AliFlowAnalysisWithMultiparticleCorrelations::FillQvector(AliFlowEventSimpl
  Double_t dEta = 0., wEta = 1.; // pseudorapidity and corresponding eta weight
  Double_t wToPowerP = 1.; // weight raised to power p
  Int_t nCounterRPs = 0;
+ fCorrelator.Reset(); // zero flat Q-vector components and forget sub-correlators of the previous event
  for(Int_t t=0;t<nTracks;t++) // loop over all tracks
  {
   AliFlowTrackSimple *pTrack = NULL;
@@ -2028,23 +2012,16 @@ void AliFlowAnalysisWithMultiparticleCorrelations::FillQvector(AliFlowEventSimpl
 
    // Access kinematic variables for RP and corresponding weights:
    dPhi = pTrack->Phi(); // azimuthal angle
-   if(fUseWeights[0][0]){wPhi = Weight(dPhi,"RP","phi");} // corresponding phi weight
+   if(fUseWeights[0][0]){wPhi = Weight(dPhi,0,0);} // corresponding phi weight
    //if(dPhi < 0.){dPhi += TMath::TwoPi();} TBI
    //if(dPhi > TMath::TwoPi()){dPhi -= TMath::TwoPi();} TBI
    dPt = pTrack->Pt();
-   if(fUseWeights[0][1]){wPt = Weight(dPt,"RP","pt");} // corresponding pT weight
+   if(fUseWeights[0][1]){wPt = Weight(dPt,0,1);} // corresponding pT weight
    dEta = pTrack->Eta();
-   if(fUseWeights[0][2]){wEta = Weight(dEta,"RP","eta");} // corresponding eta weight
+   if(fUseWeights[0][2]){wEta = Weight(dEta,0,2);} // corresponding eta weight
 
-   // Calculate Q-vector components:
-   for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++)
-   {
-    for(Int_t wp=0;wp<fMaxCorrelator+1;wp++) // weight power
-    {
-     if(fUseWeights[0][0]||fUseWeights[0][1]||fUseWeights[0][2]){wToPowerP = pow(wPhi*wPt*wEta,wp);} 
-     fQvector[h][wp] += TComplex(wToPowerP*TMath::Cos(h*dPhi),wToPowerP*TMath::Sin(h*dPhi));
-    } // for(Int_t wp=0;wp<fMaxCorrelator+1;wp++)
-   } // for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++)
+   // Calculate Q-vector components (flat arrays, copied into fQvector after the loop):
+   fCorrelator.Fill(dPhi,wPhi*wPt*wEta);
   } // if(pTrack->InRPSelection()) // fill Q-vector components only with reference particles
 
   // Differential Q-vectors (a.k.a. p-vector and q-vector):
@@ -2055,13 +2032,13 @@ void AliFlowAnalysisWithMultiparticleCorrelations::FillQvector(AliFlowEventSimpl
 
    // Access kinematic variables for POI and corresponding weights:
    dPhi = pTrack->Phi(); // azimuthal angle
-   if(fUseWeights[1][0]){wPhi = Weight(dPhi,"POI","phi");} // corresponding phi weight
+   if(fUseWeights[1][0]){wPhi = Weight(dPhi,1,0);} // corresponding phi weight
    //if(dPhi < 0.){dPhi += TMath::TwoPi();} TBI
    //if(dPhi > TMath::TwoPi()){dPhi -= TMath::TwoPi();} TBI
    dPt = pTrack->Pt();
-   if(fUseWeights[1][1]){wPt = Weight(dPt,"POI","pt");} // corresponding pT weight
+   if(fUseWeights[1][1]){wPt = Weight(dPt,1,1);} // corresponding pT weight
    dEta = pTrack->Eta();
-   if(fUseWeights[1][2]){wEta = Weight(dEta,"POI","eta");} // corresponding eta weight
+   if(fUseWeights[1][2]){wEta = Weight(dEta,1,2);} // corresponding eta weight
 
    // Determine bin:
    Int_t binNo = -44;
@@ -2085,16 +2062,16 @@ void AliFlowAnalysisWithMultiparticleCorrelations::FillQvector(AliFlowEventSimpl
       // Fill q-vector components:
       wPhi = 1.; wPt = 1.; wEta = 1.; wToPowerP = 1.; // TBI this shall go somewhere else, for performance sake
 
-      if(fUseWeights[0][0]){wPhi = Weight(dPhi,"RP","phi");} // corresponding phi weight
+      if(fUseWeights[0][0]){wPhi = Weight(dPhi,0,0);} // corresponding phi weight
       //if(dPhi < 0.){dPhi += TMath::TwoPi();} TBI
       //if(dPhi > TMath::TwoPi()){dPhi -= TMath::TwoPi();} TBI
-      if(fUseWeights[0][1]){wPt = Weight(dPt,"RP","pt");} // corresponding pT weight
-      if(fUseWeights[0][2]){wEta = Weight(dEta,"RP","eta");} // corresponding eta weight
-      if(fUseWeights[1][0]){wPhi = Weight(dPhi,"POI","phi");} // corresponding phi weight
+      if(fUseWeights[0][1]){wPt = Weight(dPt,0,1);} // corresponding pT weight
+      if(fUseWeights[0][2]){wEta = Weight(dEta,0,2);} // corresponding eta weight
+      if(fUseWeights[1][0]){wPhi = Weight(dPhi,1,0);} // corresponding phi weight
       //if(dPhi < 0.){dPhi += TMath::TwoPi();} TBI
       //if(dPhi > TMath::TwoPi()){dPhi -= TMath::TwoPi();} TBI
-      if(fUseWeights[1][1]){wPt = Weight(dPt,"POI","pt");} // corresponding pT weight
-      if(fUseWeights[1][2]){wEta = Weight(dEta,"POI","eta");} // corresponding eta weight
+      if(fUseWeights[1][1]){wPt = Weight(dPt,1,1);} // corresponding pT weight
+      if(fUseWeights[1][2]){wEta = Weight(dEta,1,2);} // corresponding eta weight
       if(fUseWeights[0][0]||fUseWeights[0][1]||fUseWeights[0][2]||fUseWeights[1][0]||fUseWeights[1][1]||fUseWeights[1][2]){wToPowerP = pow(wPhi*wPt*wEta,wp);} 
       fqvector[binNo-1][h][wp] += TComplex(wToPowerP*TMath::Cos(h*dPhi),wToPowerP*TMath::Sin(h*dPhi));
      } // if(pTrack->InRPSelection()) 
@@ -2105,6 +2082,15 @@ void AliFlowAnalysisWithMultiparticleCorrelations::FillQvector(AliFlowEventSimpl
 
  } // for(Int_t t=0;t<nTracks;t++) // loop over all tracks
 
+ // Copy flat Q-vector components, fQvector is still used by Q(n,p) and all methods built on it:
+ for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++)
+ {
+  for(Int_t wp=0;wp<fMaxCorrelator+1;wp++) // weight power
+  {
+   fQvector[h][wp] = TComplex(fCorrelator.GetQRe(h,wp),fCorrelator.GetQIm(h,wp));
+  }
+ }
+
 } // void AliFlowAnalysisWithMultiparticleCorrelations::FillQvector(AliFlowEventSimple *anEvent)
 
 //=======================================================================================================================
@@ -2642,7 +2628,7 @@ void AliFlowAnalysisWithMultiparticleCorrelations::BookEverythingForQvector()
  // Book all the stuff for Q-vector.
 
  // a) Book the profile holding all the flags for Q-vector;
- // ...
+ // b) Allocate flat Q-vector components and the cache of the generic recursion.
 
  // a) Book the profile holding all the flags for Q-vector:
  fQvectorFlagsPro = new TProfile("fQvectorFlagsPro","Flags for Q-vectors",2,0,2);
@@ -2657,7 +2643,8 @@ void AliFlowAnalysisWithMultiparticleCorrelations::BookEverythingForQvector()
  fQvectorFlagsPro->GetXaxis()->SetBinLabel(2,"fCalculateDiffQvectors"); fQvectorFlagsPro->Fill(1.5,fCalculateDiffQvectors); 
  fQvectorList->Add(fQvectorFlagsPro);
 
- // ...
+ // b) Allocate flat Q-vector components and the cache of the generic recursion:
+ fCorrelator.Init(fMaxHarmonic*fMaxCorrelator,fMaxCorrelator);
 
 } // void AliFlowAnalysisWithMultiparticleCorrelations::BookEverythingForQvector()
 
@@ -3863,6 +3850,8 @@ void AliFlowAnalysisWithMultiparticleCorrelations::ResetQvector()
 {
  // Reset all Q-vector components to zero before starting a new event. 
 
+ fCorrelator.Reset();
+
  for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++) 
  {
   for(Int_t wp=0;wp<fMaxCorrelator+1;wp++) // weight powe
@@ -4204,13 +4193,21 @@ Double_t AliFlowAnalysisWithMultiparticleCorrelations::Weight(const Double_t &va
  if(TString(variable).EqualTo("pt")){ppe=1;} 
  if(TString(variable).EqualTo("eta")){ppe=2;} 
 
- if(!fWeightsHist[rp][ppe]){Fatal(sMethodName.Data(),"!fWeightsHist[rp][ppe]");}
+ return this->Weight(value,rp,ppe);
 
- Double_t weight = fWeightsHist[rp][ppe]->GetBinContent(fWeightsHist[rp][ppe]->FindBin(value));
+} // Double_t AliFlowAnalysisWithMultiparticleCorrelations::Weight(const Double_t &value, const char *type, const char *variable)
 
- return weight;
+//=======================================================================================================================
 
-} // Double_t AliFlowAnalysisWithMultiparticleCorrelations::Weight(const Double_t &value, const char *type, const char *variable)
+Double_t AliFlowAnalysisWithMultiparticleCorrelations::Weight(const Double_t &value, Int_t rp, Int_t ppe) // value, [0=RP,1=POI], [0=phi,1=pt,2=eta]
+{
+ // Determine particle weight, with type and variable already resolved into indices (used per track). 
+
+ if(!fWeightsHist[rp][ppe]){Fatal("AliFlowAnalysisWithMultiparticleCorrelations::Weight(const Double_t &value, Int_t rp, Int_t ppe)","!fWeightsHist[%d][%d]",rp,ppe);}
+
+ return fWeightsHist[rp][ppe]->GetBinContent(fWeightsHist[rp][ppe]->FindBin(value));
+
+} // Double_t AliFlowAnalysisWithMultiparticleCorrelations::Weight(const Double_t &value, Int_t rp, Int_t ppe)
 
 //=======================================================================================================================
 
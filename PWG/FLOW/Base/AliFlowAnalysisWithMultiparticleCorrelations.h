@@ -30,6 +30,8 @@
 #include "TStopwatch.h"
 #include "AliFlowEventSimple.h"
 #include "AliFlowTrackSimple.h"
+#include "AliFlowMultiparticleCorrelator.h"
+#include <vector>
 
 class AliFlowAnalysisWithMultiparticleCorrelations{
  public:
@@ -313,7 +315,9 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   virtual TComplex ThreeDiff(Int_t n1, Int_t n2, Int_t n3);
   virtual TComplex FourDiff(Int_t n1, Int_t n2, Int_t n3, Int_t n4);
   virtual Double_t Weight(const Double_t &value, const char *type, const char *variable); // value, [RP,POI], [phi,pt,eta]
+  virtual Double_t Weight(const Double_t &value, Int_t rp, Int_t ppe); // value, [0=RP,1=POI], [0=phi,1=pt,2=eta]
   virtual Double_t CastStringToCorrelation(const char *string, Bool_t numerator);
+  virtual Int_t CastStringToHarmonics(const char *string, Int_t *n, Bool_t &bRealPart);
   virtual Double_t Covariance(const char *x, const char *y, TProfile2D *profile2D, Bool_t bUnbiasedEstimator = kFALSE);
   virtual TComplex Recursion(Int_t n, Int_t* harmonic, Int_t mult = 1, Int_t skip = 0); // Credits: Kristjan Gulbrandsen (gulbrand@nbi.dk) 
   virtual void CalculateProductsOfCorrelations(AliFlowEventSimple *anEvent, TProfile2D *profile2D);
@@ -386,6 +390,7 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   Bool_t fCalculateDiffQvectors; // to calculate or not to calculate p- and q-vector components, that's a Boolean...  
   TComplex fpvector[100][49][9]; // p-vector components [bin][fMaxHarmonic*fMaxCorrelator+1][fMaxCorrelator+1] = [6*8+1][8+1] TBI hardwired 100
   TComplex fqvector[100][49][9]; // q-vector components [bin][fMaxHarmonic*fMaxCorrelator+1][fMaxCorrelator+1] = [6*8+1][8+1] TBI hardwired 100
+  AliFlowMultiparticleCorrelator fCorrelator; //! flat Q-vector components and generic recursion with cached sub-correlators, filled together with fQvector
 
   // 3.) Correlations:
   TList *fCorrelationsList;           // list to hold all correlations objects
@@ -404,6 +409,7 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   Bool_t fCalculateOnlyForSC;         // calculate only correlations needed for 'standard candles'
   Bool_t fCalculateOnlyCos;           // calculate only 'cos' correlations
   Bool_t fCalculateOnlySin;           // calculate only 'sin' correlations
+  std::vector<Int_t> fCorrelationsHarmonics[2][8]; //! harmonics cast once from bin labels of fCorrelationsPro[2][8], co+1 per bin
 
   // 4.) Event-by-event cumulants:
   TList *fEbECumulantsList;         // list to hold all e-b-e cumulants objects
@@ -477,7 +483,7 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   Int_t fHighestHarmonicEtaGaps;      // 2-p correlations with eta gaps will be calculated for harmonics [fLowestHarmonicEtaGaps,fHighestHarmonicEtaGaps]
   TProfile *fEtaGapsPro[6];           // [harmonic] different eta gaps are different bins
 
-  ClassDef(AliFlowAnalysisWithMultiparticleCorrelations,6);
+  ClassDef(AliFlowAnalysisWithMultiparticleCorrelations,7);
 
 };
 
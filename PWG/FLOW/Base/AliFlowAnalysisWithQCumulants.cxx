@@ -368,7 +368,6 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
  fNumberOfPOIsEBE = anEvent->GetNumberOfPOIs(); // number of POIs (i.e. number of particles of interest)
  fReferenceMultiplicityEBE = anEvent->GetReferenceMultiplicity(); // reference multiplicity for current event
  //Printf("Reference multiplicity (QC): %.1f",fReferenceMultiplicityEBE);
- Double_t ptEta[2] = {0.,0.}; // 0 = dPt, 1 = dEta
   
  // c) Fill the common control histograms and call the method to fill fAvMultiplicity:
  this->FillCommonControlHistograms(anEvent);                                                               
@@ -376,9 +375,19 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
  if(fStoreControlHistograms){this->FillControlHistograms(anEvent);}                                                              
                                                                                                                                                                                                                                                                                         
  // d) Loop over data and calculate e-b-e quantities Q_{n,k}, S_{p,k} and s_{p,k}:
+ //    For each track cos((m+1)*n*phi), sin((m+1)*n*phi) and w^k are evaluated only once, with recurrences,
+ //    and summed directly in the contiguous storage of fReQ and fImQ; differential Q-vectors are summed
+ //    per bin in flat arrays and copied into the e-b-e profiles after the loop (see AddToDiffQvectorsEBE).
  Int_t nPrim = anEvent->NumberOfTracks();  // nPrim = total number of primary tracks
  AliFlowTrackSimple *aftsTrack = NULL;
  Int_t n = fHarmonic; // shortcut for the harmonic 
+ Double_t *reQ = fReQ->GetMatrixArray(); // (*fReQ)(m,k) = reQ[m*9+k]
+ Double_t *imQ = fImQ->GetMatrixArray(); // (*fImQ)(m,k) = imQ[m*9+k]
+ Double_t dSumOfWeightPowers[9] = {0.}; // sum_{i=1}^{M} w_{i}^{k}
+ Double_t dCos[12] = {0.}; // cos((m+1)*n*phi) for current track 
+ Double_t dSin[12] = {0.}; // sin((m+1)*n*phi) for current track
+ Double_t dWk[9] = {1.}; // w^k for current track
+ Int_t binPtEta[3] = {-1,-1,-1}; // bins in pt, eta and (pt,eta) for current track
  for(Int_t i=0;i<nPrim;i++) 
  { 
   if(fExactNoRPs > 0 && nCounterNoRPs>fExactNoRPs){continue;}
@@ -386,12 +395,27 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
   if(aftsTrack)
   {
    if(!(aftsTrack->InRPSelection() || aftsTrack->InPOISelection())){continue;} // safety measure: consider only tracks which are RPs or POIs
+   dPhi = aftsTrack->Phi();
+   dPt  = aftsTrack->Pt();
+   dEta = aftsTrack->Eta();
+   // cos((m+1)*n*phi) and sin((m+1)*n*phi), m = 0,1,...,11, from cos(n*phi) and sin(n*phi):
+   dCos[0] = TMath::Cos(n*dPhi);
+   dSin[0] = TMath::Sin(n*dPhi);
+   for(Int_t m=1;m<12;m++) 
+   {
+    dCos[m] = dCos[m-1]*dCos[0]-dSin[m-1]*dSin[0];
+    dSin[m] = dSin[m-1]*dCos[0]+dCos[m-1]*dSin[0];
+   }
+   // Bins for differential flow, common to all r, p and q e-b-e profiles:
+   if(fCalculateDiffFlow)
+   {
+    binPtEta[0] = fReRPQ1dEBE[0][0][0][0]->FindBin(dPt);
+    if(fCalculateDiffFlowVsEta){binPtEta[1] = fReRPQ1dEBE[0][1][0][0]->FindBin(dEta);}
+   }
+   if(fCalculate2DDiffFlow){binPtEta[2] = fReRPQ2dEBE[0][0][0]->FindBin(dPt,dEta);}
    if(aftsTrack->InRPSelection()) // RP condition:
    {    
     nCounterNoRPs++;
-    dPhi = aftsTrack->Phi();
-    dPt  = aftsTrack->Pt();
-    dEta = aftsTrack->Eta();
     if(fUsePhiWeights && fPhiWeights && fnBinsPhi) // determine phi weight for this particle:
     {
      wPhi = fPhiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*fnBinsPhi/TMath::TwoPi())));
@@ -409,95 +433,33 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
     {
      wTrack = aftsTrack->Weight(); 
     }
+    for(Int_t k=1;k<9;k++){dWk[k] = dWk[k-1]*wPhi*wPt*wEta*wTrack;}
     // Calculate Re[Q_{m*n,k}] and Im[Q_{m*n,k}] for this event (m = 1,2,...,12, k = 0,1,...,8):
     for(Int_t m=0;m<12;m++) // to be improved - hardwired 6 
     {
      for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
      {
-      (*fReQ)(m,k)+=pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1)*n*dPhi); 
-      (*fImQ)(m,k)+=pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1)*n*dPhi); 
+      reQ[m*9+k] += dWk[k]*dCos[m]; 
+      imQ[m*9+k] += dWk[k]*dSin[m]; 
      } 
     }
     // Calculate S_{p,k} for this event (Remark: final calculation of S_{p,k} follows after the loop over data bellow):
-    for(Int_t p=0;p<8;p++)
-    {
-     for(Int_t k=0;k<9;k++)
-     {     
-      (*fSpk)(p,k)+=pow(wPhi*wPt*wEta*wTrack,k);
-     }
-    } 
+    for(Int_t k=0;k<9;k++)
+    {     
+     dSumOfWeightPowers[k] += dWk[k];
+    }
     // Differential flow:
-    if(fCalculateDiffFlow || fCalculate2DDiffFlow)
+    // Calculate r_{m*n,k} and s_{p,k} (r_{m,k} is 'p-vector' for RPs), and if RP particle is also POI 
+    // particle q_{m*n,k} and s_{p,k} ('q-vector' and 's' for RPs && POIs):
+    for(Int_t pe=0;pe<3;pe++) // pt, eta or (pt,eta)
     {
-     ptEta[0] = dPt; 
-     ptEta[1] = dEta; 
-     // Calculate r_{m*n,k} and s_{p,k} (r_{m,k} is 'p-vector' for RPs): 
-     for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-     {
-      for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-      {
-       if(fCalculateDiffFlow)
-       {
-        for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-        {
-         fReRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-         fImRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
-         if(m==0) // s_{p,k} does not depend on index m
-         {
-          fs1dEBE[0][pe][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k),1.);
-         } // end of if(m==0) // s_{p,k} does not depend on index m
-        } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
-       } // end of if(fCalculateDiffFlow) 
-       if(fCalculate2DDiffFlow)
-       {
-        fReRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-        fImRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
-        if(m==0) // s_{p,k} does not depend on index m
-        {
-         fs2dEBE[0][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k),1.);
-        } // end of if(m==0) // s_{p,k} does not depend on index m
-       } // end of if(fCalculate2DDiffFlow)
-      } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-     } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-     // Checking if RP particle is also POI particle:      
-     if(aftsTrack->InPOISelection())
-     {
-      // Calculate q_{m*n,k} and s_{p,k} ('q-vector' and 's' for RPs && POIs): 
-      for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-      {
-       for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-       {
-        if(fCalculateDiffFlow)
-        {
-         for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-         {
-          fReRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-          fImRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
-          if(m==0) // s_{p,k} does not depend on index m
-          {
-           fs1dEBE[2][pe][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k),1.);
-          } // end of if(m==0) // s_{p,k} does not depend on index m
-         } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
-        } // end of if(fCalculateDiffFlow) 
-        if(fCalculate2DDiffFlow)
-        {
-         fReRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-         fImRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
-         if(m==0) // s_{p,k} does not depend on index m
-         {
-          fs2dEBE[2][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k),1.);
-         } // end of if(m==0) // s_{p,k} does not depend on index m
-        } // end of if(fCalculate2DDiffFlow)
-       } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-      } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
-     } // end of if(aftsTrack->InPOISelection())  
-    } // end of if(fCalculateDiffFlow || fCalculate2DDiffFlow)         
+     if(binPtEta[pe] < 0){continue;}
+     this->AddToDiffQvectorsEBE(0,pe,binPtEta[pe],dCos,dSin,dWk);
+     if(aftsTrack->InPOISelection()){this->AddToDiffQvectorsEBE(2,pe,binPtEta[pe],dCos,dSin,dWk);}
+    }
    } // end of if(pTrack->InRPSelection())
    if(aftsTrack->InPOISelection())
    {
-    dPhi = aftsTrack->Phi();
-    dPt  = aftsTrack->Pt();
-    dEta = aftsTrack->Eta();
     wPhi = 1.;
     wPt  = 1.;
     wEta = 1.;
@@ -519,28 +481,13 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
     {
      wTrack = aftsTrack->Weight(); 
     }
-    ptEta[0] = dPt;
-    ptEta[1] = dEta;
+    for(Int_t k=1;k<9;k++){dWk[k] = dWk[k-1]*wPhi*wPt*wEta*wTrack;}
     // Calculate p_{m*n,k} ('p-vector' for POIs): 
-    for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+    for(Int_t pe=0;pe<3;pe++) // pt, eta or (pt,eta)
     {
-     for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-     {
-      if(fCalculateDiffFlow)
-      {
-       for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-       {
-        fReRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-        fImRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
-       } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
-      } // end of if(fCalculateDiffFlow) 
-      if(fCalculate2DDiffFlow)
-      {
-       fReRPQ2dEBE[1][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-       fImRPQ2dEBE[1][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
-      } // end of if(fCalculate2DDiffFlow)
-     } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-    } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
+     if(binPtEta[pe] < 0){continue;}
+     this->AddToDiffQvectorsEBE(1,pe,binPtEta[pe],dCos,dSin,dWk);
+    }
    } // end of if(pTrack->InPOISelection())    
   } else // to if(aftsTrack)
     {
@@ -548,12 +495,15 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
     }
  } // end of for(Int_t i=0;i<nPrim;i++) 
 
+ // Copy differential Q-vectors into e-b-e profiles:
+ if(fCalculateDiffFlow || fCalculate2DDiffFlow){this->CopyDiffQvectorsEBE();}
+
  // e) Calculate the final expressions for S_{p,k} and s_{p,k} (important !!!!):
  for(Int_t p=0;p<8;p++)
  {
   for(Int_t k=0;k<9;k++)
   {
-   (*fSpk)(p,k)=pow((*fSpk)(p,k),p+1);
+   (*fSpk)(p,k)=pow(dSumOfWeightPowers[k],p+1);
    // ... for the time being s_{p,k} dosn't need higher powers, so no need to finalize it here ...
   } // end of for(Int_t k=0;k<9;k++)  
  } // end of for(Int_t p=0;p<8;p++)
@@ -20986,6 +20936,105 @@ void AliFlowAnalysisWithQCumulants::FillControlHistograms(AliFlowEventSimple *an
 
 //=======================================================================================================================
 
+void AliFlowAnalysisWithQCumulants::AddToDiffQvectorsEBE(Int_t t, Int_t pe, Int_t bin, const Double_t *dCos, const Double_t *dSin, const Double_t *dWk)
+{
+ // Add one particle to r_{m*n,k}, p_{m*n,k} or q_{m*n,k} and s_{1,k} in bin 'bin' of flat e-b-e arrays:
+ //  t  = 0 (r), 1 (p), 2 (q); pe = 0 (pt), 1 (eta), 2 (pt,eta) 
+ //  dCos[m] = cos((m+1)*n*phi), dSin[m] = sin((m+1)*n*phi), dWk[k] = w^k
+ // Per bin there are fgkDiffQvectorsStride entries: Re[m][k], Im[m][k] (m = 0,...,3, k = 0,...,8) and s[k].
+ 
+ std::vector<Double_t> &qv = fDiffQvectorsEBE[t][pe];
+ std::vector<Int_t> &entries = fDiffQvectorsEntriesEBE[t][pe];
+ if(qv.empty()) // allocated only once, with the binning of e-b-e profiles
+ {
+  Int_t nCells = (2==pe) ? fReRPQ2dEBE[0][0][0]->GetNcells() : fReRPQ1dEBE[0][pe][0][0]->GetNcells();
+  qv.assign(nCells*fgkDiffQvectorsStride,0.);
+  entries.assign(nCells,0);
+ }
+ if(bin >= (Int_t)entries.size()){return;} 
+ 
+ if(0==entries[bin]){fDiffQvectorsFilledBinsEBE[t][pe].push_back(bin);}
+ entries[bin]++;
+ Double_t *q = &qv[bin*fgkDiffQvectorsStride];
+ for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
+ {
+  for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+  {
+   q[m*9+k] += dWk[k]*dCos[m];
+   q[36+m*9+k] += dWk[k]*dSin[m];
+  }
+ }
+ for(Int_t k=0;k<9;k++)
+ {
+  q[72+k] += dWk[k];
+ }
+
+} // end of void AliFlowAnalysisWithQCumulants::AddToDiffQvectorsEBE(Int_t t, Int_t pe, Int_t bin, const Double_t *dCos, const Double_t *dSin, const Double_t *dWk)
+
+//=======================================================================================================================
+
+void AliFlowAnalysisWithQCumulants::CopyDiffQvectorsEBE()
+{
+ // Copy the flat e-b-e differential Q-vectors into fReRPQ1dEBE, fImRPQ1dEBE, fs1dEBE, fReRPQ2dEBE, fImRPQ2dEBE
+ // and fs2dEBE, and zero them for the next event. Only the filled bins are visited. The profiles end up with 
+ // the same bin contents and entries as if they were filled particle by particle with unit weights, which is
+ // all that is used from them (sum = GetBinContent*GetBinEntries, multiplicity = GetBinEntries). 
+ // Remark: as before, s_{1,k} is not filled for POIs (t = 1).
+
+ for(Int_t t=0;t<3;t++) // typeFlag (0 = RP, 1 = POI, 2 = RP && POI )
+ {
+  for(Int_t pe=0;pe<3;pe++) // pt, eta or (pt,eta)
+  {
+   std::vector<Int_t> &filledBins = fDiffQvectorsFilledBinsEBE[t][pe];
+   for(UInt_t b=0;b<filledBins.size();b++)
+   {
+    Int_t bin = filledBins[b];
+    Double_t nEntries = fDiffQvectorsEntriesEBE[t][pe][bin];
+    Double_t *q = &fDiffQvectorsEBE[t][pe][bin*fgkDiffQvectorsStride];
+    for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
+    {
+     for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+     {
+      if(2==pe)
+      {
+       fReRPQ2dEBE[t][m][k]->SetBinContent(bin,q[m*9+k]);
+       fReRPQ2dEBE[t][m][k]->SetBinEntries(bin,nEntries);
+       fImRPQ2dEBE[t][m][k]->SetBinContent(bin,q[36+m*9+k]);
+       fImRPQ2dEBE[t][m][k]->SetBinEntries(bin,nEntries);
+      } else
+        {
+         fReRPQ1dEBE[t][pe][m][k]->SetBinContent(bin,q[m*9+k]);
+         fReRPQ1dEBE[t][pe][m][k]->SetBinEntries(bin,nEntries);
+         fImRPQ1dEBE[t][pe][m][k]->SetBinContent(bin,q[36+m*9+k]);
+         fImRPQ1dEBE[t][pe][m][k]->SetBinEntries(bin,nEntries);
+        }
+     } // end of for(Int_t k=0;k<9;k++)
+    } // end of for(Int_t m=0;m<4;m++)
+    for(Int_t k=0;k<9;k++)
+    {
+     if(1==t){break;} 
+     if(2==pe)
+     {
+      fs2dEBE[t][k]->SetBinContent(bin,q[72+k]);
+      fs2dEBE[t][k]->SetBinEntries(bin,nEntries);
+     } else
+       {
+        fs1dEBE[t][pe][k]->SetBinContent(bin,q[72+k]);
+        fs1dEBE[t][pe][k]->SetBinEntries(bin,nEntries);
+       }
+    } // end of for(Int_t k=0;k<9;k++)
+    // Ready for next event:
+    for(Int_t i=0;i<fgkDiffQvectorsStride;i++){q[i] = 0.;}
+    fDiffQvectorsEntriesEBE[t][pe][bin] = 0;
+   } // end of for(UInt_t b=0;b<filledBins.size();b++)
+   filledBins.clear();
+  } // end of for(Int_t pe=0;pe<3;pe++)
+ } // end of for(Int_t t=0;t<3;t++)
+
+} // end of void AliFlowAnalysisWithQCumulants::CopyDiffQvectorsEBE()
+
+//=======================================================================================================================
+
 void AliFlowAnalysisWithQCumulants::ResetEventByEventQuantities()
 {
  // Reset all event by event quantities.
@@ -14,6 +14,7 @@
 #ifndef ALIFLOWANALYSISWITHQCUMULANTS_H
 #define ALIFLOWANALYSISWITHQCUMULANTS_H
 
+#include <vector>
 #include "TMatrixD.h"
 #include "TH2D.h"
 #include "TRandom3.h"
@@ -82,6 +83,8 @@ class AliFlowAnalysisWithQCumulants{
     virtual void FillCommonControlHistograms(AliFlowEventSimple *anEvent);
     virtual void FillControlHistograms(AliFlowEventSimple *anEvent);
     virtual void ResetEventByEventQuantities();
+    virtual void AddToDiffQvectorsEBE(Int_t t, Int_t pe, Int_t bin, const Double_t *dCos, const Double_t *dSin, const Double_t *dWk);
+    virtual void CopyDiffQvectorsEBE();
     // 2b.) Reference flow:
     virtual void CalculateIntFlowCorrelations(); 
     virtual void CalculateIntFlowCorrelationsUsingParticleWeights();
@@ -720,6 +723,11 @@ class AliFlowAnalysisWithQCumulants{
   TProfile2D *fReRPQ2dEBE[3][4][9]; // real part of r_{m*n,k}(pt,eta), p_{m*n,k}(pt,eta) and q_{m*n,k}(pt,eta)
   TProfile2D *fImRPQ2dEBE[3][4][9]; // imaginary part of r_{m*n,k}(pt,eta), p_{m*n,k}(pt,eta) and q_{m*n,k}(pt,eta)
   TProfile2D *fs2dEBE[3][9]; //! [t][k] // to be improved
+  //   flat storage, filled in one pass per track and copied into the profiles above after the loop over data:
+  static const Int_t fgkDiffQvectorsStride = 81; // entries per bin: Re[m][k], Im[m][k], s[k] (m = 0,...,3, k = 0,...,8)
+  std::vector<Double_t> fDiffQvectorsEBE[3][3]; //! [0=r,1=p,2=q][0=pt,1=eta,2=(pt,eta)][bin*fgkDiffQvectorsStride+...]
+  std::vector<Int_t> fDiffQvectorsEntriesEBE[3][3]; //! [0=r,1=p,2=q][0=pt,1=eta,2=(pt,eta)][bin] number of particles
+  std::vector<Int_t> fDiffQvectorsFilledBinsEBE[3][3]; //! [0=r,1=p,2=q][0=pt,1=eta,2=(pt,eta)] bins filled in current event
   //  4d.) profiles:
   //   1D:
   TProfile *fDiffFlowCorrelationsPro[2][2][4]; //! [0=RP,1=POI][0=pt,1=eta][correlation index]
@@ -847,7 +855,7 @@ class AliFlowAnalysisWithQCumulants{
   TH2D *fBootstrapCumulants; // x-axis => QC{2}, QC{4}, QC{6}, QC{8}; y-axis => subsample # 
   TH2D *fBootstrapCumulantsVsM[4]; // index => QC{2}, QC{4}, QC{6}, QC{8}; x-axis => multiplicity; y-axis => subsample # 
 
-  ClassDef(AliFlowAnalysisWithQCumulants, 4);
+  ClassDef(AliFlowAnalysisWithQCumulants, 5);
 
 };
 
@@ -0,0 +1,263 @@
+/*************************************************************************
+* Copyright(c) 1998-2008, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  *
+**************************************************************************/
+
+ /************************************
+ * generic multi-particle correlators *
+ * from flat Q-vector components      *
+ ************************************/
+
+#include <algorithm>
+#include "AliFlowMultiparticleCorrelator.h"
+#include "TError.h"
+#include "TMath.h"
+
+//================================================================================================================
+
+ClassImp(AliFlowMultiparticleCorrelator)
+
+AliFlowMultiparticleCorrelator::AliFlowMultiparticleCorrelator():
+ fMaxHarmonic(0),
+ fMaxPower(0),
+ fNPowers(1),
+ fQRe(),
+ fQIm(),
+ fCacheKey(),
+ fCacheTag(),
+ fCacheStamp(),
+ fCacheRe(),
+ fCacheIm(),
+ fStamp(1)
+ {
+  // Default constructor, Init() shall be called before use.
+
+ } // AliFlowMultiparticleCorrelator::AliFlowMultiparticleCorrelator()
+
+//================================================================================================================
+
+AliFlowMultiparticleCorrelator::AliFlowMultiparticleCorrelator(Int_t maxHarmonic, Int_t maxPower):
+ fMaxHarmonic(0),
+ fMaxPower(0),
+ fNPowers(1),
+ fQRe(),
+ fQIm(),
+ fCacheKey(),
+ fCacheTag(),
+ fCacheStamp(),
+ fCacheRe(),
+ fCacheIm(),
+ fStamp(1)
+ {
+  // Constructor.
+
+  this->Init(maxHarmonic,maxPower);
+
+ } // AliFlowMultiparticleCorrelator::AliFlowMultiparticleCorrelator(Int_t maxHarmonic, Int_t maxPower)
+
+//================================================================================================================
+
+AliFlowMultiparticleCorrelator::~AliFlowMultiparticleCorrelator()
+{
+ // Destructor.
+
+} // AliFlowMultiparticleCorrelator::~AliFlowMultiparticleCorrelator()
+
+//================================================================================================================
+
+void AliFlowMultiparticleCorrelator::Init(Int_t maxHarmonic, Int_t maxPower)
+{
+ // Allocate Q-vector components and the cache. maxHarmonic shall be at least the sum of the absolute
+ // values of the harmonics of the correlators to be evaluated, and maxPower at least their order.
+
+ const char *sMethodName = "AliFlowMultiparticleCorrelator::Init(Int_t maxHarmonic, Int_t maxPower)";
+ if(maxHarmonic<0 || maxHarmonic>127){Fatal(sMethodName,"maxHarmonic = %d, harmonics are cached on 8 bits",maxHarmonic);}
+ if(maxPower<1 || maxPower>kMaxOrder){Fatal(sMethodName,"maxPower = %d, not supporting corr. beyond %dp",maxPower,(Int_t)kMaxOrder);}
+
+ fMaxHarmonic = maxHarmonic;
+ fMaxPower = maxPower;
+ fNPowers = maxPower+1;
+ fQRe.assign((fMaxHarmonic+1)*fNPowers,0.);
+ fQIm.assign((fMaxHarmonic+1)*fNPowers,0.);
+
+ const Int_t nSlots = 1<<kCacheBits;
+ fCacheKey.assign(nSlots,0);
+ fCacheTag.assign(nSlots,0);
+ fCacheStamp.assign(nSlots,0);
+ fCacheRe.assign(nSlots,0.);
+ fCacheIm.assign(nSlots,0.);
+ fStamp = 1;
+
+} // void AliFlowMultiparticleCorrelator::Init(Int_t maxHarmonic, Int_t maxPower)
+
+//================================================================================================================
+
+void AliFlowMultiparticleCorrelator::Reset()
+{
+ // Zero Q-vector components and invalidate cached sub-correlators.
+
+ std::fill(fQRe.begin(),fQRe.end(),0.);
+ std::fill(fQIm.begin(),fQIm.end(),0.);
+ this->ClearCache();
+
+} // void AliFlowMultiparticleCorrelator::Reset()
+
+//================================================================================================================
+
+void AliFlowMultiparticleCorrelator::ClearCache()
+{
+ // Entries stamped with an older event are considered empty.
+
+ fStamp++;
+ if(0==fStamp) // wrapped around
+ {
+  std::fill(fCacheStamp.begin(),fCacheStamp.end(),0);
+  fStamp = 1;
+ }
+
+} // void AliFlowMultiparticleCorrelator::ClearCache()
+
+//================================================================================================================
+
+void AliFlowMultiparticleCorrelator::Fill(Double_t phi, Double_t weight)
+{
+ // Add particle with azimuthal angle phi and weight w to Q_{n,p} += w^p exp(i n phi).
+ // exp(i n phi) is obtained by successive multiplications, w^p likewise, so that only one
+ // cos and sin are evaluated per particle instead of one per (n,p).
+
+ const Double_t c1 = TMath::Cos(phi);
+ const Double_t s1 = TMath::Sin(phi);
+ Double_t wToPowerP[kMaxOrder+1] = {1.};
+ for(Int_t wp=1;wp<fNPowers;wp++){wToPowerP[wp] = wToPowerP[wp-1]*weight;}
+
+ Double_t cn = 1., sn = 0.; // cos(n phi), sin(n phi)
+ Double_t *qRe = &fQRe[0];
+ Double_t *qIm = &fQIm[0];
+ for(Int_t h=0;h<=fMaxHarmonic;h++)
+ {
+  for(Int_t wp=0;wp<fNPowers;wp++)
+  {
+   qRe[wp] += wToPowerP[wp]*cn;
+   qIm[wp] += wToPowerP[wp]*sn;
+  }
+  qRe += fNPowers;
+  qIm += fNPowers;
+  const Double_t cnp1 = cn*c1-sn*s1;
+  sn = sn*c1+cn*s1;
+  cn = cnp1;
+ } // for(Int_t h=0;h<=fMaxHarmonic;h++)
+
+} // void AliFlowMultiparticleCorrelator::Fill(Double_t phi, Double_t weight)
+
+//================================================================================================================
+
+std::complex<Double_t> AliFlowMultiparticleCorrelator::Correlator(Int_t n, const Int_t *harmonics)
+{
+ // Sum over all distinct n-tuples of w_1...w_n exp(i(h_1 phi_1+...+h_n phi_n)). Divided by
+ // NumberOfCombinations(n) this is the event average of the n-particle correlator.
+
+ const char *sMethodName = "AliFlowMultiparticleCorrelator::Correlator(Int_t n, const Int_t *harmonics)";
+ if(n<1 || n>fMaxPower){Fatal(sMethodName,"n = %d, Q-vector components go up to power %d",n,fMaxPower);}
+
+ Int_t harmonic[kMaxOrder];
+ Int_t sumAbs = 0;
+ for(Int_t i=0;i<n;i++)
+ {
+  harmonic[i] = harmonics[i];
+  sumAbs += TMath::Abs(harmonics[i]);
+ }
+ if(sumAbs>fMaxHarmonic){Fatal(sMethodName,"sum of |harmonics| = %d, Q-vector components go up to harmonic %d",sumAbs,fMaxHarmonic);}
+
+ return this->Recursion(n,harmonic);
+
+} // std::complex<Double_t> AliFlowMultiparticleCorrelator::Correlator(Int_t n, const Int_t *harmonics)
+
+//================================================================================================================
+
+Double_t AliFlowMultiparticleCorrelator::NumberOfCombinations(Int_t n)
+{
+ // Weighted number of distinct n-tuples (denominator of the n-particle correlator).
+
+ const Int_t zeros[kMaxOrder] = {0};
+ return this->Correlator(n,zeros).real();
+
+} // Double_t AliFlowMultiparticleCorrelator::NumberOfCombinations(Int_t n)
+
+//================================================================================================================
+
+std::complex<Double_t> AliFlowMultiparticleCorrelator::Recursion(Int_t n, Int_t *harmonic, Int_t mult, Int_t skip)
+{
+ // Same recursion as AliFlowAnalysisWithMultiparticleCorrelations::Recursion (credits: Kristjan
+ // Gulbrandsen), the result only depends on n, harmonic[0..n-1], mult and skip, so it is memoized.
+
+ Int_t slot = -1;
+ ULong64_t key = 0;
+ UInt_t tag = 0;
+ if(n>=kMinCachedOrder)
+ {
+  for(Int_t i=0;i<n;i++){key |= (ULong64_t)(UChar_t)(Char_t)harmonic[i] << (8*i);}
+  tag = (UInt_t)n | (UInt_t)mult<<4 | (UInt_t)skip<<8;
+  ULong64_t hash = (key ^ ((ULong64_t)tag<<52 | (ULong64_t)tag)) * 0x9E3779B97F4A7C15ULL;
+  const UInt_t first = (UInt_t)(hash >> (64-kCacheBits));
+  for(Int_t probe=0;probe<kMaxProbes;probe++)
+  {
+   const UInt_t s = (first+probe) & ((1u<<kCacheBits)-1);
+   if(fCacheStamp[s]!=fStamp){slot = s; break;} // empty, no deletions, so the entry is not further
+   if(fCacheKey[s]==key && fCacheTag[s]==tag){return std::complex<Double_t>(fCacheRe[s],fCacheIm[s]);}
+  }
+ } // if(n>=kMinCachedOrder)
+
+ Int_t nm1 = n-1;
+ std::complex<Double_t> c(Q(harmonic[nm1],mult));
+ if(nm1 == 0) return c;
+ c *= Recursion(nm1,harmonic);
+ if(nm1 != skip)
+ {
+  Int_t multp1 = mult+1;
+  Int_t nm2 = n-2;
+  Int_t counter1 = 0;
+  Int_t hhold = harmonic[counter1];
+  harmonic[counter1] = harmonic[nm2];
+  harmonic[nm2] = hhold + harmonic[nm1];
+  std::complex<Double_t> c2(Recursion(nm1,harmonic,multp1,nm2));
+  Int_t counter2 = n-3;
+  while(counter2 >= skip)
+  {
+   harmonic[nm2] = harmonic[counter1];
+   harmonic[counter1] = hhold;
+   ++counter1;
+   hhold = harmonic[counter1];
+   harmonic[counter1] = harmonic[nm2];
+   harmonic[nm2] = hhold + harmonic[nm1];
+   c2 += Recursion(nm1,harmonic,multp1,counter2);
+   --counter2;
+  }
+  harmonic[nm2] = harmonic[counter1];
+  harmonic[counter1] = hhold;
+  c -= Double_t(mult)*c2;
+ } // if(nm1 != skip)
+
+ if(slot>=0)
+ {
+  fCacheKey[slot] = key;
+  fCacheTag[slot] = tag;
+  fCacheStamp[slot] = fStamp;
+  fCacheRe[slot] = c.real();
+  fCacheIm[slot] = c.imag();
+ }
+
+ return c;
+
+} // std::complex<Double_t> AliFlowMultiparticleCorrelator::Recursion(Int_t n, Int_t *harmonic, Int_t mult, Int_t skip)
+
+//================================================================================================================
@@ -0,0 +1,81 @@
+/*
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved.
+ * See cxx source for full Copyright notice
+ * $Id$
+ */
+
+ /************************************
+ * generic multi-particle correlators *
+ * from flat Q-vector components      *
+ ************************************/
+
+#ifndef ALIFLOWMULTIPARTICLECORRELATOR_H
+#define ALIFLOWMULTIPARTICLECORRELATOR_H
+
+#include <vector>
+#include <complex>
+#include "Rtypes.h"
+
+// Evaluates multi-particle correlators of arbitrary order (up to kMaxOrder) and harmonics
+// with the generic recursion of the Generic Framework (improved version by Kristjan Gulbrandsen).
+// Q-vector components Q_{n,p} are kept in a flat array [n][p], n in [0,maxHarmonic] and
+// p in [0,maxPower], and Q_{-n,p} = Q_{n,p}^* is used for negative harmonics.
+// The sub-correlators met in the recursion are memoized in a fixed size hash table, so that
+// different correlators sharing them (all the harmonic combinations of one event) reuse them.
+// The table is invalidated, not cleared, at each event: no memory is allocated after Init().
+
+class AliFlowMultiparticleCorrelator{
+ public:
+  AliFlowMultiparticleCorrelator();
+  AliFlowMultiparticleCorrelator(Int_t maxHarmonic, Int_t maxPower);
+  virtual ~AliFlowMultiparticleCorrelator();
+
+  enum {kMaxOrder = 8};
+
+  virtual void Init(Int_t maxHarmonic, Int_t maxPower);
+  void Reset(); // zero Q-vector components and invalidate cached sub-correlators, once per event
+  void Fill(Double_t phi, Double_t weight = 1.); // add a particle to all Q_{n,p}
+  void SetQ(Int_t n, Int_t p, Double_t re, Double_t im) {fQRe[n*fNPowers+p] = re; fQIm[n*fNPowers+p] = im;}; // n >= 0, does not invalidate the cache
+  void ClearCache(); // invalidate cached sub-correlators after SetQ()
+  Double_t GetQRe(Int_t n, Int_t p) const {return fQRe[n*fNPowers+p];};
+  Double_t GetQIm(Int_t n, Int_t p) const {return fQIm[n*fNPowers+p];};
+  Int_t GetMaxHarmonic() const {return fMaxHarmonic;};
+  Int_t GetMaxPower() const {return fMaxPower;};
+
+  // Sum over all distinct n-tuples of particles of w_1...w_n exp(i(h_1 phi_1+...+h_n phi_n)):
+  std::complex<Double_t> Correlator(Int_t n, const Int_t *harmonics);
+  Double_t NumberOfCombinations(Int_t n); // the same, with all harmonics equal to 0 (real)
+
+ private:
+  AliFlowMultiparticleCorrelator(const AliFlowMultiparticleCorrelator& mc);
+  AliFlowMultiparticleCorrelator& operator=(const AliFlowMultiparticleCorrelator& mc);
+
+  enum {kCacheBits = 14, kMaxProbes = 8, kMinCachedOrder = 3};
+
+  std::complex<Double_t> Q(Int_t n, Int_t p) const
+  {
+   if(n>=0){return std::complex<Double_t>(fQRe[n*fNPowers+p],fQIm[n*fNPowers+p]);}
+   return std::complex<Double_t>(fQRe[-n*fNPowers+p],-fQIm[-n*fNPowers+p]);
+  };
+  std::complex<Double_t> Recursion(Int_t n, Int_t *harmonic, Int_t mult = 1, Int_t skip = 0);
+
+  Int_t fMaxHarmonic;                   // highest harmonic of Q-vector components
+  Int_t fMaxPower;                      // highest weight power of Q-vector components (highest order)
+  Int_t fNPowers;                       // fMaxPower+1, stride of the flat arrays
+  std::vector<Double_t> fQRe;           //! Re[Q_{n,p}], index n*fNPowers+p
+  std::vector<Double_t> fQIm;           //! Im[Q_{n,p}], index n*fNPowers+p
+
+  std::vector<ULong64_t> fCacheKey;     //! harmonics of cached sub-correlators, 8 bits each
+  std::vector<UInt_t> fCacheTag;        //! order, mult and skip of cached sub-correlators
+  std::vector<UInt_t> fCacheStamp;      //! event stamp of cached sub-correlators, older entries are empty
+  std::vector<Double_t> fCacheRe;       //! Re of cached sub-correlators
+  std::vector<Double_t> fCacheIm;       //! Im of cached sub-correlators
+  UInt_t fStamp;                        //! current event stamp
+
+  ClassDef(AliFlowMultiparticleCorrelator,1);
+
+};
+
+//================================================================================================================
+
+#endif
@@ -43,6 +43,7 @@
 #pragma link C++ class AliFlowAnalysisWithMixedHarmonics+;
 #pragma link C++ class AliFlowAnalysisWithNestedLoops+;
 #pragma link C++ class AliFlowOnTheFlyEventGenerator+;
+#pragma link C++ class AliFlowMultiparticleCorrelator+;
 #pragma link C++ class AliFlowAnalysisWithMultiparticleCorrelations+;
 
 #endif
@@ -0,0 +1,223 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//
+// Event pool for event mixing storing the tracks of each event column-wise
+// in a ring buffer of reused slots (see header for details).
+//
+
+#include <algorithm>
+#include "AliBasicParticle.h"
+#include "AliLog.h"
+#include "AliVParticle.h"
+#include "AliEventPoolSoA.h"
+
+ClassImp(AliEventPoolSoA)
+
+//________________________________________________________________________
+AliEventPoolSoA::AliEventPoolSoA() :
+  TObject(),
+  fMaxEvents(-1),
+  fTrackDepth(0),
+  fTargetFraction(1.),
+  fTargetNEvents(0),
+  fMultBins(),
+  fZvtxBins(),
+  fPsiBins(),
+  fBins()
+{
+}
+
+//________________________________________________________________________
+AliEventPoolSoA::AliEventPoolSoA(Int_t maxEvents, Int_t trackDepth, Int_t nMultBins, const Double_t* multBins, Int_t nZvtxBins, const Double_t* zvtxBins, Int_t nPsiBins, const Double_t* psiBins) :
+  TObject(),
+  fMaxEvents(maxEvents),
+  fTrackDepth(trackDepth),
+  fTargetFraction(1.),
+  fTargetNEvents(0),
+  fMultBins(multBins, multBins + nMultBins + 1),
+  fZvtxBins(zvtxBins, zvtxBins + nZvtxBins + 1),
+  fPsiBins(),
+  fBins()
+{
+  // psiBins can be omitted if nPsiBins is 1 (no binning in event-plane angle)
+  if (psiBins)
+    fPsiBins.assign(psiBins, psiBins + nPsiBins + 1);
+  else if (nPsiBins != 1)
+    AliFatal(Form("%d event-plane bins requested, but no bin edges given", nPsiBins));
+
+  fBins.resize(nMultBins * nZvtxBins * nPsiBins);
+}
+
+//________________________________________________________________________
+AliEventPoolSoA::~AliEventPoolSoA()
+{
+}
+
+//________________________________________________________________________
+void AliEventPoolSoA::SetTargetValues(Int_t trackDepth, Double_t fraction, Int_t minNEvents)
+{
+  // A bin is ready for mixing once it holds fraction*trackDepth tracks or minNEvents events
+  fTrackDepth     = trackDepth;
+  fTargetFraction = fraction;
+  fTargetNEvents  = minNEvents;
+}
+
+//________________________________________________________________________
+Int_t AliEventPoolSoA::FindBin(Double_t mult, Double_t zvtx, Double_t psi) const
+{
+  // Index of the pool bin, -1 if outside of the binning
+
+  Int_t iMult = std::upper_bound(fMultBins.begin(), fMultBins.end(), mult) - fMultBins.begin() - 1;
+  Int_t iZvtx = std::upper_bound(fZvtxBins.begin(), fZvtxBins.end(), zvtx) - fZvtxBins.begin() - 1;
+  if (iMult < 0 || iMult >= (Int_t) fMultBins.size() - 1 || iZvtx < 0 || iZvtx >= (Int_t) fZvtxBins.size() - 1)
+    return -1;
+
+  Int_t nPsi = 1;
+  Int_t iPsi = 0;
+  if (!fPsiBins.empty()) {
+    nPsi = fPsiBins.size() - 1;
+    iPsi = std::upper_bound(fPsiBins.begin(), fPsiBins.end(), psi) - fPsiBins.begin() - 1;
+    if (iPsi < 0 || iPsi >= nPsi)
+      return -1;
+  }
+
+  return (iMult * ((Int_t) fZvtxBins.size() - 1) + iZvtx) * nPsi + iPsi;
+}
+
+//________________________________________________________________________
+Bool_t AliEventPoolSoA::IsReady(Int_t bin) const
+{
+  const Bin& b = fBins[bin];
+  return (b.fNTracks >= fTargetFraction * fTrackDepth || b.fNEvents >= fTargetNEvents);
+}
+
+//________________________________________________________________________
+Int_t AliEventPoolSoA::SlotIndex(const Bin& bin, Int_t i) const
+{
+  // Slot of event i, 0 being the most recent event
+  Int_t nSlots = bin.fSlots.size();
+  return (bin.fNewest - i + nSlots) % nSlots;
+}
+
+//________________________________________________________________________
+void AliEventPoolSoA::DropOldest(Bin& bin)
+{
+  Slot& oldest = bin.fSlots[SlotIndex(bin, bin.fNEvents - 1)];
+  bin.fNTracks -= oldest.fNTracks;
+  oldest.fNTracks = 0;
+  bin.fNEvents--;
+}
+
+//________________________________________________________________________
+Int_t AliEventPoolSoA::NewSlot(Bin& bin)
+{
+  // Slot for a new event. The stored events occupy the slots before (and including)
+  // fNewest, so the slot after fNewest is free unless the ring is full, in which case
+  // a slot is inserted. With an event limit the ring never grows beyond fMaxEvents slots,
+  // as the oldest event is dropped before a new one is added to a full bin (see UpdatePool)
+
+  Int_t nSlots = bin.fSlots.size();
+  if (bin.fNEvents == nSlots) {
+    bin.fSlots.insert(bin.fSlots.begin() + (bin.fNewest + 1), Slot());
+    nSlots++;
+  }
+
+  bin.fNewest = (bin.fNewest + 1) % nSlots;
+  bin.fNEvents++;
+  return bin.fNewest;
+}
+
+//________________________________________________________________________
+void AliEventPoolSoA::UpdatePool(Int_t bin, const TObjArray* tracks, Bool_t useRapidity, Double_t minPt, Double_t maxPt)
+{
+  // Copy the tracks into a new slot. As in AliEventPool::UpdatePool, at most the oldest
+  // event is dropped: if the event limit is reached, or if the bin holds more than
+  // fTrackDepth tracks and would still do so without the oldest event
+
+  if (bin < 0 || bin >= (Int_t) fBins.size())
+    return;
+  Bin& b = fBins[bin];
+
+  const Int_t nTracksBefore = b.fNTracks;
+  const Int_t nTracksOldest = (b.fNEvents > 0) ? b.fSlots[SlotIndex(b, b.fNEvents - 1)].fNTracks : 0;
+  const Bool_t eventLimit = (fMaxEvents > 0 && b.fNEvents >= fMaxEvents);
+  if (eventLimit)
+    DropOldest(b);
+
+  Slot& slot = b.fSlots[NewSlot(b)];
+
+  const Int_t nTracks = tracks->GetEntriesFast();
+  slot.fPt.resize(nTracks);
+  slot.fEta.resize(nTracks);
+  slot.fPhi.resize(nTracks);
+  slot.fCharge.resize(nTracks);
+  slot.fID.resize(nTracks);
+  slot.fEventIndex.resize(nTracks);
+
+  Int_t n = 0;
+  for (Int_t i = 0; i < nTracks; i++) {
+    const AliVParticle* particle = (const AliVParticle*) tracks->UncheckedAt(i);
+    const Double_t pt = particle->Pt();
+    if (maxPt - minPt > 0 && (pt < minPt || pt >= maxPt))
+      continue;
+
+    const AliBasicParticle* particleBasic = dynamic_cast<const AliBasicParticle*>(particle);
+    slot.fPt[n]         = pt;
+    slot.fEta[n]        = useRapidity ? particle->Y() : particle->Eta();
+    slot.fPhi[n]        = particle->Phi();
+    slot.fCharge[n]     = particle->Charge();
+    slot.fID[n]         = particle->GetUniqueID();
+    slot.fEventIndex[n] = particleBasic ? particleBasic->GetEventIndex() : 0;
+    n++;
+  }
+  slot.fNTracks = n;
+  b.fNTracks += n;
+
+  if (!eventLimit && nTracksBefore > fTrackDepth && nTracksBefore - nTracksOldest + n > fTrackDepth)
+    DropOldest(b);
+}
+
+//________________________________________________________________________
+Int_t AliEventPoolSoA::GetEvents(Int_t bin, Int_t first, Int_t n, EventView* views) const
+{
+  const Bin& b = fBins[bin];
+  Int_t nViews = 0;
+  for (Int_t i = first; i < first + n && i < b.fNEvents; i++) {
+    const Slot& slot = b.fSlots[SlotIndex(b, i)];
+    EventView& view = views[nViews++];
+    view.fNTracks    = slot.fNTracks;
+    view.fPt         = slot.fPt.data();
+    view.fEta        = slot.fEta.data();
+    view.fPhi        = slot.fPhi.data();
+    view.fCharge     = slot.fCharge.data();
+    view.fID         = slot.fID.data();
+    view.fEventIndex = slot.fEventIndex.data();
+  }
+  return nViews;
+}
+
+//________________________________________________________________________
+void AliEventPoolSoA::Clear(Option_t* /*option*/)
+{
+  // Empty all bins, keeping the allocated slots
+  for (UInt_t i = 0; i < fBins.size(); i++) {
+    Bin& b = fBins[i];
+    for (UInt_t j = 0; j < b.fSlots.size(); j++)
+      b.fSlots[j].fNTracks = 0;
+    b.fNEvents = 0;
+    b.fNTracks = 0;
+  }
+}
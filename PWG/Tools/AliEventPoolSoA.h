@@ -0,0 +1,99 @@
+/**
+ * \file AliEventPoolSoA.h
+ * \brief Declaration of class AliEventPoolSoA
+ *
+ * Event pool for event mixing binned in multiplicity, z-vertex and (optionally)
+ * event-plane angle. Contrary to AliEventPoolManager, the tracks of a stored
+ * event are not cloned into AliBasicParticle objects but copied into the
+ * columns (pt, eta, phi, charge, id, event index) of a slot of a ring buffer.
+ * Slots and their columns are reused once the pool has been filled, so that
+ * updating the pool does not allocate memory.
+ *
+ * Mixed events are handed out as contiguous arrays for several events at once
+ * (GetEvents()), see AliUEHistograms::FillMixedCorrelations for a consumer.
+ *
+ * Events are removed with the same rule as in AliEventPool, so that both pools
+ * mix the same events.
+ */
+#ifndef ALIEVENTPOOLSOA_H
+#define ALIEVENTPOOLSOA_H
+
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <vector>
+#include <TObject.h>
+#include <TObjArray.h>
+
+class AliEventPoolSoA : public TObject {
+public:
+  /// Read-only view of the tracks of one stored event
+  struct EventView {
+    Int_t           fNTracks;     ///< number of tracks
+    const Float_t*  fPt;          ///< pt
+    const Float_t*  fEta;         ///< eta (or rapidity)
+    const Float_t*  fPhi;         ///< phi
+    const Short_t*  fCharge;      ///< charge
+    const UInt_t*   fID;          ///< unique ID of the original track
+    const Long64_t* fEventIndex;  ///< event index of the original track (AliBasicParticle input only)
+  };
+
+  AliEventPoolSoA();
+  AliEventPoolSoA(Int_t maxEvents, Int_t trackDepth, Int_t nMultBins, const Double_t* multBins, Int_t nZvtxBins, const Double_t* zvtxBins, Int_t nPsiBins = 1, const Double_t* psiBins = 0);
+  virtual ~AliEventPoolSoA();
+
+  void       SetTargetValues(Int_t trackDepth, Double_t fraction, Int_t minNEvents);
+
+  Int_t      FindBin(Double_t mult, Double_t zvtx, Double_t psi = 0.) const;
+  Int_t      GetNumberOfBins() const                 { return fBins.size(); }
+  Bool_t     IsReady(Int_t bin) const;
+  Int_t      GetCurrentNEvents(Int_t bin) const      { return fBins[bin].fNEvents; }
+  Int_t      NTracksInPool(Int_t bin) const          { return fBins[bin].fNTracks; }
+
+  // Store the tracks (AliVParticle) of the current event in bin, optionally restricted to [minPt,maxPt)
+  void       UpdatePool(Int_t bin, const TObjArray* tracks, Bool_t useRapidity = kFALSE, Double_t minPt = -1., Double_t maxPt = -1.);
+  // Views of events first..first+n-1 of bin (0 is the most recent one), returns the number of views filled
+  Int_t      GetEvents(Int_t bin, Int_t first, Int_t n, EventView* views) const;
+
+  void       Clear(Option_t* option = "");
+
+private:
+  AliEventPoolSoA(const AliEventPoolSoA&);
+  AliEventPoolSoA& operator=(const AliEventPoolSoA&);
+
+  struct Slot {
+    std::vector<Float_t>  fPt;
+    std::vector<Float_t>  fEta;
+    std::vector<Float_t>  fPhi;
+    std::vector<Short_t>  fCharge;
+    std::vector<UInt_t>   fID;
+    std::vector<Long64_t> fEventIndex;
+    Int_t                 fNTracks;
+    Slot() : fPt(), fEta(), fPhi(), fCharge(), fID(), fEventIndex(), fNTracks(0) {}
+  };
+
+  struct Bin {
+    std::vector<Slot> fSlots;     // ring buffer of stored events
+    Int_t             fNewest;    // slot of the most recent event
+    Int_t             fNEvents;   // number of stored events
+    Int_t             fNTracks;   // number of stored tracks
+    Bin() : fSlots(), fNewest(-1), fNEvents(0), fNTracks(0) {}
+  };
+
+  Int_t       SlotIndex(const Bin& bin, Int_t i) const;
+  Int_t       NewSlot(Bin& bin);
+  void        DropOldest(Bin& bin);
+
+  Int_t                          fMaxEvents;     ///< maximum number of events per bin, -1 for no limit
+  Int_t                          fTrackDepth;    ///< target number of tracks per bin
+  Double_t                       fTargetFraction; ///< pool is ready above this fraction of fTrackDepth
+  Int_t                          fTargetNEvents; ///< pool is ready above this number of events
+  std::vector<Double_t>          fMultBins;      ///< multiplicity bin edges
+  std::vector<Double_t>          fZvtxBins;      ///< z-vertex bin edges
+  std::vector<Double_t>          fPsiBins;       ///< event-plane bin edges
+  std::vector<Bin>               fBins;          //!<! pool bins
+
+  ClassDef(AliEventPoolSoA, 1) // Event pool with column-wise track storage
+};
+
+#endif /* ALIEVENTPOOLSOA_H */
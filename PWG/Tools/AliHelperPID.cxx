@@ -32,6 +32,7 @@
 #include "AliAODMCParticle.h" 
 #include "AliPIDResponse.h"   
 #include "AliPIDCombined.h"   
+#include "AliPIDResponseCache.h"
 #include "AliAnalysisManager.h"
 #include "AliInputEventHandler.h"
 
@@ -44,7 +45,7 @@ const char * kParticleSpeciesName[]={"Pions","Kaons","Protons","Undefined"} ;
 
 ClassImp(AliHelperPID)
 
-AliHelperPID::AliHelperPID() : TNamed("HelperPID", "PID object"),fisMC(0), fPIDType(kNSigmaTPCTOF), fNSigmaPID(3), fBayesCut(0.8), fPIDResponse(0x0), fPIDCombined(0x0),fOutputList(0x0),fRequestTOFPID(1),fRemoveTracksT0Fill(0),fUseExclusiveNSigma(0),fPtTOFPID(.6),fHasTOFPID(0){
+AliHelperPID::AliHelperPID() : TNamed("HelperPID", "PID object"),fisMC(0), fPIDType(kNSigmaTPCTOF), fNSigmaPID(3), fBayesCut(0.8), fPIDResponse(0x0), fPIDCombined(0x0),fOutputList(0x0),fRequestTOFPID(1),fRemoveTracksT0Fill(0),fUseExclusiveNSigma(0),fPtTOFPID(.6),fHasTOFPID(0),fUsePIDCache(0){
 
   // Fixing Leaks 
   Bool_t oldStatus = TH1::AddDirectoryStatus();
@@ -315,9 +316,9 @@ void AliHelperPID::CalculateNSigmas(AliVTrack * trk, Bool_t FIllQAHistos){
   // Compute nsigma for each hypthesis
   AliVParticle *inEvHMain = dynamic_cast<AliVParticle *>(trk);
   // --- TPC
-  Double_t nsigmaTPCkProton = fPIDResponse->NumberOfSigmasTPC(inEvHMain, AliPID::kProton);
-  Double_t nsigmaTPCkKaon   = fPIDResponse->NumberOfSigmasTPC(inEvHMain, AliPID::kKaon); 
-  Double_t nsigmaTPCkPion   = fPIDResponse->NumberOfSigmasTPC(inEvHMain, AliPID::kPion); 
+  Double_t nsigmaTPCkProton = fUsePIDCache ? AliPIDResponseCache::Instance()->NumberOfSigmasTPC(inEvHMain, AliPID::kProton) : fPIDResponse->NumberOfSigmasTPC(inEvHMain, AliPID::kProton);
+  Double_t nsigmaTPCkKaon   = fUsePIDCache ? AliPIDResponseCache::Instance()->NumberOfSigmasTPC(inEvHMain, AliPID::kKaon) : fPIDResponse->NumberOfSigmasTPC(inEvHMain, AliPID::kKaon); 
+  Double_t nsigmaTPCkPion   = fUsePIDCache ? AliPIDResponseCache::Instance()->NumberOfSigmasTPC(inEvHMain, AliPID::kPion) : fPIDResponse->NumberOfSigmasTPC(inEvHMain, AliPID::kPion); 
   // --- TOF
   Double_t nsigmaTOFkProton=999.,nsigmaTOFkKaon=999.,nsigmaTOFkPion=999.;
   Double_t nsigmaTPCTOFkProton=999.,nsigmaTPCTOFkKaon=999.,nsigmaTPCTOFkPion=999.;
@@ -325,9 +326,9 @@ void AliHelperPID::CalculateNSigmas(AliVTrack * trk, Bool_t FIllQAHistos){
   CheckTOF(trk);
   
   if(fHasTOFPID && trk->Pt()>fPtTOFPID){//use TOF information
-    nsigmaTOFkProton = fPIDResponse->NumberOfSigmasTOF(inEvHMain, AliPID::kProton);
-    nsigmaTOFkKaon   = fPIDResponse->NumberOfSigmasTOF(inEvHMain, AliPID::kKaon); 
-    nsigmaTOFkPion   = fPIDResponse->NumberOfSigmasTOF(inEvHMain, AliPID::kPion); 
+    nsigmaTOFkProton = fUsePIDCache ? AliPIDResponseCache::Instance()->NumberOfSigmasTOF(inEvHMain, AliPID::kProton) : fPIDResponse->NumberOfSigmasTOF(inEvHMain, AliPID::kProton);
+    nsigmaTOFkKaon   = fUsePIDCache ? AliPIDResponseCache::Instance()->NumberOfSigmasTOF(inEvHMain, AliPID::kKaon) : fPIDResponse->NumberOfSigmasTOF(inEvHMain, AliPID::kKaon); 
+    nsigmaTOFkPion   = fUsePIDCache ? AliPIDResponseCache::Instance()->NumberOfSigmasTOF(inEvHMain, AliPID::kPion) : fPIDResponse->NumberOfSigmasTOF(inEvHMain, AliPID::kPion); 
     Double_t d2Proton=nsigmaTPCkProton * nsigmaTPCkProton + nsigmaTOFkProton * nsigmaTOFkProton;
     Double_t d2Kaon=nsigmaTPCkKaon * nsigmaTPCkKaon + nsigmaTOFkKaon * nsigmaTOFkKaon;
     Double_t d2Pion=nsigmaTPCkPion * nsigmaTPCkPion + nsigmaTOFkPion * nsigmaTOFkPion;
@@ -604,7 +605,8 @@ void AliHelperPID::CheckTOF(AliVTrack * trk)
   //check if the particle has TOF Matching
   
   //get the PIDResponse
-  if(fPIDResponse->CheckPIDStatus(AliPIDResponse::kTOF,trk)==0)fHasTOFPID=kFALSE;
+  AliPIDResponse::EDetPidStatus statusTOF = fUsePIDCache ? AliPIDResponseCache::Instance()->CheckPIDStatus(AliPIDResponse::kTOF,trk) : fPIDResponse->CheckPIDStatus(AliPIDResponse::kTOF,trk);
+  if(statusTOF==0)fHasTOFPID=kFALSE;
   else fHasTOFPID=kTRUE;
   
   //in addition to TOF status we look at the pt
@@ -87,6 +87,9 @@ class AliHelperPID : public TNamed
   void SetPIDCombined(AliPIDCombined *obj){fPIDCombined=obj;}
   //void SetPIDCombined(AliPIDCombined *obj){Printf("void AliHelperPID::SetPIDCombined(AliPIDCombined *obj) not implemented");}  //FIXME Left for backward compatibility, not the PIDCombined onject is created in the constructor as done in /ANALYSIS/AliAnalysisTaskPIDCombined.cxx (Jul 15th 2014)
   AliPIDCombined *GetPIDCombined(){return fPIDCombined;}
+  //nsigma from the per-event cache shared by all tasks instead of the PID response
+  void SetUsePIDCache(Bool_t use){fUsePIDCache=use;}
+  Bool_t GetUsePIDCache(){return fUsePIDCache;}
   //set cut on beyesian probability
   void SetBayesCut(Double_t cut){fBayesCut=cut;}
   Double_t GetBayesCut(){return fBayesCut;}
@@ -131,11 +134,12 @@ class AliHelperPID : public TNamed
   Bool_t fUseExclusiveNSigma;//if true returns the identity only if no double counting
   Double_t fPtTOFPID; //lower pt bound for the TOF pid
   Bool_t fHasTOFPID;
+  Bool_t fUsePIDCache; // take nsigma and TOF status from AliPIDResponseCache
   
   AliHelperPID(const AliHelperPID&);
   AliHelperPID& operator=(const AliHelperPID&);
   
-  ClassDef(AliHelperPID, 8);
+  ClassDef(AliHelperPID, 9);
   
 };
 #endif
@@ -0,0 +1,187 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//
+// Per-event cache of the PID n-sigma values of AliPIDResponse.
+// The values are stored by track index in one column per (detector, species)
+// and computed for a track at its first request; further requests for the
+// same track in the event are table lookups.
+//
+
+#include <algorithm>
+#include "AliAnalysisManager.h"
+#include "AliInputEventHandler.h"
+#include "AliLog.h"
+#include "AliVEvent.h"
+#include "AliVEventHandler.h"
+#include "AliVTrack.h"
+#include "AliPIDResponseCache.h"
+
+ClassImp(AliPIDResponseCache)
+
+AliPIDResponseCache* AliPIDResponseCache::fgInstance = 0;
+
+namespace {
+  // markers of the entries which have not been requested yet in the current event
+  const Float_t kNSigmaNotCached = -1.e30;
+  const UChar_t kStatusNotCached = 0xFF;
+}
+
+//________________________________________________________________________
+AliPIDResponseCache::AliPIDResponseCache() :
+  TObject(),
+  fPIDResponse(0),
+  fEvent(0),
+  fEntry(-1),
+  fNTracks(0),
+  fTracks(),
+  fTrackIndex(),
+  fNSigma(AliPIDResponse::kNdetectors*AliPID::kSPECIESC),
+  fNSigmaFilled(AliPIDResponse::kNdetectors*AliPID::kSPECIESC, kFALSE),
+  fStatus(AliPIDResponse::kNdetectors),
+  fStatusFilled(AliPIDResponse::kNdetectors, kFALSE)
+{
+}
+
+//________________________________________________________________________
+AliPIDResponseCache::~AliPIDResponseCache()
+{
+  if (fgInstance == this) fgInstance = 0;
+}
+
+//________________________________________________________________________
+AliPIDResponseCache* AliPIDResponseCache::Instance()
+{
+  // Cache shared by all users in the process
+  if (!fgInstance) fgInstance = new AliPIDResponseCache();
+  return fgInstance;
+}
+
+//________________________________________________________________________
+AliPIDResponse* AliPIDResponseCache::GetPIDResponse()
+{
+  if (!fPIDResponse) {
+    AliAnalysisManager* mgr = AliAnalysisManager::GetAnalysisManager();
+    AliInputEventHandler* handler = mgr ? dynamic_cast<AliInputEventHandler*>(mgr->GetInputEventHandler()) : 0;
+    if (handler) fPIDResponse = handler->GetPIDResponse();
+    if (!fPIDResponse) AliFatal("Cannot get PID response");
+  }
+  return fPIDResponse;
+}
+
+//________________________________________________________________________
+void AliPIDResponseCache::NewEvent(const AliVEvent* event)
+{
+  // Register the tracks of the event and invalidate all cached values
+
+  AliAnalysisManager* mgr = AliAnalysisManager::GetAnalysisManager();
+  fEntry   = mgr ? mgr->GetCurrentEntry() : -1;
+  fEvent   = event;
+  fNTracks = event ? event->GetNumberOfTracks() : 0;
+
+  fTracks.resize(fNTracks);
+  fTrackIndex.clear();
+  fTrackIndex.reserve(fNTracks);
+  for (Int_t i = 0; i < fNTracks; i++) {
+    AliVParticle* part = event->GetTrack(i);
+    fTracks[i] = dynamic_cast<const AliVTrack*>(part);
+    if (part) fTrackIndex[part] = i;
+  }
+
+  std::fill(fNSigmaFilled.begin(), fNSigmaFilled.end(), kFALSE);
+  std::fill(fStatusFilled.begin(), fStatusFilled.end(), kFALSE);
+}
+
+//________________________________________________________________________
+void AliPIDResponseCache::Update()
+{
+  // Detect a new event from the analysis manager
+  AliAnalysisManager* mgr = AliAnalysisManager::GetAnalysisManager();
+  if (!mgr) return;
+  AliVEventHandler* handler = mgr->GetInputEventHandler();
+  const AliVEvent* event = handler ? handler->GetEvent() : 0;
+  if (event != fEvent || mgr->GetCurrentEntry() != fEntry) NewEvent(event);
+}
+
+//________________________________________________________________________
+Int_t AliPIDResponseCache::GetTrackIndex(const AliVParticle* track)
+{
+  Update();
+  std::unordered_map<const AliVParticle*, Int_t>::const_iterator it = fTrackIndex.find(track);
+  return it != fTrackIndex.end() ? it->second : -1;
+}
+
+//________________________________________________________________________
+Float_t AliPIDResponseCache::CachedNSigma(Int_t column, Int_t iTrack)
+{
+  // n-sigma of one (detector, species) for track iTrack, computed at the first request in the event
+  if (!fNSigmaFilled[column]) {
+    fNSigma[column].assign(fNTracks, kNSigmaNotCached);
+    fNSigmaFilled[column] = kTRUE;
+  }
+
+  Float_t& value = fNSigma[column][iTrack];
+  if (value == kNSigmaNotCached) {
+    AliPIDResponse::EDetector detector = (AliPIDResponse::EDetector)(column / AliPID::kSPECIESC);
+    AliPID::EParticleType type = (AliPID::EParticleType)(column % AliPID::kSPECIESC);
+    value = fTracks[iTrack] ? GetPIDResponse()->NumberOfSigmas(detector, fTracks[iTrack], type) : -999.;
+  }
+  return value;
+}
+
+//________________________________________________________________________
+AliPIDResponse::EDetPidStatus AliPIDResponseCache::CachedStatus(Int_t detector, Int_t iTrack)
+{
+  if (!fStatusFilled[detector]) {
+    fStatus[detector].assign(fNTracks, kStatusNotCached);
+    fStatusFilled[detector] = kTRUE;
+  }
+
+  UChar_t& status = fStatus[detector][iTrack];
+  if (status == kStatusNotCached)
+    status = fTracks[iTrack] ? GetPIDResponse()->CheckPIDStatus((AliPIDResponse::EDetector)detector, fTracks[iTrack]) : AliPIDResponse::kDetNoSignal;
+  return (AliPIDResponse::EDetPidStatus)status;
+}
+
+//________________________________________________________________________
+Float_t AliPIDResponseCache::NumberOfSigmas(AliPIDResponse::EDetector detector, Int_t iTrack, AliPID::EParticleType type)
+{
+  Update();
+  if (iTrack < 0 || iTrack >= fNTracks) {
+    AliError(Form("Track index %d out of range [0,%d)", iTrack, fNTracks));
+    return -999.;
+  }
+  return CachedNSigma(detector * AliPID::kSPECIESC + type, iTrack);
+}
+
+//________________________________________________________________________
+Float_t AliPIDResponseCache::NumberOfSigmas(AliPIDResponse::EDetector detector, const AliVParticle* track, AliPID::EParticleType type)
+{
+  // Same as AliPIDResponse::NumberOfSigmas. Tracks which do not belong to the current
+  // event (e.g. copies) are evaluated directly
+  Int_t iTrack = GetTrackIndex(track);
+  if (iTrack < 0) return GetPIDResponse()->NumberOfSigmas(detector, track, type);
+
+  return CachedNSigma(detector * AliPID::kSPECIESC + type, iTrack);
+}
+
+//________________________________________________________________________
+AliPIDResponse::EDetPidStatus AliPIDResponseCache::CheckPIDStatus(AliPIDResponse::EDetector detector, const AliVTrack* track)
+{
+  Int_t iTrack = GetTrackIndex(track);
+  if (iTrack < 0) return GetPIDResponse()->CheckPIDStatus(detector, track);
+
+  return CachedStatus(detector, iTrack);
+}
@@ -0,0 +1,80 @@
+/**
+ * \file AliPIDResponseCache.h
+ * \brief Declaration of class AliPIDResponseCache
+ *
+ * Per-event cache of the n-sigma values of AliPIDResponse. The value of a
+ * track for a given detector and species is computed at its first request and
+ * then served from a flat table keyed by the track index, so tracks which are
+ * never asked for (e.g. all but the V0 legs) cost nothing.
+ * The accessors have the same signature as the ones of AliPIDResponse, so cut
+ * classes can switch by replacing the response pointer with the cache.
+ * The instance returned by Instance() is shared by all tasks of a train, so
+ * that the same track is evaluated only once even if several wagons apply PID.
+ */
+#ifndef ALIPIDRESPONSECACHE_H
+#define ALIPIDRESPONSECACHE_H
+
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <unordered_map>
+#include <vector>
+#include <TObject.h>
+#include "AliPID.h"
+#include "AliPIDResponse.h"
+
+class AliVEvent;
+class AliVParticle;
+class AliVTrack;
+
+class AliPIDResponseCache : public TObject {
+public:
+  AliPIDResponseCache();
+  virtual ~AliPIDResponseCache();
+
+  static AliPIDResponseCache* Instance();
+
+  void SetPIDResponse(AliPIDResponse* pidResponse) { fPIDResponse = pidResponse; fEvent = 0; }
+  AliPIDResponse* GetPIDResponse();
+
+  // Start a new event explicitly. Without this call a new event is detected from the
+  // current entry of the analysis manager
+  void NewEvent(const AliVEvent* event);
+
+  Float_t NumberOfSigmas(AliPIDResponse::EDetector detector, const AliVParticle* track, AliPID::EParticleType type);
+  Float_t NumberOfSigmasITS(const AliVParticle* track, AliPID::EParticleType type) { return NumberOfSigmas(AliPIDResponse::kITS, track, type); }
+  Float_t NumberOfSigmasTPC(const AliVParticle* track, AliPID::EParticleType type) { return NumberOfSigmas(AliPIDResponse::kTPC, track, type); }
+  Float_t NumberOfSigmasTRD(const AliVParticle* track, AliPID::EParticleType type) { return NumberOfSigmas(AliPIDResponse::kTRD, track, type); }
+  Float_t NumberOfSigmasTOF(const AliVParticle* track, AliPID::EParticleType type) { return NumberOfSigmas(AliPIDResponse::kTOF, track, type); }
+  AliPIDResponse::EDetPidStatus CheckPIDStatus(AliPIDResponse::EDetector detector, const AliVTrack* track);
+
+  // Direct access by the index of the track in the event
+  Float_t NumberOfSigmas(AliPIDResponse::EDetector detector, Int_t iTrack, AliPID::EParticleType type);
+  Int_t   GetTrackIndex(const AliVParticle* track);
+  Int_t   GetNumberOfTracks() const { return fNTracks; }
+
+private:
+  AliPIDResponseCache(const AliPIDResponseCache&);
+  AliPIDResponseCache& operator=(const AliPIDResponseCache&);
+
+  void Update();
+  Float_t CachedNSigma(Int_t column, Int_t iTrack);
+  AliPIDResponse::EDetPidStatus CachedStatus(Int_t detector, Int_t iTrack);
+
+  AliPIDResponse*                            fPIDResponse;   //!<! PID response used to fill the cache
+  const AliVEvent*                           fEvent;         //!<! event the cache was filled for
+  Long64_t                                   fEntry;         //!<! entry of the analysis manager the cache was filled for
+  Int_t                                      fNTracks;       //!<! number of tracks of the event
+  std::vector<const AliVTrack*>              fTracks;        //!<! tracks of the event, by index
+  std::unordered_map<const AliVParticle*, Int_t> fTrackIndex; //!<! track pointer -> index
+  std::vector<std::vector<Float_t> >         fNSigma;        //!<! n-sigma per (detector, species) column, by track index
+  std::vector<Bool_t>                        fNSigmaFilled;  //!<! column reset for the current event
+  std::vector<std::vector<UChar_t> >         fStatus;        //!<! PID status per detector, by track index
+  std::vector<Bool_t>                        fStatusFilled;  //!<! status reset for the current event
+
+  static AliPIDResponseCache* fgInstance;                    //!<! instance shared by all tasks
+
+  ClassDef(AliPIDResponseCache, 1) // Per-event cache of PID n-sigma values
+};
+
+#endif /* ALIPIDRESPONSECACHE_H */
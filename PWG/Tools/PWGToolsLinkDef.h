@@ -31,6 +31,8 @@
 #pragma link C++ class AliJSONString+;
 #pragma link C++ class AliAnalysisTaskDummy+;
 #pragma link C++ class AliTLorentzVector+;
+#pragma link C++ class AliPIDResponseCache+;
+#pragma link C++ class AliEventPoolSoA+;
 #if ROOT_VERSION_CODE > ROOT_VERSION(6,4,0)
 #pragma link C++ namespace YAML+;
 #pragma link C++ class YAML::Node+;
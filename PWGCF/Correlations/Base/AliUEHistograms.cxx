@@ -579,17 +579,8 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
   if (weight < 0)
     fillpT = kTRUE;
   
-  if (twoTrackEfficiencyCut && !fTwoTrackDistancePt[0])
-  {
-    // do not add this hists to the directory
-    Bool_t oldStatus = TH1::AddDirectoryStatus();
-    TH1::AddDirectory(kFALSE);
-
-    fTwoTrackDistancePt[0] = new TH3F("fTwoTrackDistancePt[0]", ";#Delta#eta;#Delta#varphi^{*}_{min};#Delta p_{T}", 100, -0.15, 0.15, 100, -0.05, 0.05, 20, 0, 10);
-    fTwoTrackDistancePt[1] = (TH3F*) fTwoTrackDistancePt[0]->Clone("fTwoTrackDistancePt[1]");
-
-    TH1::AddDirectory(oldStatus);
-  }
+  if (twoTrackEfficiencyCut)
+    CreateTwoTrackDistanceHists();
 
   // Eta() is extremely time consuming, therefore cache it for the inner loop here:
   TObjArray* input = (mixed) ? mixed : particles;
@@ -604,54 +595,13 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
     if (mixed)
       jMax = mixed->GetEntriesFast();
     
-    TH1* triggerWeighting = 0;
-    if (fWeightPerEvent)
-    {
-      TAxis* axis = fNumberDensityPhi->GetTrackHist(AliUEHist::kToward)->GetGrid(0)->GetGrid()->GetAxis(2);
-      triggerWeighting = new TH1F("triggerWeighting", "", axis->GetNbins(), axis->GetXbins()->GetArray());
-    
-      for (Int_t i=0; i<particles->GetEntriesFast(); i++)
-      {
-	AliVParticle* triggerParticle = (AliVParticle*) particles->UncheckedAt(i);
-	
-	// some optimization
-	Float_t triggerEta = triggerParticle->Eta();
-
-	if (fTriggerRestrictEta > 0 && TMath::Abs(triggerEta) > fTriggerRestrictEta)
-	  continue;
-
-	if (fOnlyOneEtaSide != 0)
-	{
-	  if (fOnlyOneEtaSide * triggerEta < 0)
-	    continue;
-	}
-	
-	if (fTriggerSelectCharge != 0)
-	  if (triggerParticle->Charge() * fTriggerSelectCharge < 0)
-	    continue;
-	
-	triggerWeighting->Fill(triggerParticle->Pt());
-      }
-    }
+    TH1* triggerWeighting = CreateTriggerWeighting(particles);
     
     // identify K, Lambda candidates and flag those particles
     // a TObject bit is used for this
     const UInt_t kResonanceDaughterFlag = 1 << 14;
     if (fRejectResonanceDaughters > 0)
     {
-      Double_t resonanceMass = -1;
-      Double_t massDaughter1 = -1;
-      Double_t massDaughter2 = -1;
-      const Double_t interval = 0.02;
-      
-      switch (fRejectResonanceDaughters)
-      {
-	case 1: resonanceMass = 1.2; massDaughter1 = 0.1396; massDaughter2 = 0.9383; break; // method test
-	case 2: resonanceMass = 0.4976; massDaughter1 = 0.1396; massDaughter2 = massDaughter1; break; // k0
-	case 3: resonanceMass = 1.115; massDaughter1 = 0.1396; massDaughter2 = 0.9383; break; // lambda
-	default: AliFatal(Form("Invalid setting %d", fRejectResonanceDaughters));
-      }
-
       for (Int_t i=0; i<particles->GetEntriesFast(); i++)
 	particles->UncheckedAt(i)->ResetBit(kResonanceDaughterFlag);
       if (mixed)
@@ -693,19 +643,10 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  if (triggerParticle->Charge() * particle->Charge() > 0)
 	    continue;
       
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerParticle->Eta(), triggerParticle->Phi(), particle->Pt(), particle->Eta(), particle->Phi(), massDaughter1, massDaughter2);
-	      
-	  if (TMath::Abs(mass - resonanceMass*resonanceMass) < interval*5)
+	  if (IsResonanceDaughterPair(triggerParticle->Pt(), triggerParticle->Eta(), triggerParticle->Phi(), particle->Pt(), particle->Eta(), particle->Phi()))
 	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerParticle->Eta(), triggerParticle->Phi(), particle->Pt(), particle->Eta(), particle->Phi(), massDaughter1, massDaughter2);
-
-	    if (mass > (resonanceMass-interval)*(resonanceMass-interval) && mass < (resonanceMass+interval)*(resonanceMass+interval))
-	    {
-	      triggerParticle->SetBit(kResonanceDaughterFlag);
-	      particle->SetBit(kResonanceDaughterFlag);
-	      
-// 	      Printf("Flagged %d %d %f", i, j, TMath::Sqrt(mass));
-	    }
+	    triggerParticle->SetBit(kResonanceDaughterFlag);
+	    particle->SetBit(kResonanceDaughterFlag);
 	  }
 	}
       }
@@ -718,25 +659,12 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
       // some optimization
       Float_t triggerEta = triggerParticle->Eta();
       
-      if (fTriggerRestrictEta > 0 && TMath::Abs(triggerEta) > fTriggerRestrictEta)
+      if (!SelectTrigger(triggerEta, triggerParticle->Charge()))
 	continue;
-
-      if (fOnlyOneEtaSide != 0)
-      {
-	if (fOnlyOneEtaSide * triggerEta < 0)
-	  continue;
-      }
-      
-      if (fTriggerSelectCharge != 0)
-	if (triggerParticle->Charge() * fTriggerSelectCharge < 0)
-	  continue;
 	
       if (fRejectResonanceDaughters > 0)
 	if (triggerParticle->TestBit(kResonanceDaughterFlag))
-	{
-// 	  Printf("Skipped i=%d", i);
 	  continue;
-	}
 	
       for (Int_t j=0; j<jMax; j++)
       {
@@ -763,326 +691,552 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
         else if (mixed && triggerParticle->IsEqual(particle))
           continue;
         
-        if (fPtOrder)
-	  if (particle->Pt() >= triggerParticle->Pt())
-	    continue;
-	
-	if (fAssociatedSelectCharge != 0)
-	  if (particle->Charge() * fAssociatedSelectCharge < 0)
-	    continue;
-
-        if (fSelectCharge > 0)
-        {
-          // skip like sign
-          if (fSelectCharge == 1 && particle->Charge() * triggerParticle->Charge() > 0)
-            continue;
-            
-          // skip unlike sign
-          if (fSelectCharge == 2 && particle->Charge() * triggerParticle->Charge() < 0)
-            continue;
-        }
-        
-        if (fOnlyOneAssocEtaSide != 0)
-          if (fOnlyOneAssocEtaSide * eta[j] < 0)
-            continue;
-
-	if (fEtaOrdering)
-	{
-	  if (triggerEta < 0 && eta[j] < triggerEta)
-	    continue;
-	  if (triggerEta > 0 && eta[j] > triggerEta)
-	    continue;
-	}
-
 	if (fRejectResonanceDaughters > 0)
 	  if (particle->TestBit(kResonanceDaughterFlag))
-	  {
-// 	    Printf("Skipped j=%d", j);
 	    continue;
-	  }
 
-	// conversions
-	if (fCutConversionsV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
+	if (RejectPair(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), triggerParticle->Charge(), particle->Pt(), eta[j], particle->Phi(), particle->Charge(), twoTrackEfficiencyCut, bSign, twoTrackEfficiencyCutValue))
+	  continue;
+	
+	if (fillpT)
+	  weight = particle->Pt();
+	
+	FillPair(centrality, zVtx, step, triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), weight, applyEfficiency, triggerWeighting);
+      }
+ 
+      if (firstTime)
+	FillTrigger(centrality, zVtx, step, triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), applyEfficiency, triggerWeighting);
+    }
+    
+    if (triggerWeighting)
+    {
+      delete triggerWeighting;
+      triggerWeighting = 0;
+    }
+  }
+  
+  fCentralityDistribution->Fill(centrality);
+  fCentralityCorrelation->Fill(centrality, particles->GetEntriesFast());
+  FillEvent(centrality, step);
+}
+
+//____________________________________________________________________
+void AliUEHistograms::FillMixedCorrelations(Double_t centrality, Float_t zVtx, AliUEHist::CFStep step, TObjArray* particles, const AliEventPoolSoA::EventView* mixed, Int_t nMixed, Float_t weight, Bool_t firstTime, Bool_t twoTrackEfficiencyCut, Float_t bSign, Float_t twoTrackEfficiencyCutValue, Bool_t applyEfficiency)
+{
+  // fills the fNumberDensityPhi histogram with mixed events
+  //
+  // the trigger particles are taken from particles, the associated particles from the nMixed events
+  // given as column arrays (see AliEventPoolSoA::GetEvents)
+  // the result is the same as calling FillCorrelations for each mixed event (with firstTime only for the first one),
+  // but the associated particles are read from the arrays instead of through AliVParticle objects
+  
+  Bool_t fillpT = kFALSE;
+  if (weight < 0)
+    fillpT = kTRUE;
+  
+  if (twoTrackEfficiencyCut)
+    CreateTwoTrackDistanceHists();
+
+  // trigger properties are read once for all mixed events
+  const Int_t nTriggers = particles->GetEntriesFast();
+  std::vector<Double_t> triggerPt(nTriggers);
+  std::vector<Float_t>  triggerEta(nTriggers);
+  std::vector<Double_t> triggerPhi(nTriggers);
+  std::vector<Short_t>  triggerCharge(nTriggers);
+  std::vector<AliBasicParticle*> triggerBasic(nTriggers);
+  for (Int_t i=0; i<nTriggers; i++)
+  {
+    AliVParticle* triggerParticle = (AliVParticle*) particles->UncheckedAt(i);
+    triggerPt[i]     = triggerParticle->Pt();
+    triggerEta[i]    = triggerParticle->Eta();
+    triggerPhi[i]    = triggerParticle->Phi();
+    triggerCharge[i] = triggerParticle->Charge();
+    triggerBasic[i]  = dynamic_cast<AliBasicParticle*>(triggerParticle);
+    
+    if (fCheckEventNumberInCorrelation && !triggerBasic[i])
+      AliFatal("If fCheckEventNumberInCorrelation is set, particle must be derived from AliBasicParticle");
+  }
+  
+  TH1* triggerWeighting = CreateTriggerWeighting(particles);
+  
+  // flags of the resonance daughter candidates, per mixed event
+  std::vector<Bool_t> triggerFlag;
+  std::vector<Bool_t> associatedFlag;
+  
+  for (Int_t iMixed=0; iMixed<nMixed; iMixed++)
+  {
+    const AliEventPoolSoA::EventView& view = mixed[iMixed];
+    
+    if (fRejectResonanceDaughters > 0)
+    {
+      triggerFlag.assign(nTriggers, kFALSE);
+      associatedFlag.assign(view.fNTracks, kFALSE);
+      
+      for (Int_t i=0; i<nTriggers; i++)
+	for (Int_t j=0; j<view.fNTracks; j++)
 	{
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.510e-3, 0.510e-3);
-	  
-	  if (mass < fCutConversionsV * 5)
+	  // same element, as in FillCorrelations (AliBasicParticle::IsEqual compares the unique ID)
+	  if (fCheckEventNumberInCorrelation)
 	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.510e-3, 0.510e-3);
-	    
-	    fControlConvResoncances->Fill(0.0, mass);
-
-	    if (mass < fCutConversionsV*fCutConversionsV) 
+	    if (triggerBasic[i]->GetEventIndex() == view.fEventIndex[j])
 	      continue;
 	  }
-	}
-	
-	// K0s
-	if (fCutK0sV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
-	{
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
+	  else if (triggerBasic[i] && triggerBasic[i]->GetUniqueID() == view.fID[j])
+	    continue;
 	  
-	  const Float_t kK0smass = 0.4976;
+	  if (triggerCharge[i] * view.fCharge[j] > 0)
+	    continue;
 	  
-	  if (TMath::Abs(mass - kK0smass*kK0smass) < fCutK0sV * 5)
+	  if (IsResonanceDaughterPair(triggerPt[i], triggerEta[i], triggerPhi[i], view.fPt[j], view.fEta[j], view.fPhi[j]))
 	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
-	    
-	    fControlConvResoncances->Fill(1, mass - kK0smass*kK0smass);
-
-	    if (mass > (kK0smass-fCutK0sV)*(kK0smass-fCutK0sV) && mass < (kK0smass+fCutK0sV)*(kK0smass+fCutK0sV))
-	      continue;
+	    triggerFlag[i] = kTRUE;
+	    associatedFlag[j] = kTRUE;
 	  }
 	}
-
-	// Lambda
-	if (fCutLambdaV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
+    }
+    
+    for (Int_t i=0; i<nTriggers; i++)
+    {
+      if (!SelectTrigger(triggerEta[i], triggerCharge[i]))
+	continue;
+      
+      if (fRejectResonanceDaughters > 0 && triggerFlag[i])
+	continue;
+      
+      for (Int_t j=0; j<view.fNTracks; j++)
+      {
+	if (fCheckEventNumberInCorrelation)
 	{
-	  Float_t mass1 = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.9383);
-	  Float_t mass2 = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.9383, 0.1396);
-	  
-	  const Float_t kLambdaMass = 1.115;
+	  if (triggerBasic[i]->GetEventIndex() == view.fEventIndex[j])
+	    continue;
+	}
+	else if (triggerBasic[i] && triggerBasic[i]->GetUniqueID() == view.fID[j])
+	  continue;
+	
+	if (fRejectResonanceDaughters > 0 && associatedFlag[j])
+	  continue;
+	
+	if (RejectPair(triggerPt[i], triggerEta[i], triggerPhi[i], triggerCharge[i], view.fPt[j], view.fEta[j], view.fPhi[j], view.fCharge[j], twoTrackEfficiencyCut, bSign, twoTrackEfficiencyCutValue))
+	  continue;
+	
+	if (fillpT)
+	  weight = view.fPt[j];
+	
+	FillPair(centrality, zVtx, step, triggerPt[i], triggerEta[i], triggerPhi[i], view.fPt[j], view.fEta[j], view.fPhi[j], weight, applyEfficiency, triggerWeighting);
+      }
+      
+      if (firstTime && iMixed == 0)
+	FillTrigger(centrality, zVtx, step, triggerPt[i], triggerEta[i], triggerPhi[i], applyEfficiency, triggerWeighting);
+    }
+  }
+  
+  delete triggerWeighting;
+  
+  // event statistics are filled once per mixed event, as with one FillCorrelations call per event
+  for (Int_t iMixed=0; iMixed<nMixed; iMixed++)
+  {
+    fCentralityDistribution->Fill(centrality);
+    fCentralityCorrelation->Fill(centrality, nTriggers);
+    FillEvent(centrality, step);
+  }
+}
 
-	  if (TMath::Abs(mass1 - kLambdaMass*kLambdaMass) < fCutLambdaV * 5)
-	  {
-	    mass1 = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.9383);
+//____________________________________________________________________
+void AliUEHistograms::CreateTwoTrackDistanceHists()
+{
+  // creates the control histograms of the two-track efficiency cut at first use
+  
+  if (fTwoTrackDistancePt[0])
+    return;
+  
+  // do not add this hists to the directory
+  Bool_t oldStatus = TH1::AddDirectoryStatus();
+  TH1::AddDirectory(kFALSE);
 
-	    fControlConvResoncances->Fill(2, mass1 - kLambdaMass*kLambdaMass);
-	    
-	    if (mass1 > (kLambdaMass-fCutLambdaV)*(kLambdaMass-fCutLambdaV) && mass1 < (kLambdaMass+fCutLambdaV)*(kLambdaMass+fCutLambdaV))
-	      continue;
-	  }
-	  if (TMath::Abs(mass2 - kLambdaMass*kLambdaMass) < fCutLambdaV * 5)
-	  {
-	    mass2 = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.9383, 0.1396);
+  fTwoTrackDistancePt[0] = new TH3F("fTwoTrackDistancePt[0]", ";#Delta#eta;#Delta#varphi^{*}_{min};#Delta p_{T}", 100, -0.15, 0.15, 100, -0.05, 0.05, 20, 0, 10);
+  fTwoTrackDistancePt[1] = (TH3F*) fTwoTrackDistancePt[0]->Clone("fTwoTrackDistancePt[1]");
 
-	    fControlConvResoncances->Fill(2, mass2 - kLambdaMass*kLambdaMass);
+  TH1::AddDirectory(oldStatus);
+}
 
-	    if (mass2 > (kLambdaMass-fCutLambdaV)*(kLambdaMass-fCutLambdaV) && mass2 < (kLambdaMass+fCutLambdaV)*(kLambdaMass+fCutLambdaV))
-	      continue;
-	  }
-	}
+//____________________________________________________________________
+TH1* AliUEHistograms::CreateTriggerWeighting(TObjArray* particles)
+{
+  // number of selected trigger particles per trigger pT bin, 0 if fWeightPerEvent is not set
+  // the histogram is owned by the caller
+  
+  if (!fWeightPerEvent)
+    return 0;
+  
+  TAxis* axis = fNumberDensityPhi->GetTrackHist(AliUEHist::kToward)->GetGrid(0)->GetGrid()->GetAxis(2);
+  TH1* triggerWeighting = new TH1F("triggerWeighting", "", axis->GetNbins(), axis->GetXbins()->GetArray());
 
-        // Phi
-	if (fCutPhiV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
-	{
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.4937, 0.4937);
-	  
-	  const Float_t kPhimass = 1.019;
-	  
-	  if (TMath::Abs(mass - kPhimass*kPhimass) < fCutPhiV * 5)
-	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.4937, 0.4937);
-	    
-	    fControlConvResoncances->Fill(3, mass - kPhimass*kPhimass);
-	    
-	    if (mass > (kPhimass-fCutPhiV)*(kPhimass-fCutPhiV) && mass < (kPhimass+fCutPhiV)*(kPhimass+fCutPhiV))
-	      continue;
-	  }
-	}	
+  for (Int_t i=0; i<particles->GetEntriesFast(); i++)
+  {
+    AliVParticle* triggerParticle = (AliVParticle*) particles->UncheckedAt(i);
+    
+    if (!SelectTrigger(triggerParticle->Eta(), triggerParticle->Charge()))
+      continue;
+    
+    triggerWeighting->Fill(triggerParticle->Pt());
+  }
+  
+  return triggerWeighting;
+}
 
-        // Rho
-	if (fCutRhoV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
-        {
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
-	  
-	  const Float_t kRhomass = 0.770;
-	  
-	  if (TMath::Abs(mass - kRhomass*kRhomass) < fCutRhoV * 5)
-          {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
-	    
-	    fControlConvResoncances->Fill(4, mass - kRhomass*kRhomass);
-	    
-	    if (mass > (kRhomass-fCutRhoV)*(kRhomass-fCutRhoV) && mass < (kRhomass+fCutRhoV)*(kRhomass+fCutRhoV))
-	      continue;
-	  }
-	}
+//____________________________________________________________________
+Bool_t AliUEHistograms::SelectTrigger(Float_t eta, Short_t charge) const
+{
+  // trigger particle selection in eta and charge
+  
+  if (fTriggerRestrictEta > 0 && TMath::Abs(eta) > fTriggerRestrictEta)
+    return kFALSE;
 
-        // User-defined cut
-	if (fCutCustomMass > 0 && fCutCustomFirst > 0 && fCutCustomSecond > 0 && fCutCustomV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
-        {
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), fCutCustomFirst, fCutCustomSecond);
-	  
-	  if (TMath::Abs(mass - fCutCustomMass*fCutCustomMass) < fCutCustomV * 5)
-          {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), fCutCustomFirst, fCutCustomSecond);
-	    
-	    fControlConvResoncances->Fill(5, mass - fCutCustomMass*fCutCustomMass);
-	    
-	    if (mass > (fCutCustomMass-fCutCustomV)*(fCutCustomMass-fCutCustomV) && mass < (fCutCustomMass+fCutCustomV)*(fCutCustomMass+fCutCustomV))
-	      continue;
-	  }
-	}
+  if (fOnlyOneEtaSide != 0)
+  {
+    if (fOnlyOneEtaSide * eta < 0)
+      return kFALSE;
+  }
+  
+  if (fTriggerSelectCharge != 0)
+    if (charge * fTriggerSelectCharge < 0)
+      return kFALSE;
+  
+  return kTRUE;
+}
 
-	if (twoTrackEfficiencyCut)
-	{
-	  // the variables & cuthave been developed by the HBT group 
-	  // see e.g. https://indico.cern.ch/materialDisplay.py?contribId=36&sessionId=6&materialId=slides&confId=142700
-
-	  Float_t phi1 = triggerParticle->Phi();
-	  Float_t pt1 = triggerParticle->Pt();
-	  Float_t charge1 = triggerParticle->Charge();
-	    
-	  Float_t phi2 = particle->Phi();
-	  Float_t pt2 = particle->Pt();
-	  Float_t charge2 = particle->Charge();
-	      
-	  Float_t deta = triggerEta - eta[j];
-	      
-	  // optimization
-	  if (TMath::Abs(deta) < twoTrackEfficiencyCutValue * 2.5 * 3)
-	  {
-	    // check first boundaries to see if is worth to loop and find the minimum
-	    Float_t dphistar1 = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, fTwoTrackCutMinRadius, bSign);
-	    Float_t dphistar2 = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, 2.5, bSign);
-	    
-	    const Float_t kLimit = twoTrackEfficiencyCutValue * 3;
-
-	    Float_t dphistarminabs = 1e5;
-	    Float_t dphistarmin = 1e5;
-	    if (TMath::Abs(dphistar1) < kLimit || TMath::Abs(dphistar2) < kLimit || dphistar1 * dphistar2 < 0)
-	    {
-	      for (Double_t rad=fTwoTrackCutMinRadius; rad<2.51; rad+=0.01) 
-	      {
-		Float_t dphistar = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, rad, bSign);
-
-		Float_t dphistarabs = TMath::Abs(dphistar);
-		
-		if (dphistarabs < dphistarminabs)
-		{
-		  dphistarmin = dphistar;
-		  dphistarminabs = dphistarabs;
-		}
-	      }
-	      
-	      fTwoTrackDistancePt[0]->Fill(deta, dphistarmin, TMath::Abs(pt1 - pt2));
-	      
-	      if (dphistarminabs < twoTrackEfficiencyCutValue && TMath::Abs(deta) < twoTrackEfficiencyCutValue)
-	      {
-// 		Printf("Removed track pair %d %d with %f %f %f %f %f %f %f %f %f", i, j, deta, dphistarminabs, phi1, pt1, charge1, phi2, pt2, charge2, bSign);
-		continue;
-	      }
-
-    	      fTwoTrackDistancePt[1]->Fill(deta, dphistarmin, TMath::Abs(pt1 - pt2));
-	    }
-	  }
-	}
-        
-        Double_t vars[6];
-        vars[0] = triggerEta - eta[j];
-        vars[1] = particle->Pt();
-        vars[2] = triggerParticle->Pt();
-        vars[3] = centrality;
-        vars[4] = triggerParticle->Phi() - particle->Phi();
-        if (vars[4] > 1.5 * TMath::Pi()) 
-          vars[4] -= TMath::TwoPi();
-        if (vars[4] < -0.5 * TMath::Pi())
-          vars[4] += TMath::TwoPi();
-	vars[5] = zVtx;
-	
-	if (fillpT)
-	  weight = particle->Pt();
-	
-	Double_t useWeight = weight;
-	if (applyEfficiency)
-	{
-	  if (fEfficiencyCorrectionAssociated)
-	  {
-	    Int_t effVars[4];
-	    // associated particle
-	    effVars[0] = fEfficiencyCorrectionAssociated->GetAxis(0)->FindBin(eta[j]);
-	    effVars[1] = fEfficiencyCorrectionAssociated->GetAxis(1)->FindBin(vars[1]); //pt
-	    effVars[2] = fEfficiencyCorrectionAssociated->GetAxis(2)->FindBin(vars[3]); //centrality
-	    effVars[3] = fEfficiencyCorrectionAssociated->GetAxis(3)->FindBin(vars[5]); //zVtx
-	    
-	    // 	  Printf("%d %d %d %d %f", effVars[0], effVars[1], effVars[2], effVars[3], fEfficiencyCorrectionAssociated->GetBinContent(effVars));
-	  
-	    useWeight *= fEfficiencyCorrectionAssociated->GetBinContent(effVars);
-	  }
-	  if (fEfficiencyCorrectionTriggers)
-	  {
-	    Int_t effVars[4];
+//____________________________________________________________________
+Bool_t AliUEHistograms::IsResonanceDaughterPair(Double_t pt1, Float_t eta1, Double_t phi1, Double_t pt2, Float_t eta2, Double_t phi2)
+{
+  // checks if the pair is compatible with the decay of the resonance selected by fRejectResonanceDaughters
+  
+  Double_t resonanceMass = -1;
+  Double_t massDaughter1 = -1;
+  Double_t massDaughter2 = -1;
+  const Double_t interval = 0.02;
+  
+  switch (fRejectResonanceDaughters)
+  {
+    case 1: resonanceMass = 1.2; massDaughter1 = 0.1396; massDaughter2 = 0.9383; break; // method test
+    case 2: resonanceMass = 0.4976; massDaughter1 = 0.1396; massDaughter2 = massDaughter1; break; // k0
+    case 3: resonanceMass = 1.115; massDaughter1 = 0.1396; massDaughter2 = 0.9383; break; // lambda
+    default: AliFatal(Form("Invalid setting %d", fRejectResonanceDaughters));
+  }
 
-	    effVars[0] = fEfficiencyCorrectionTriggers->GetAxis(0)->FindBin(triggerEta);
-	    effVars[1] = fEfficiencyCorrectionTriggers->GetAxis(1)->FindBin(vars[2]); //pt
-	    effVars[2] = fEfficiencyCorrectionTriggers->GetAxis(2)->FindBin(vars[3]); //centrality
-	    effVars[3] = fEfficiencyCorrectionTriggers->GetAxis(3)->FindBin(vars[5]); //zVtx
-	    useWeight *= fEfficiencyCorrectionTriggers->GetBinContent(effVars);
-	  }
-	}
+  Float_t mass = GetInvMassSquaredCheap(pt1, eta1, phi1, pt2, eta2, phi2, massDaughter1, massDaughter2);
+      
+  if (TMath::Abs(mass - resonanceMass*resonanceMass) < interval*5)
+  {
+    mass = GetInvMassSquared(pt1, eta1, phi1, pt2, eta2, phi2, massDaughter1, massDaughter2);
 
-	if (fWeightPerEvent)
-	{
-	  Int_t weightBin = triggerWeighting->GetXaxis()->FindBin(vars[2]);
-// 	  Printf("Using weight %f", triggerWeighting->GetBinContent(weightBin));
-	  useWeight /= triggerWeighting->GetBinContent(weightBin);
-	}
+    if (mass > (resonanceMass-interval)*(resonanceMass-interval) && mass < (resonanceMass+interval)*(resonanceMass+interval))
+      return kTRUE;
+  }
+  
+  return kFALSE;
+}
+
+//____________________________________________________________________
+Bool_t AliUEHistograms::RejectPair(Double_t pt1, Float_t eta1, Double_t phi1, Short_t charge1, Double_t pt2, Float_t eta2, Double_t phi2, Short_t charge2, Bool_t twoTrackEfficiencyCut, Float_t bSign, Float_t twoTrackEfficiencyCutValue)
+{
+  // pair selection of FillCorrelations (1: trigger particle, 2: associated particle)
+  // returns kTRUE if the pair is rejected by the ordering, charge, invariant mass or two-track cuts
+  
+  if (fPtOrder)
+    if (pt2 >= pt1)
+      return kTRUE;
+
+  if (fAssociatedSelectCharge != 0)
+    if (charge2 * fAssociatedSelectCharge < 0)
+      return kTRUE;
+
+  if (fSelectCharge > 0)
+  {
+    // skip like sign
+    if (fSelectCharge == 1 && charge2 * charge1 > 0)
+      return kTRUE;
+      
+    // skip unlike sign
+    if (fSelectCharge == 2 && charge2 * charge1 < 0)
+      return kTRUE;
+  }
+  
+  if (fOnlyOneAssocEtaSide != 0)
+    if (fOnlyOneAssocEtaSide * eta2 < 0)
+      return kTRUE;
+
+  if (fEtaOrdering)
+  {
+    if (eta1 < 0 && eta2 < eta1)
+      return kTRUE;
+    if (eta1 > 0 && eta2 > eta1)
+      return kTRUE;
+  }
+
+  // conversions
+  if (fCutConversionsV > 0 && charge2 * charge1 < 0)
+  {
+    Float_t mass = GetInvMassSquaredCheap(pt1, eta1, phi1, pt2, eta2, phi2, 0.510e-3, 0.510e-3);
+    
+    if (mass < fCutConversionsV * 5)
+    {
+      mass = GetInvMassSquared(pt1, eta1, phi1, pt2, eta2, phi2, 0.510e-3, 0.510e-3);
+      
+      fControlConvResoncances->Fill(0.0, mass);
+
+      if (mass < fCutConversionsV*fCutConversionsV) 
+	return kTRUE;
+    }
+  }
+  
+  // K0s
+  if (fCutK0sV > 0 && charge2 * charge1 < 0)
+  {
+    Float_t mass = GetInvMassSquaredCheap(pt1, eta1, phi1, pt2, eta2, phi2, 0.1396, 0.1396);
+    
+    const Float_t kK0smass = 0.4976;
     
-        // fill all in toward region and do not use the other regions
-	fNumberDensityPhi->GetTrackHist(AliUEHist::kToward)->Fill(vars, step, useWeight);
+    if (TMath::Abs(mass - kK0smass*kK0smass) < fCutK0sV * 5)
+    {
+      mass = GetInvMassSquared(pt1, eta1, phi1, pt2, eta2, phi2, 0.1396, 0.1396);
+      
+      fControlConvResoncances->Fill(1, mass - kK0smass*kK0smass);
 
-// 	Printf("%.2f %.2f --> %.2f", triggerEta, eta[j], vars[0]);
-      }
- 
-      if (firstTime)
-      {
-        // once per trigger particle
-        Double_t vars[3];
-        vars[0] = triggerParticle->Pt();
-        vars[1] = centrality;
-	vars[2] = zVtx;
-
-	Double_t useWeight = 1;
-	if (fEfficiencyCorrectionTriggers && applyEfficiency)
-	{
-	  Int_t effVars[4];
-	  
-	  // trigger particle
-	  effVars[0] = fEfficiencyCorrectionTriggers->GetAxis(0)->FindBin(triggerEta);
-	  effVars[1] = fEfficiencyCorrectionTriggers->GetAxis(1)->FindBin(vars[0]); //pt
-	  effVars[2] = fEfficiencyCorrectionTriggers->GetAxis(2)->FindBin(vars[1]); //centrality
-	  effVars[3] = fEfficiencyCorrectionTriggers->GetAxis(3)->FindBin(vars[2]); //zVtx
-	  useWeight *= fEfficiencyCorrectionTriggers->GetBinContent(effVars);
-	}
+      if (mass > (kK0smass-fCutK0sV)*(kK0smass-fCutK0sV) && mass < (kK0smass+fCutK0sV)*(kK0smass+fCutK0sV))
+	return kTRUE;
+    }
+  }
+
+  // Lambda
+  if (fCutLambdaV > 0 && charge2 * charge1 < 0)
+  {
+    Float_t mass1 = GetInvMassSquaredCheap(pt1, eta1, phi1, pt2, eta2, phi2, 0.1396, 0.9383);
+    Float_t mass2 = GetInvMassSquaredCheap(pt1, eta1, phi1, pt2, eta2, phi2, 0.9383, 0.1396);
+    
+    const Float_t kLambdaMass = 1.115;
+
+    if (TMath::Abs(mass1 - kLambdaMass*kLambdaMass) < fCutLambdaV * 5)
+    {
+      mass1 = GetInvMassSquared(pt1, eta1, phi1, pt2, eta2, phi2, 0.1396, 0.9383);
+
+      fControlConvResoncances->Fill(2, mass1 - kLambdaMass*kLambdaMass);
+      
+      if (mass1 > (kLambdaMass-fCutLambdaV)*(kLambdaMass-fCutLambdaV) && mass1 < (kLambdaMass+fCutLambdaV)*(kLambdaMass+fCutLambdaV))
+	return kTRUE;
+    }
+    if (TMath::Abs(mass2 - kLambdaMass*kLambdaMass) < fCutLambdaV * 5)
+    {
+      mass2 = GetInvMassSquared(pt1, eta1, phi1, pt2, eta2, phi2, 0.9383, 0.1396);
+
+      fControlConvResoncances->Fill(2, mass2 - kLambdaMass*kLambdaMass);
+
+      if (mass2 > (kLambdaMass-fCutLambdaV)*(kLambdaMass-fCutLambdaV) && mass2 < (kLambdaMass+fCutLambdaV)*(kLambdaMass+fCutLambdaV))
+	return kTRUE;
+    }
+  }
 
-	if (TMath::Abs(triggerEta) < 0.8 && triggerParticle->Pt() > 0)
-	  fInvYield2->Fill(centrality, triggerParticle->Pt(), useWeight / triggerParticle->Pt());
+  // Phi
+  if (fCutPhiV > 0 && charge2 * charge1 < 0)
+  {
+    Float_t mass = GetInvMassSquaredCheap(pt1, eta1, phi1, pt2, eta2, phi2, 0.4937, 0.4937);
+    
+    const Float_t kPhimass = 1.019;
+    
+    if (TMath::Abs(mass - kPhimass*kPhimass) < fCutPhiV * 5)
+    {
+      mass = GetInvMassSquared(pt1, eta1, phi1, pt2, eta2, phi2, 0.4937, 0.4937);
+      
+      fControlConvResoncances->Fill(3, mass - kPhimass*kPhimass);
+      
+      if (mass > (kPhimass-fCutPhiV)*(kPhimass-fCutPhiV) && mass < (kPhimass+fCutPhiV)*(kPhimass+fCutPhiV))
+	return kTRUE;
+    }
+  }	
+
+  // Rho
+  if (fCutRhoV > 0 && charge2 * charge1 < 0)
+  {
+    Float_t mass = GetInvMassSquaredCheap(pt1, eta1, phi1, pt2, eta2, phi2, 0.1396, 0.1396);
+    
+    const Float_t kRhomass = 0.770;
+    
+    if (TMath::Abs(mass - kRhomass*kRhomass) < fCutRhoV * 5)
+    {
+      mass = GetInvMassSquared(pt1, eta1, phi1, pt2, eta2, phi2, 0.1396, 0.1396);
+      
+      fControlConvResoncances->Fill(4, mass - kRhomass*kRhomass);
+      
+      if (mass > (kRhomass-fCutRhoV)*(kRhomass-fCutRhoV) && mass < (kRhomass+fCutRhoV)*(kRhomass+fCutRhoV))
+	return kTRUE;
+    }
+  }
+
+  // User-defined cut
+  if (fCutCustomMass > 0 && fCutCustomFirst > 0 && fCutCustomSecond > 0 && fCutCustomV > 0 && charge2 * charge1 < 0)
+  {
+    Float_t mass = GetInvMassSquaredCheap(pt1, eta1, phi1, pt2, eta2, phi2, fCutCustomFirst, fCutCustomSecond);
+    
+    if (TMath::Abs(mass - fCutCustomMass*fCutCustomMass) < fCutCustomV * 5)
+    {
+      mass = GetInvMassSquared(pt1, eta1, phi1, pt2, eta2, phi2, fCutCustomFirst, fCutCustomSecond);
+      
+      fControlConvResoncances->Fill(5, mass - fCutCustomMass*fCutCustomMass);
+      
+      if (mass > (fCutCustomMass-fCutCustomV)*(fCutCustomMass-fCutCustomV) && mass < (fCutCustomMass+fCutCustomV)*(fCutCustomMass+fCutCustomV))
+	return kTRUE;
+    }
+  }
+
+  if (twoTrackEfficiencyCut)
+  {
+    // the variables & cuthave been developed by the HBT group 
+    // see e.g. https://indico.cern.ch/materialDisplay.py?contribId=36&sessionId=6&materialId=slides&confId=142700
+
+    Float_t phi1f = phi1;
+    Float_t pt1f = pt1;
+    Float_t charge1f = charge1;
+      
+    Float_t phi2f = phi2;
+    Float_t pt2f = pt2;
+    Float_t charge2f = charge2;
+	
+    Float_t deta = eta1 - eta2;
+	
+    // optimization
+    if (TMath::Abs(deta) < twoTrackEfficiencyCutValue * 2.5 * 3)
+    {
+      // check first boundaries to see if is worth to loop and find the minimum
+      Float_t dphistar1 = GetDPhiStar(phi1f, pt1f, charge1f, phi2f, pt2f, charge2f, fTwoTrackCutMinRadius, bSign);
+      Float_t dphistar2 = GetDPhiStar(phi1f, pt1f, charge1f, phi2f, pt2f, charge2f, 2.5, bSign);
+      
+      const Float_t kLimit = twoTrackEfficiencyCutValue * 3;
 
-	if (fWeightPerEvent)
+      Float_t dphistarminabs = 1e5;
+      Float_t dphistarmin = 1e5;
+      if (TMath::Abs(dphistar1) < kLimit || TMath::Abs(dphistar2) < kLimit || dphistar1 * dphistar2 < 0)
+      {
+	for (Double_t rad=fTwoTrackCutMinRadius; rad<2.51; rad+=0.01) 
 	{
-	  // leads effectively to a filling of one entry per filled trigger particle pT bin
-	  Int_t weightBin = triggerWeighting->GetXaxis()->FindBin(vars[0]);
-// 	  Printf("Using weight %f", triggerWeighting->GetBinContent(weightBin));
-	  useWeight /= triggerWeighting->GetBinContent(weightBin);
+	  Float_t dphistar = GetDPhiStar(phi1f, pt1f, charge1f, phi2f, pt2f, charge2f, rad, bSign);
+
+	  Float_t dphistarabs = TMath::Abs(dphistar);
+	  
+	  if (dphistarabs < dphistarminabs)
+	  {
+	    dphistarmin = dphistar;
+	    dphistarminabs = dphistarabs;
+	  }
 	}
 	
-        fNumberDensityPhi->GetEventHist()->Fill(vars, step, useWeight);
-
-	// QA
-        fCorrelationpT->Fill(centrality, triggerParticle->Pt());
-        fCorrelationEta->Fill(centrality, triggerEta);
-        fCorrelationPhi->Fill(centrality, triggerParticle->Phi());
-	fYields->Fill(centrality, triggerParticle->Pt(), triggerEta);
-	fYieldsEtaPhiPT->Fill(triggerParticle->Pt(), triggerEta, triggerParticle->Phi());
+	fTwoTrackDistancePt[0]->Fill(deta, dphistarmin, TMath::Abs(pt1f - pt2f));
 	
-/*        if (dynamic_cast<AliAODTrack*>(triggerParticle))
-          fITSClusterMap->Fill(((AliAODTrack*) triggerParticle)->GetITSClusterMap(), centrality, triggerParticle->Pt());*/
+	if (dphistarminabs < twoTrackEfficiencyCutValue && TMath::Abs(deta) < twoTrackEfficiencyCutValue)
+	  return kTRUE;
+
+	fTwoTrackDistancePt[1]->Fill(deta, dphistarmin, TMath::Abs(pt1f - pt2f));
       }
     }
+  }
+  
+  return kFALSE;
+}
+
+//____________________________________________________________________
+void AliUEHistograms::FillPair(Double_t centrality, Float_t zVtx, AliUEHist::CFStep step, Double_t triggerPt, Float_t triggerEta, Double_t triggerPhi, Double_t pt, Float_t eta, Double_t phi, Float_t weight, Bool_t applyEfficiency, TH1* triggerWeighting)
+{
+  // fills one accepted pair of trigger and associated particle
+  
+  Double_t vars[6];
+  vars[0] = triggerEta - eta;
+  vars[1] = pt;
+  vars[2] = triggerPt;
+  vars[3] = centrality;
+  vars[4] = triggerPhi - phi;
+  if (vars[4] > 1.5 * TMath::Pi()) 
+    vars[4] -= TMath::TwoPi();
+  if (vars[4] < -0.5 * TMath::Pi())
+    vars[4] += TMath::TwoPi();
+  vars[5] = zVtx;
+  
+  Double_t useWeight = weight;
+  if (applyEfficiency)
+  {
+    if (fEfficiencyCorrectionAssociated)
+    {
+      Int_t effVars[4];
+      // associated particle
+      effVars[0] = fEfficiencyCorrectionAssociated->GetAxis(0)->FindBin(eta);
+      effVars[1] = fEfficiencyCorrectionAssociated->GetAxis(1)->FindBin(vars[1]); //pt
+      effVars[2] = fEfficiencyCorrectionAssociated->GetAxis(2)->FindBin(vars[3]); //centrality
+      effVars[3] = fEfficiencyCorrectionAssociated->GetAxis(3)->FindBin(vars[5]); //zVtx
     
-    if (triggerWeighting)
+      useWeight *= fEfficiencyCorrectionAssociated->GetBinContent(effVars);
+    }
+    if (fEfficiencyCorrectionTriggers)
     {
-      delete triggerWeighting;
-      triggerWeighting = 0;
+      Int_t effVars[4];
+
+      effVars[0] = fEfficiencyCorrectionTriggers->GetAxis(0)->FindBin(triggerEta);
+      effVars[1] = fEfficiencyCorrectionTriggers->GetAxis(1)->FindBin(vars[2]); //pt
+      effVars[2] = fEfficiencyCorrectionTriggers->GetAxis(2)->FindBin(vars[3]); //centrality
+      effVars[3] = fEfficiencyCorrectionTriggers->GetAxis(3)->FindBin(vars[5]); //zVtx
+      useWeight *= fEfficiencyCorrectionTriggers->GetBinContent(effVars);
     }
   }
-  
-  fCentralityDistribution->Fill(centrality);
-  fCentralityCorrelation->Fill(centrality, particles->GetEntriesFast());
-  FillEvent(centrality, step);
+
+  if (triggerWeighting)
+  {
+    Int_t weightBin = triggerWeighting->GetXaxis()->FindBin(vars[2]);
+    useWeight /= triggerWeighting->GetBinContent(weightBin);
+  }
+
+  // fill all in toward region and do not use the other regions
+  fNumberDensityPhi->GetTrackHist(AliUEHist::kToward)->Fill(vars, step, useWeight);
 }
+
+//____________________________________________________________________
+void AliUEHistograms::FillTrigger(Double_t centrality, Float_t zVtx, AliUEHist::CFStep step, Double_t pt, Float_t eta, Double_t phi, Bool_t applyEfficiency, TH1* triggerWeighting)
+{
+  // fills the trigger particle histograms, once per trigger particle
   
+  Double_t vars[3];
+  vars[0] = pt;
+  vars[1] = centrality;
+  vars[2] = zVtx;
+
+  Double_t useWeight = 1;
+  if (fEfficiencyCorrectionTriggers && applyEfficiency)
+  {
+    Int_t effVars[4];
+    
+    // trigger particle
+    effVars[0] = fEfficiencyCorrectionTriggers->GetAxis(0)->FindBin(eta);
+    effVars[1] = fEfficiencyCorrectionTriggers->GetAxis(1)->FindBin(vars[0]); //pt
+    effVars[2] = fEfficiencyCorrectionTriggers->GetAxis(2)->FindBin(vars[1]); //centrality
+    effVars[3] = fEfficiencyCorrectionTriggers->GetAxis(3)->FindBin(vars[2]); //zVtx
+    useWeight *= fEfficiencyCorrectionTriggers->GetBinContent(effVars);
+  }
+
+  if (TMath::Abs(eta) < 0.8 && pt > 0)
+    fInvYield2->Fill(centrality, pt, useWeight / pt);
+
+  if (triggerWeighting)
+  {
+    // leads effectively to a filling of one entry per filled trigger particle pT bin
+    Int_t weightBin = triggerWeighting->GetXaxis()->FindBin(vars[0]);
+    useWeight /= triggerWeighting->GetBinContent(weightBin);
+  }
+  
+  fNumberDensityPhi->GetEventHist()->Fill(vars, step, useWeight);
+
+  // QA
+  fCorrelationpT->Fill(centrality, pt);
+  fCorrelationEta->Fill(centrality, eta);
+  fCorrelationPhi->Fill(centrality, phi);
+  fYields->Fill(centrality, pt, eta);
+  fYieldsEtaPhiPT->Fill(pt, eta, phi);
+}
+
 //____________________________________________________________________
 void AliUEHistograms::FillTrackingEfficiency(TObjArray* mc, TObjArray* recoPrim, TObjArray* recoAll, TObjArray* recoPrimPID, TObjArray* recoAllPID, TObjArray* fake, Int_t particleType, Double_t centrality, Double_t zVtx)
 {
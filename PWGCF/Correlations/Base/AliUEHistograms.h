@@ -12,12 +12,14 @@
 #include "AliUEHist.h"
 #include "TMath.h"
 #include "THn.h" // in cxx file causes .../THn.h:257: error: conflicting declaration ‘typedef class THnT<float> THnF’
+#include "AliEventPoolSoA.h"
 
 class AliVParticle;
 
 class TList;
 class TSeqCollection;
 class TObjArray;
+class TH1;
 class TH1F;
 class TH2F;
 class TH3F;
@@ -30,6 +32,7 @@ class AliUEHistograms : public TNamed
   
   void Fill(Int_t eventType, Float_t zVtx, AliUEHist::CFStep step, AliVParticle* leading, TList* toward, TList* away, TList* min, TList* max);
   void FillCorrelations(Double_t centrality, Float_t zVtx, AliUEHist::CFStep step, TObjArray* particles, TObjArray* mixed = 0, Float_t weight = 1, Bool_t firstTime = kTRUE, Bool_t twoTrackEfficiencyCut = kFALSE, Float_t bSign = 0, Float_t twoTrackEfficiencyCutValue = 0.02, Bool_t applyEfficiency = kFALSE);
+  void FillMixedCorrelations(Double_t centrality, Float_t zVtx, AliUEHist::CFStep step, TObjArray* particles, const AliEventPoolSoA::EventView* mixed, Int_t nMixed, Float_t weight = 1, Bool_t firstTime = kTRUE, Bool_t twoTrackEfficiencyCut = kFALSE, Float_t bSign = 0, Float_t twoTrackEfficiencyCutValue = 0.02, Bool_t applyEfficiency = kFALSE);
   void Fill(AliVParticle* leadingMC, AliVParticle* leadingReco);
   void FillEvent(Int_t eventType, Int_t step);
   void FillEvent(Double_t centrality, Int_t step);
@@ -123,6 +126,15 @@ protected:
   inline Float_t GetInvMassSquared(Float_t pt1, Float_t eta1, Float_t phi1, Float_t pt2, Float_t eta2, Float_t phi2, Float_t m0_1, Float_t m0_2);
   inline Float_t GetInvMassSquaredCheap(Float_t pt1, Float_t eta1, Float_t phi1, Float_t pt2, Float_t eta2, Float_t phi2, Float_t m0_1, Float_t m0_2);
   inline Float_t GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign);
+
+  // building blocks of FillCorrelations and FillMixedCorrelations
+  void CreateTwoTrackDistanceHists();
+  TH1* CreateTriggerWeighting(TObjArray* particles);
+  Bool_t SelectTrigger(Float_t eta, Short_t charge) const;
+  Bool_t IsResonanceDaughterPair(Double_t pt1, Float_t eta1, Double_t phi1, Double_t pt2, Float_t eta2, Double_t phi2);
+  Bool_t RejectPair(Double_t pt1, Float_t eta1, Double_t phi1, Short_t charge1, Double_t pt2, Float_t eta2, Double_t phi2, Short_t charge2, Bool_t twoTrackEfficiencyCut, Float_t bSign, Float_t twoTrackEfficiencyCutValue);
+  void FillPair(Double_t centrality, Float_t zVtx, AliUEHist::CFStep step, Double_t triggerPt, Float_t triggerEta, Double_t triggerPhi, Double_t pt, Float_t eta, Double_t phi, Float_t weight, Bool_t applyEfficiency, TH1* triggerWeighting);
+  void FillTrigger(Double_t centrality, Float_t zVtx, AliUEHist::CFStep step, Double_t pt, Float_t eta, Double_t phi, Bool_t applyEfficiency, TH1* triggerWeighting);
   
   static const Int_t fgkUEHists; // number of histograms
 
@@ -55,6 +55,7 @@
 #include "AliGenHepMCEventHeader.h"
 
 #include "AliEventPoolManager.h"
+#include "AliEventPoolSoA.h"
 #include "AliBasicParticle.h"
 #include "AliVHeader.h"
 
@@ -132,6 +133,7 @@ fInputHandler(0x0),
 fMcEvent(0x0),
 fMcHandler(0x0),
 fPoolMgr(0x0),
+fPoolSoA(0x0),
 // histogram settings
 fListOfHistos(0x0), 
 // event QA
@@ -207,7 +209,8 @@ fCustomParticlesA(""),
 fCustomParticlesB(""),
 fEventPoolOutputList(),
 fUsePtBinnedEventPool(0),
-fCheckEventNumberInMixedEvent(kFALSE)
+fCheckEventNumberInMixedEvent(kFALSE),
+fUseSoAEventPool(kFALSE)
 {
   // Default constructor
   // Define input and output slots here
@@ -223,6 +226,8 @@ AliAnalysisTaskPhiCorrelations::~AliAnalysisTaskPhiCorrelations()
   
   if (fListOfHistos  && !AliAnalysisManager::GetAnalysisManager()->IsProofMode()) 
     delete fListOfHistos;
+
+  delete fPoolSoA;
 }
 
 //____________________________________________________________________
@@ -497,6 +502,17 @@ void  AliAnalysisTaskPhiCorrelations::CreateOutputObjects()
       ptbins = (Double_t*) fHistos->GetUEHist(2)->GetTrackHist(AliUEHist::kToward)->GetAxis(1, 0)->GetXbins()->GetArray();
     }
 
+  // Pool with column-wise track storage, the tracks are copied instead of cloned
+  if (fUseSoAEventPool)
+  {
+    if (fPoolMgr || fUsePtBinnedEventPool || fEventPoolOutputList.size())
+      AliFatal("SoA event pool cannot be combined with an external pool manager, pt-binned pools or pool output!");
+
+    fPoolSoA = new AliEventPoolSoA(poolsize, fMixingTracks, nCentralityBins, centralityBins, nZvtxBins, zvtxbin);
+    fPoolSoA->SetTargetValues(fMixingTracks, 0.1, 5);
+    return;
+  }
+
   // Create default event pool in case no external pool is given
   if(!fPoolMgr)
   {
@@ -829,7 +845,26 @@ void  AliAnalysisTaskPhiCorrelations::AnalyseCorrectionMode()
   fHistos->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepAll, tracksMC, tracksCorrelateMC, weight);
   
   // mixed event
-  if (fFillMixed)
+  if (fFillMixed && fPoolSoA)
+  {
+    Int_t bin = fPoolSoA->FindBin(centrality, zVtx);
+    if (bin >= 0)
+    {
+      if (fFillOnlyStep0) {
+        ((TH2F*) fListOfHistos->FindObject("mixedDist"))->Fill(centrality, fPoolSoA->NTracksInPool(bin));
+        ((TH2F*) fListOfHistos->FindObject("mixedDist2"))->Fill(centrality, fPoolSoA->GetCurrentNEvents(bin));
+      }
+      if (fPoolSoA->IsReady(bin))
+      {
+        Int_t nMix = fPoolSoA->GetCurrentNEvents(bin);
+        std::vector<AliEventPoolSoA::EventView> bgEvents(nMix);
+        fPoolSoA->GetEvents(bin, 0, nMix, &bgEvents[0]);
+        fHistosMixed->FillMixedCorrelations(centrality, zVtx, AliUEHist::kCFStepAll, tracksMC, &bgEvents[0], nMix, 1.0 / nMix);
+      }
+      UpdateSoAPool(bin, tracksCorrelateMC);
+    }
+  }
+  else if (fFillMixed)
   {
     for(Int_t iPool=0; iPool<fPoolMgr->GetNumberOfPtBins(); iPool++)
     {
@@ -945,7 +980,22 @@ void  AliAnalysisTaskPhiCorrelations::AnalyseCorrectionMode()
       fHistos->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepTrackedOnlyPrim, tracksRecoMatchedPrim, tracksCorrelateRecoMatchedPrim, weight);
 
       // mixed event
-      if (fFillMixed)
+      if (fFillMixed && fPoolSoA)
+      {
+        Int_t bin = fPoolSoA->FindBin(centrality, zVtx + 200);
+        if (bin >= 0)
+        {
+          if (fPoolSoA->IsReady(bin))
+          {
+            Int_t nMix = fPoolSoA->GetCurrentNEvents(bin);
+            std::vector<AliEventPoolSoA::EventView> bgEvents(nMix);
+            fPoolSoA->GetEvents(bin, 0, nMix, &bgEvents[0]);
+            fHistosMixed->FillMixedCorrelations(centrality, zVtx, AliUEHist::kCFStepTrackedOnlyPrim, tracksRecoMatchedPrim, &bgEvents[0], nMix, 1.0 / nMix);
+          }
+          UpdateSoAPool(bin, tracksCorrelateRecoMatchedPrim);
+        }
+      }
+      else if (fFillMixed)
       {
         for(Int_t iPool=0; iPool<fPoolMgr->GetNumberOfPtBins(); iPool++)
         {
@@ -979,7 +1029,22 @@ void  AliAnalysisTaskPhiCorrelations::AnalyseCorrectionMode()
       fHistos->FillCorrelations(centrality, zVtx, AliUEHist::kCFStepTracked, tracksRecoMatchedAll, tracksCorrelateRecoMatchedAll, weight);
       
       // mixed event
-      if (fFillMixed)
+      if (fFillMixed && fPoolSoA)
+      {
+        Int_t bin = fPoolSoA->FindBin(centrality, zVtx + 300);
+        if (bin >= 0)
+        {
+          if (fPoolSoA->IsReady(bin))
+          {
+            Int_t nMix = fPoolSoA->GetCurrentNEvents(bin);
+            std::vector<AliEventPoolSoA::EventView> bgEvents(nMix);
+            fPoolSoA->GetEvents(bin, 0, nMix, &bgEvents[0]);
+            fHistosMixed->FillMixedCorrelations(centrality, zVtx, AliUEHist::kCFStepTracked, tracksRecoMatchedAll, &bgEvents[0], nMix, 1.0 / nMix);
+          }
+          UpdateSoAPool(bin, tracksCorrelateRecoMatchedAll);
+        }
+      }
+      else if (fFillMixed)
       {
         for(Int_t iPool=0; iPool<fPoolMgr->GetNumberOfPtBins(); iPool++)
         {
@@ -1027,7 +1092,38 @@ void  AliAnalysisTaskPhiCorrelations::AnalyseCorrectionMode()
       }
       
       // mixed event
-      if (fFillMixed)
+      if (fFillMixed && fPoolSoA)
+      {
+        Int_t bin = fPoolSoA->FindBin(centrality, zVtx + 100);
+        if (bin >= 0)
+        {
+          Int_t nMix = fPoolSoA->GetCurrentNEvents(bin);
+          ((TH2F*) fListOfHistos->FindObject("mixedDist"))->Fill(centrality, fPoolSoA->NTracksInPool(bin));
+          ((TH2F*) fListOfHistos->FindObject("mixedDist2"))->Fill(centrality, nMix);
+          if (fPoolSoA->IsReady(bin))
+          {
+            std::vector<AliEventPoolSoA::EventView> bgEvents(nMix);
+            fPoolSoA->GetEvents(bin, 0, nMix, &bgEvents[0]);
+
+            // STEP 6
+            if (!fSkipStep6)
+              fHistosMixed->FillMixedCorrelations(centrality, zVtx, AliUEHist::kCFStepReconstructed, tracks, &bgEvents[0], nMix, 1.0 / nMix);
+
+            // two track cut, STEP 8
+            if (fTwoTrackEfficiencyCut > 0)
+              fHistosMixed->FillMixedCorrelations(centrality, zVtx, AliUEHist::kCFStepBiasStudy, tracks, &bgEvents[0], nMix, 1.0 / nMix, kTRUE, kTRUE, bSign, fTwoTrackEfficiencyCut);
+
+            // apply correction efficiency, STEP 10
+            if (fEfficiencyCorrectionTriggers || fEfficiencyCorrectionAssociated)
+            {
+              Bool_t twoTrackCut = (fTwoTrackEfficiencyCut > 0);
+              fHistosMixed->FillMixedCorrelations(centrality, zVtx, AliUEHist::kCFStepCorrected, tracks, &bgEvents[0], nMix, 1.0 / nMix, kTRUE, twoTrackCut, bSign, fTwoTrackEfficiencyCut, kTRUE);
+            }
+          }
+          UpdateSoAPool(bin, tracksCorrelate);
+        }
+      }
+      else if (fFillMixed)
       {
         for(Int_t iPool=0; iPool<fPoolMgr->GetNumberOfPtBins(); iPool++)
         {
@@ -1410,6 +1506,35 @@ void  AliAnalysisTaskPhiCorrelations::AnalyseDataMode()
     //    FillCorrelations(). Also nMix should be passed in, so a weight
     //    of 1./nMix can be applied.
 
+    if (fPoolSoA)
+    {
+      Int_t bin = fPoolSoA->FindBin(centrality, zVtx);
+      if (bin < 0)
+        AliFatal(Form("No pool found for centrality = %f, zVtx = %f", centrality, zVtx));
+
+      if (fPoolSoA->IsReady(bin))
+      {
+        Int_t nMix = fPoolSoA->GetCurrentNEvents(bin);
+
+        ((TH1F*) fListOfHistos->FindObject("eventStat"))->Fill(2);
+        ((TH1F*) fListOfHistos->FindObject("eventStat"))->Fill(3, nMix);
+        ((TH2F*) fListOfHistos->FindObject("mixedDist"))->Fill(centrality, fPoolSoA->NTracksInPool(bin));
+        ((TH2F*) fListOfHistos->FindObject("mixedDist2"))->Fill(centrality, nMix);
+
+        // all events of the bin are handed over at once as column arrays
+        std::vector<AliEventPoolSoA::EventView> bgEvents(nMix);
+        fPoolSoA->GetEvents(bin, 0, nMix, &bgEvents[0]);
+
+        if (!fSkipStep6)
+          fHistosMixed->FillMixedCorrelations(centrality, zVtx, AliUEHist::kCFStepReconstructed, tracksClone, &bgEvents[0], nMix, 1.0 / nMix, kTRUE, kFALSE, 0, 0.02, kTRUE);
+
+        if (fTwoTrackEfficiencyCut > 0)
+          fHistosMixed->FillMixedCorrelations(centrality, zVtx, AliUEHist::kCFStepBiasStudy, tracksClone, &bgEvents[0], nMix, 1.0 / nMix, kTRUE, kTRUE, bSign, fTwoTrackEfficiencyCut, kTRUE);
+      }
+
+      UpdateSoAPool(bin, tracksCorrelate ? tracksCorrelate : tracksClone);
+    }
+    else
     for(Int_t iPool=0; iPool<fPoolMgr->GetNumberOfPtBins(); iPool++)
     {
       AliEventPool* pool = fPoolMgr->GetEventPool(centrality, zVtx, 0., iPool);
@@ -1708,6 +1833,19 @@ Double_t AliAnalysisTaskPhiCorrelations::GetCentrality(AliVEvent* inputEvent, TO
   return centrality;
 }
 
+//____________________________________________________________________
+void AliAnalysisTaskPhiCorrelations::UpdateSoAPool(Int_t bin, TObjArray* tracks)
+{
+  // copies the tracks into the SoA event pool, equivalent to storing CloneAndReduceTrackList(tracks) in fPoolMgr
+  // reduced lists (AliBasicParticle) already carry the rapidity in eta, see CloneAndReduceTrackList
+
+  Bool_t useRapidity = fFillCorrelationsRapidity;
+  if (tracks->GetEntriesFast() > 0 && tracks->UncheckedAt(0)->InheritsFrom("AliBasicParticle"))
+    useRapidity = kFALSE;
+
+  fPoolSoA->UpdatePool(bin, tracks, useRapidity);
+}
+
 //____________________________________________________________________
 TObjArray* AliAnalysisTaskPhiCorrelations::CloneAndReduceTrackList(TObjArray* tracks, Double_t minPt, Double_t maxPt)
 {
@@ -2210,5 +2348,6 @@ void AliAnalysisTaskPhiCorrelations::AddEventPoolsToOutput(Double_t minCent, Dou
 void AliAnalysisTaskPhiCorrelations::FinishTaskOutput()
 {
   // Clear unnecessary pools before saving
-  fPoolMgr->ClearPools();
+  if (fPoolMgr)
+    fPoolMgr->ClearPools();
 }
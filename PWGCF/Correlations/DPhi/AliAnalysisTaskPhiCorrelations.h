@@ -42,6 +42,7 @@ class AliUEHistograms;
 class TH1;
 class TObjArray;
 class AliEventPoolManager;
+class AliEventPoolSoA;
 class AliESDEvent;
 class AliHelperPID;
 class AliAnalysisUtils;
@@ -183,6 +184,7 @@ public:
   void SetExternalEventPoolManager(AliEventPoolManager* mgr) {fPoolMgr = mgr;}
   AliEventPoolManager* GetEventPoolManager() {return fPoolMgr;}
   void SetUsePtBinnedEventPool(Bool_t val) {fUsePtBinnedEventPool = val;}
+  void SetUseSoAEventPool(Bool_t val) {fUseSoAEventPool = val;}
   void SetCheckEventNumberInMixedEvent(Bool_t val) {fCheckEventNumberInMixedEvent = val;}
 
   // Set which pools will be saved
@@ -198,6 +200,7 @@ private:
   void            Initialize(); 			                // initialize some common pointer
   Double_t        GetCentrality(AliVEvent* inputEvent, TObject* mc);
   TObjArray* CloneAndReduceTrackList(TObjArray* tracks, Double_t minPt = 0., Double_t maxPt = -1.);
+  void UpdateSoAPool(Int_t bin, TObjArray* tracks);
   void RemoveDuplicates(TObjArray* tracks);
   void CleanUp(TObjArray* tracks, TObject* mcObj, Int_t maxLabel);
   void RemoveWeakDecaysInMC(TObjArray* tracks, TObject* mcObj);
@@ -252,6 +255,7 @@ private:
   AliMCEvent*              fMcEvent;         //! MC event
   AliInputEventHandler*    fMcHandler;       //! MCEventHandler
   AliEventPoolManager*     fPoolMgr;         // event pool manager
+  AliEventPoolSoA*         fPoolSoA;         //! event pool with column-wise track storage (used instead of fPoolMgr if fUseSoAEventPool)
 
   // Histogram settings
   TList*              fListOfHistos;    //  Output list of containers
@@ -341,8 +345,9 @@ private:
   vector<vector<Double_t> >   fEventPoolOutputList; // vector representing a list of pools (given by value range) that will be saved
   Bool_t                      fUsePtBinnedEventPool; // uses event pool in pt bins
   Bool_t                      fCheckEventNumberInMixedEvent; // check event number before correlation in mixed event
+  Bool_t                      fUseSoAEventPool; // uses AliEventPoolSoA instead of AliEventPoolManager for the event mixing
 
-  ClassDef(AliAnalysisTaskPhiCorrelations, 62); // Analysis task for delta phi correlations
+  ClassDef(AliAnalysisTaskPhiCorrelations, 63); // Analysis task for delta phi correlations
 };
 
 #endif
@@ -229,6 +229,12 @@ void AliJFFlucAnalysis::UserCreateOutputObjects(){
 		<< TH3D("h_phietaz","h_phietaz",50,-TMath::Pi(),TMath::Pi(),40,-2.0,2.0,20,-10.0,10.0)
 		<< fHistCentBin
 		<< "END";
+	// track-level QA histograms are filled in the track loop: resolve them once
+	fh_pt.PrepareFlatIndex();
+	fh_eta.PrepareFlatIndex();
+	fh_phi.PrepareFlatIndex();
+	fh_phieta.PrepareFlatIndex();
+	fh_phietaz.PrepareFlatIndex();
 	/*fh_Qvector
 		<< TH1D("h_QVector", "h_QVector", 100, -10, 10)
 		<< fHistCentBin << fBin_Subset
@@ -706,13 +712,23 @@ void AliJFFlucAnalysis::Terminate(Option_t *)
 void AliJFFlucAnalysis::Fill_QA_plot( Double_t eta1, Double_t eta2 )
 {
 	Long64_t ntracks = fInputList->GetEntriesFast();
+	// histograms of this centrality bin, looked up once per event
+	TH2D *hphieta = fh_phieta.At(fh_phieta.FlatIndex(fCBin));
+	TH3D *hphietaz = fh_phietaz.At(fh_phietaz.FlatIndex(fCBin));
+	TH1D *heta = fh_eta.At(fh_eta.FlatIndex(fCBin));
+	TH1D *hpt = fh_pt.At(fh_pt.FlatIndex(fCBin));
+	int iphi0 = fh_phi.FlatIndex(fCBin,0); // subsets are contiguous in the flat index
+	// phi entries are collected per track and filled in one batch after the loop
+	std::vector<int> phiIndex; phiIndex.reserve(ntracks);
+	std::vector<Double_t> phiValue; phiValue.reserve(ntracks);
+	std::vector<Double_t> phiWeight; phiWeight.reserve(ntracks);
 	for( Long64_t it=0; it < ntracks; it++){
 		AliJBaseTrack *itrack = (AliJBaseTrack*)fInputList->At(it); // load track
 		Double_t eta = itrack->Eta();
 		Double_t phi = itrack->Phi();
 
-		fh_phieta[fCBin]->Fill(phi,eta);
-		fh_phietaz[fCBin]->Fill(phi,eta,fVertex[2]);
+		hphieta->Fill(phi,eta);
+		hphietaz->Fill(phi,eta,fVertex[2]);
 
 		if(TMath::Abs(eta) < eta1 || TMath::Abs(eta) > eta2)
 			continue;
@@ -728,10 +744,14 @@ void AliJFFlucAnalysis::Fill_QA_plot( Double_t eta1, Double_t eta2 )
 		Double_t pt = itrack->Pt();
 		Double_t effCorr = fEfficiency->GetCorrection( pt, fEffFilterBit, fCent);
 		Double_t effInv = 1.0/effCorr;
-		fh_eta[fCBin]->Fill(eta,effInv);
-		fh_pt[fCBin]->Fill(pt,effInv);
-		fh_phi[fCBin][(int)(eta > 0.0)]->Fill( phi, effInv/phi_module_corr);
+		heta->Fill(eta,effInv);
+		hpt->Fill(pt,effInv);
+		phiIndex.push_back(iphi0+(int)(eta > 0.0));
+		phiValue.push_back(phi);
+		phiWeight.push_back(effInv/phi_module_corr);
 	}
+	if( !phiIndex.empty() )
+		fh_phi.FillBatch( (int)phiIndex.size(), &phiIndex[0], &phiValue[0], &phiWeight[0] );
 	for(int iaxis=0; iaxis<3; iaxis++)
 		fh_vertex[iaxis]->Fill( fVertex[iaxis] );
 
@@ -286,6 +286,29 @@ void AliJArrayBase::FixBin(){
     fArraySize = fAlg->BuildArray();
 }
 //_____________________________________________________
+int AliJArrayBase::FlatIndex( const int * idx ){
+    // global index of a bin tuple, same ordering as the internal array
+    if( !fAlg ) JERROR("Bins are not fixed in "+fName);
+    int iG = 0;
+    for( int d=0;d<Dimension();d++ ){
+        if( OutOfSize( idx[d], d ) ){ JERROR(Form("wrong Index %d of %dth in ",idx[d], d)+fName); }
+        iG += idx[d]*fAlg->DimFactor(d);
+    }
+    return iG;
+}
+//_____________________________________________________
+void* AliJArrayBase::GetItemAt( int iG ){
+    // item at a flat index, built on first access like GetItem
+    if( OutOf( iG, 0, fArraySize-1 ) ) JERROR(Form("wrong flat index %d in ",iG)+fName);
+    void * item = *fAlg->GetRawItemAt(iG);
+    if( !item ){
+        fAlg->SetIndexFromGlobal(iG);
+        BuildItem();
+        item = *fAlg->GetRawItemAt(iG);
+    }
+    return item;
+}
+//_____________________________________________________
 int AliJArrayBase::Index(int d){
     if( OutOfDim(d) ) JERROR("Wrong Dim");
     return fIndex[d];
@@ -645,12 +668,21 @@ bool AliJTH1::IsLoadMode(){
 //////////////////////////////////////////////////////////////////////////
 template< typename T>
 AliJTH1Derived<T>::AliJTH1Derived():
-    AliJTH1(), fPlayer(this)
+    AliJTH1(), fPlayer(this), fFlatItems()
 {
 }
 template< typename T>
 AliJTH1Derived<T>::~AliJTH1Derived(){
 }
+//_____________________________________________________
+template< typename T>
+void AliJTH1Derived<T>::PrepareFlatIndex(){
+    // Reserve the table of resolved histograms. Each bin combination is
+    // resolved (and its histogram built) at its first At() call only, so
+    // that the output keeps containing only the histograms actually used
+    if( !fAlg ) JERROR("Bins are not fixed in "+fName);
+    fFlatItems.assign( GetEntries(), (T*)NULL );
+}
 
 
 
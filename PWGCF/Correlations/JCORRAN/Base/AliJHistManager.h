@@ -159,6 +159,10 @@ class AliJArrayBase : public AliJNamed{
         void * GetItem();
         void * GetSingleItem();
 
+        // Flat index access: one integer per bin combination, row-major in the bin order
+        int  FlatIndex( const int * idx );
+        void * GetItemAt( int iG );
+
         ///void LockBin(bool is=true){}//TODO
         //bool IsBinLocked(){ return fIsBinLocked; }
 
@@ -212,6 +216,9 @@ class AliJArrayAlgorithm {
         virtual void InitIterator()=0;
         virtual bool Next(void *& item) = 0;
         virtual void ** GetRawItem()=0;
+        virtual void ** GetRawItemAt(int iG)=0;
+        virtual void SetIndexFromGlobal(int iG)=0;
+        virtual int  DimFactor(int d)=0;
         virtual void * GetPosition()=0;
         virtual bool IsCurrentPosition(void * pos)=0;
         virtual void SetPosition(void * pos )=0;
@@ -234,6 +241,9 @@ class AliJArrayAlgorithmSimple : public AliJArrayAlgorithm {
         virtual void SetItem(void * item);
         virtual void InitIterator(){ fPos = 0; }
         virtual void ** GetRawItem(){ return &fArray[GlobalIndex()]; }
+        virtual void ** GetRawItemAt(int iG){ return &fArray[iG]; }
+        virtual void SetIndexFromGlobal(int iG){ ReverseIndex(iG); }
+        virtual int  DimFactor(int d){ return fDimFactor[d]; }
         virtual bool Next(void *& item){
             item = fPos<GetEntries()?(void*)fArray[fPos]:NULL;
             if( fPos<GetEntries() ) ReverseIndex(fPos);
@@ -312,7 +322,7 @@ class AliJTH1Derived : public AliJTH1 {
     public:
         AliJTH1Derived();
         AliJTH1Derived(TString config, AliJHistManager *hmg):
-            AliJTH1(config, hmg),fPlayer(this){}
+            AliJTH1(config, hmg),fPlayer(this),fFlatItems(){}
         virtual ~AliJTH1Derived();
 
         AliJTH1DerivedPlayer<T> & operator[](int i){ fPlayer.Init();fPlayer[i];return fPlayer; }
@@ -323,6 +333,28 @@ class AliJTH1Derived : public AliJTH1 {
         // Virtual from AliJTH1
         virtual const char * ClassName(){ return Form("AliJ%s",T::Class()->GetName()); }
 
+        // Flat index API: resolve the bin tuple once, then access/fill by a single integer
+        int FlatIndex( int i0 ){ int idx[1]={i0}; return CheckedFlatIndex(idx,1); }
+        int FlatIndex( int i0, int i1 ){ int idx[2]={i0,i1}; return CheckedFlatIndex(idx,2); }
+        int FlatIndex( int i0, int i1, int i2 ){ int idx[3]={i0,i1,i2}; return CheckedFlatIndex(idx,3); }
+        int FlatIndex( int i0, int i1, int i2, int i3 ){ int idx[4]={i0,i1,i2,i3}; return CheckedFlatIndex(idx,4); }
+        void PrepareFlatIndex();
+        T * At( int iG ){
+            if( iG >= 0 && iG < int(fFlatItems.size()) ){
+                if( !fFlatItems[iG] ) fFlatItems[iG] = static_cast<T*>(GetItemAt(iG));
+                return fFlatItems[iG];
+            }
+            return static_cast<T*>(GetItemAt(iG));
+        }
+        // Fill entries i=0..n-1 into histogram iG[i] with value x[i] and weight w[i]
+        template<typename V> void FillBatch( int n, const int * iG, const V * x, const V * w ){
+            for( int i=0;i<n;i++ ) At(iG[i])->Fill( x[i], w[i] );
+        }
+        // Same for two-dimensional histograms: Fill( x[i], y[i], w[i] )
+        template<typename V> void FillBatch( int n, const int * iG, const V * x, const V * y, const V * w ){
+            for( int i=0;i<n;i++ ) At(iG[i])->Fill( x[i], y[i], w[i] );
+        }
+
         AliJTH1Derived<T>& operator<<(int i){ AddDim(i);return *this; }
         AliJTH1Derived<T>& operator<<(AliJBin& v){ AddDim(&v);return *this; }
         AliJTH1Derived<T>& operator<<(TString v){ AddDim(v);return *this; }
@@ -342,7 +374,12 @@ class AliJTH1Derived : public AliJTH1 {
           AddDim("END");
         }
     protected:
+        int CheckedFlatIndex( const int * idx, int n ){
+            if( n != Dimension() ) JERROR(Form("%d indices given for %d dimensions in ",n,Dimension())+fName);
+            return AliJArrayBase::FlatIndex(idx);
+        }
         AliJTH1DerivedPlayer<T> fPlayer;
+        std::vector<T*> fFlatItems;   // resolved histograms by flat index, filled by At() after PrepareFlatIndex
 
 };
 
@@ -10,6 +10,7 @@
 #include "AliFemtoAnalysis.h"
 #include "AliFemtoEvent.h"
 #include "AliFemtoPair.h"
+#include "AliFemtoPairBatch.h"
 #include "AliFemtoPairCut.h"
 
 #include <TCollection.h>
@@ -44,6 +45,19 @@ public:
   /// Not Implemented - Add background pair
   virtual void AddMixedPair(AliFemtoPair* aPir);
 
+  /// Return true to receive the pairs of AliFemtoSimpleAnalysis through
+  /// AddRealPairs/AddMixedPairs instead of one AddRealPair/AddMixedPair
+  /// call per pair. Other analyses still call the per-pair methods, which
+  /// have to stay implemented.
+  virtual bool AcceptsPairBatch() const;
+  /// Columns of AliFemtoPairBatch read by AddRealPairs/AddMixedPairs
+  /// (bit mask of AliFemtoPairBatch::EColumn), all by default
+  virtual unsigned int PairBatchColumns() const;
+  /// Not Implemented - Add a batch of signal pairs
+  virtual void AddRealPairs(const AliFemtoPairBatch &batch);
+  /// Not Implemented - Add a batch of background pairs
+  virtual void AddMixedPairs(const AliFemtoPairBatch &batch);
+
   /// Not Implemented - Add pair with optional
   virtual void AddFirstParticle(AliFemtoParticle *particle, bool mixing);
   virtual void AddSecondParticle(AliFemtoParticle *particle);
@@ -97,6 +111,16 @@ inline void AliFemtoCorrFctn::SetPairSelectionCut(AliFemtoPairCut* cut)
   fPairCut = cut;
 }
 
+inline bool AliFemtoCorrFctn::AcceptsPairBatch() const
+{
+  return false;
+}
+
+inline unsigned int AliFemtoCorrFctn::PairBatchColumns() const
+{
+  return AliFemtoPairBatch::kAllColumns;
+}
+
 inline void AliFemtoCorrFctn::EventBegin(const AliFemtoEvent* /* event */)
 { // no-op
 }
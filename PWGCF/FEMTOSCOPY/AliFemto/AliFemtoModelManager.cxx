@@ -13,6 +13,9 @@
 
 #include "AliFemtoModelManager.h"
 #include "AliFemtoModelHiddenInfo.h"
+#include "AliFemtoPair.h"
+
+#include <cmath>
 
 //_____________________________________________
 AliFemtoModelManager::AliFemtoModelManager():
@@ -76,6 +79,16 @@ Double_t AliFemtoModelManager::GetWeight(AliFemtoPair *aPair)
 //    exit(0);
   }
   // Return femtoscopic weight for a given pair
+
+  // Another correlation function has already weighted this pair, do not
+  // generate new emission points for it
+  {
+    double cached_weight = aPair->LookupFemtoWeightCache(fWeightGenerator);
+    if (!std::isnan(cached_weight)) {
+      return cached_weight;
+    }
+  }
+
   if (fCreateCopyHiddenInfo) {
     // Try to guess particle masses and pid from the weight generator
     Double_t tMass1=0.0001, tMass2=0.0001;
@@ -14,12 +14,15 @@
 #include "AliFemtoModelWeightGeneratorLednicky.h"
 #include "AliFemtoModelHiddenInfo.h"
 #include "AliFemtoPair.h"
+#include "TRandom.h"
 //#include "StarCallf77.h"
 //#include <strstream.h>
 //#include <iomanip.h>
 //#include <stream>
 //#include <iomanip>
 #include <sstream>
+#include <cmath>
+#include <algorithm>
 
 #ifdef SOLARIS
 # ifndef false
@@ -159,6 +162,13 @@ AliFemtoModelWeightGeneratorLednicky::AliFemtoModelWeightGeneratorLednicky()
   , fNumbNonId(0)
   , fKpKmModel(14)
   , fPhi_OffOn(1)
+  , fUseTables(false)
+  , fNKStarTab(100)
+  , fKStarMaxTab(0.2)
+  , fNRStarTab(100)
+  , fRStarMaxTab(20.)
+  , fNCosTab(100)
+  , fWeightTables()
 {
   // default constructor
   fNumProcessPair = new int[fLLMax+1];
@@ -195,6 +205,13 @@ AliFemtoModelWeightGeneratorLednicky
   , fNumbNonId(aWeight.fNumbNonId)
   , fKpKmModel(aWeight.fKpKmModel)
   , fPhi_OffOn(aWeight.fPhi_OffOn)
+  , fUseTables(aWeight.fUseTables)
+  , fNKStarTab(aWeight.fNKStarTab)
+  , fKStarMaxTab(aWeight.fKStarMaxTab)
+  , fNRStarTab(aWeight.fNRStarTab)
+  , fRStarMaxTab(aWeight.fRStarMaxTab)
+  , fNCosTab(aWeight.fNCosTab)
+  , fWeightTables()
 {
   fNumProcessPair = new int[fLLMax+1];
   for (int i=1;i<=fLLMax;i++) {
@@ -242,6 +259,13 @@ AliFemtoModelWeightGeneratorLednicky::operator=(const AliFemtoModelWeightGenerat
   fKpKmModel = aWeight.fKpKmModel;
   fPhi_OffOn = aWeight.fPhi_OffOn;
 
+  fUseTables = aWeight.fUseTables;
+  fNKStarTab = aWeight.fNKStarTab;
+  fKStarMaxTab = aWeight.fKStarMaxTab;
+  fNRStarTab = aWeight.fNRStarTab;
+  fRStarMaxTab = aWeight.fRStarMaxTab;
+  fNCosTab = aWeight.fNCosTab;
+
   for (int i=1;i<=fLLMax;i++) {
     fNumProcessPair[i] = 0;
   }
@@ -388,6 +412,20 @@ double AliFemtoModelWeightGeneratorLednicky::GenerateWeight(AliFemtoPair* aPair)
     return 0;
   }
 
+  // k* and r* in the pair rest frame are enough when tabulated
+  if (fUseTables && fKStar > 0 && fRStar > 0) {
+    const std::vector<float> *table = GetWeightTable();
+    const double tCosTheta = (fKStarOut * fRStarOut
+                              + fKStarSide * fRStarSide
+                              + fKStarLong * fRStarLong) / (fKStar * fRStar);
+    double tWeight;
+    if (table && InterpolateWeight(*table, fKStar, fRStar, tCosTheta, tWeight)) {
+      fWei = fWein = tWeight;
+      aPair->AddWeightToCache(this, tWeight);
+      return tWeight;
+    }
+  }
+
   double p1[] = {true_p1.x(), true_p1.y(), true_p1.z()},
          p2[] = {true_p2.x(), true_p2.y(), true_p2.z()};
 
@@ -454,6 +492,12 @@ AliFemtoModelWeightGeneratorLednicky::Report()
   if (fNumbNonId) {
     tStr << "         "<< fNumbNonId << " Non Identified" << endl;
   }
+  if (fUseTables) {
+    tStr << "    Tabulated weights : k* " << fNKStarTab << " bins up to " << fKStarMaxTab
+         << " - r* " << fNRStarTab << " bins up to " << fRStarMaxTab
+         << " - cos theta " << fNCosTab << " bins - "
+         << fWeightTables.size() << " tables built" << endl;
+  }
   AliFemtoString returnThis = tStr.str();
   return returnThis;
 }
@@ -461,6 +505,7 @@ AliFemtoModelWeightGeneratorLednicky::Report()
 void AliFemtoModelWeightGeneratorLednicky::FsiInit()
 {
   // Initialize weight generation module
+  fWeightTables.clear();
    cout << "*******************AliFemtoModelWeightGeneratorLednicky check FsiInit ************" << endl;
    cout <<"mItest dans FsiInit() = " << fItest << endl;
    cout <<"mIch dans FsiInit() = " << fIch << endl;
@@ -474,6 +519,7 @@ void AliFemtoModelWeightGeneratorLednicky::FsiInit()
 void AliFemtoModelWeightGeneratorLednicky::FsiSetKpKmModelType()
 {
   // initialize K+K- model type
+  fWeightTables.clear();
   cout<<"******************* AliFemtoModelWeightGeneratorLednicky check FsiInit initialize K+K- model type with FsiSetKpKmModelType(), type= "<<fKpKmModel<<" PhiOffON= "<<fPhi_OffOn<<" *************"<< endl;
    setkpkmmodel(fKpKmModel,fPhi_OffOn);
    cout<<"-----------------END FsiSetKpKmModelType-------"<<endl;
@@ -489,16 +535,23 @@ void AliFemtoModelWeightGeneratorLednicky::FsiNucl()
   fsinucl(fNuclMass,fNuclCharge*fNuclChargeSign);
 }
 
-void AliFemtoModelWeightGeneratorLednicky::FsiSetLL()
+int AliFemtoModelWeightGeneratorLednicky::FsiNS() const
 {
-  // set internal pair type for the module
+  // approximation used for the current pair type
   int tNS;
   if (fSphereApp||(fLL>5)) {
     if (fT0App) { tNS=4;}
     else {tNS=2;}
   } else { tNS=1;}
-  //cout<<"*********************** AliFemtoModelWeightGeneratorLednicky::FsiSetLL() *********************"<<endl;
   if(fNS_4==4) tNS=4;//K+K- analisys
+  return tNS;
+}
+
+void AliFemtoModelWeightGeneratorLednicky::FsiSetLL()
+{
+  // set internal pair type for the module
+  int tNS = FsiNS();
+  //cout<<"*********************** AliFemtoModelWeightGeneratorLednicky::FsiSetLL() *********************"<<endl;
   //cout <<"fLL dans FsiSetLL() = "<< fLL << endl;
   //cout <<"tNS dans FsiSetLL() = "<< tNS << endl;
   //cout <<"fItest dans FsiSetLL() = "<< fItest << endl;
@@ -716,13 +769,173 @@ void AliFemtoModelWeightGeneratorLednicky::SetNuclMass(const double aNuclMass)
   { fNuclMass = aNuclMass; FsiNucl(); }
 
 void AliFemtoModelWeightGeneratorLednicky::SetSphere()
-  { fSphereApp = true; }
+  { fSphereApp = true; fWeightTables.clear(); }
 void AliFemtoModelWeightGeneratorLednicky::SetSquare()
-  { fSphereApp=false; }
+  { fSphereApp=false; fWeightTables.clear(); }
 void AliFemtoModelWeightGeneratorLednicky::SetT0ApproxOn()
-  { fT0App = true; }
+  { fT0App = true; fWeightTables.clear(); }
 void AliFemtoModelWeightGeneratorLednicky::SetT0ApproxOff()
-  { fT0App = false; }
+  { fT0App = false; fWeightTables.clear(); }
+
+void AliFemtoModelWeightGeneratorLednicky::SetTabulatedWeights(bool aOn)
+  { fUseTables = aOn; }
+
+void AliFemtoModelWeightGeneratorLednicky::SetTableBinning(int aNKStar, double aKStarMax,
+                                                           int aNRStar, double aRStarMax,
+                                                           int aNCosTheta)
+{
+  // at least two nodes in each direction for the interpolation
+  fNKStarTab = std::max(aNKStar, 2);
+  fKStarMaxTab = aKStarMax;
+  fNRStarTab = std::max(aNRStar, 2);
+  fRStarMaxTab = aRStarMax;
+  fNCosTab = std::max(aNCosTheta, 1);
+  fWeightTables.clear();
+}
+
+double AliFemtoModelWeightGeneratorLednicky::DirectWeight(double aKStar, double aRStar, double aCosTheta)
+{
+  // the pair is at rest, so that the frame is already the pair rest frame,
+  // the emission points are simultaneous; FsiSetLL must have been called
+  const double tSinTheta = ::sqrt(std::max(0.0, 1.0 - aCosTheta * aCosTheta));
+
+  double p1[] = {0.0, 0.0, aKStar},
+         p2[] = {0.0, 0.0, -aKStar};
+  double x1[] = {aRStar * tSinTheta, 0.0, aRStar * aCosTheta, 0.0},
+         x2[] = {0.0, 0.0, 0.0, 0.0};
+
+  fsimomentum(*p1,*p2);
+  fsiposition(*x1,*x2);
+  ltran12();
+  fsiw(1, fWeif, fWei, fWein);
+
+  return fWein;
+}
+
+const std::vector<float>* AliFemtoModelWeightGeneratorLednicky::GetWeightTable()
+{
+  // the weight does not depend only on k*, r* and cos theta with the
+  // 3-body calculation or with t* != 0
+  if (fI3c != 0 || FsiNS() == 2) {
+    return nullptr;
+  }
+
+  auto found = fWeightTables.find(fLL);
+  if (found != fWeightTables.end()) {
+    return &found->second;
+  }
+
+  std::vector<float> &table = fWeightTables[fLL];
+  table.resize(fNKStarTab * fNRStarTab * (fNCosTab + 1));
+
+  const double tDK = fKStarMaxTab / fNKStarTab,
+               tDR = fRStarMaxTab / fNRStarTab,
+               tDC = 2.0 / fNCosTab;
+
+  cout << "AliFemtoModelWeightGeneratorLednicky::GetWeightTable - building table for "
+       << fLLName[fLL] << " (" << table.size() << " nodes)" << endl;
+
+  FsiSetLL();
+  size_t tIdx = 0;
+  for (int ik = 0; ik < fNKStarTab; ik++) {
+    for (int ir = 0; ir < fNRStarTab; ir++) {
+      for (int ic = 0; ic <= fNCosTab; ic++) {
+        table[tIdx++] = DirectWeight((ik + 0.5) * tDK, (ir + 0.5) * tDR, -1.0 + ic * tDC);
+      }
+    }
+  }
+
+  return &table;
+}
+
+bool AliFemtoModelWeightGeneratorLednicky::InterpolateWeight(const std::vector<float> &aTable,
+                                                             double aKStar, double aRStar,
+                                                             double aCosTheta, double &aWeight) const
+{
+  // fractional node positions, the k* and r* nodes are at the bin centers
+  const double tK = aKStar * fNKStarTab / fKStarMaxTab - 0.5,
+               tR = aRStar * fNRStarTab / fRStarMaxTab - 0.5,
+               tC = (std::min(std::max(aCosTheta, -1.0), 1.0) + 1.0) * 0.5 * fNCosTab;
+
+  if (tK < 0 || tR < 0 || tK > fNKStarTab - 1 || tR > fNRStarTab - 1) {
+    return false;
+  }
+
+  const int ik = std::min(int(tK), fNKStarTab - 2),
+            ir = std::min(int(tR), fNRStarTab - 2),
+            ic = std::min(int(tC), fNCosTab - 1);
+  const double fk = tK - ik,
+               fr = tR - ir,
+               fc = tC - ic;
+
+  const int tNC = fNCosTab + 1;
+  const float *w00 = &aTable[(ik * fNRStarTab + ir) * tNC + ic],
+              *w01 = w00 + tNC,
+              *w10 = w00 + fNRStarTab * tNC,
+              *w11 = w10 + tNC;
+
+  const double tW00 = w00[0] + fc * (w00[1] - w00[0]),
+               tW01 = w01[0] + fc * (w01[1] - w01[0]),
+               tW10 = w10[0] + fc * (w10[1] - w10[0]),
+               tW11 = w11[0] + fc * (w11[1] - w11[0]);
+
+  const double tW0 = tW00 + fr * (tW01 - tW00),
+               tW1 = tW10 + fr * (tW11 - tW10);
+
+  aWeight = tW0 + fk * (tW1 - tW0);
+  return true;
+}
+
+double AliFemtoModelWeightGeneratorLednicky::TestTableAccuracy(int aPid1, int aPid2,
+                                                               int aNPoints, double *aMeanDiff)
+{
+  if (aMeanDiff) {
+    *aMeanDiff = -1;
+  }
+
+  if (!SetPid(aPid1, aPid2)) {
+    return -1;
+  }
+
+  const std::vector<float> *table = GetWeightTable();
+  if (!table) {
+    cout << "AliFemtoModelWeightGeneratorLednicky::TestTableAccuracy - no table for "
+         << fLLName[fLL] << " with the current settings" << endl;
+    return -1;
+  }
+
+  // sample inside the outer nodes, where the interpolation is used
+  const double tKLo = 0.5 * fKStarMaxTab / fNKStarTab,
+               tKHi = fKStarMaxTab - tKLo,
+               tRLo = 0.5 * fRStarMaxTab / fNRStarTab,
+               tRHi = fRStarMaxTab - tRLo;
+
+  FsiSetLL();
+  double tMaxDiff = 0, tSumDiff = 0;
+  for (int i = 0; i < aNPoints; i++) {
+    const double tKStar = gRandom->Uniform(tKLo, tKHi),
+                 tRStar = gRandom->Uniform(tRLo, tRHi),
+                 tCosTheta = gRandom->Uniform(-1.0, 1.0);
+
+    double tTabulated = 0;
+    InterpolateWeight(*table, tKStar, tRStar, tCosTheta, tTabulated);
+    const double tDiff = fabs(tTabulated - DirectWeight(tKStar, tRStar, tCosTheta));
+
+    tMaxDiff = std::max(tMaxDiff, tDiff);
+    tSumDiff += tDiff;
+  }
+
+  const double tMeanDiff = aNPoints > 0 ? tSumDiff / aNPoints : 0;
+  if (aMeanDiff) {
+    *aMeanDiff = tMeanDiff;
+  }
+
+  cout << "AliFemtoModelWeightGeneratorLednicky::TestTableAccuracy - " << fLLName[fLL]
+       << " : " << aNPoints << " points, max |tabulated-direct| = " << tMaxDiff
+       << ", mean = " << tMeanDiff << endl;
+
+  return tMaxDiff;
+}
 
 void AliFemtoModelWeightGeneratorLednicky::SetDefaultCalcPar()
 {
@@ -11,6 +11,7 @@
 
 #include <vector>
 #include <string>
+#include <map>
 
 
 /// \class AliFemtoModelWeightGeneratorLednicky
@@ -75,6 +76,31 @@ public:
 
   void SetKpKmModelType(const int aModelType, const int aPhi_OffOn);  // K+K- model type,Phi off/on
 
+  /// Interpolate the weights from tables in (k*, r*, cos theta), built
+  /// once per pair type by calling the fortran code on the grid nodes.
+  ///
+  /// The tables are used only when the weight depends on these three
+  /// variables alone: no 3-body calculation and the equal emission time
+  /// approximation in the pair rest frame (square well potential for
+  /// pairs up to pi+pi-, or SetT0ApproxOn). Pairs outside of the table
+  /// ranges are calculated directly.
+  void SetTabulatedWeights(bool aOn=true);
+  bool GetTabulatedWeights() const { return fUseTables; }
+
+  /// Number of bins and upper limit of k* (GeV/c), r* (fm) and number
+  /// of bins in cos theta of the tables. Nodes are at the bin centers
+  /// in k* and r* and at the bin edges in cos theta.
+  void SetTableBinning(int aNKStar, double aKStarMax,
+                       int aNRStar, double aRStarMax,
+                       int aNCosTheta);
+
+  /// Compare the tabulated and the direct weights of the given pair of
+  /// particles in aNPoints random points inside the tables.
+  ///
+  /// \return the largest absolute difference (-1 if the tables cannot be
+  ///         used for this pair), the mean one is set in aMeanDiff
+  double TestTableAccuracy(int aPid1, int aPid2, int aNPoints, double *aMeanDiff=nullptr);
+
   virtual AliFemtoString Report();
 
 protected:
@@ -115,15 +141,33 @@ protected:
   int       fPhi_OffOn;      //0->Phi Off,1->Phi On
   int       fNS_4;           //set NS is equal to 4
 
+  // Tabulated weights
+  bool   fUseTables;         // interpolate the weights from the tables
+  int    fNKStarTab;         // number of k* bins of the tables
+  double fKStarMaxTab;       // upper k* limit of the tables
+  int    fNRStarTab;         // number of r* bins of the tables
+  double fRStarMaxTab;       // upper r* limit of the tables
+  int    fNCosTab;           // number of cos theta bins of the tables
+  std::map<int, std::vector<float> > fWeightTables; //! tables for each fLL, filled on demand
+
   // Interface to the fortran functions
   void FsiSetKpKmModelType();  //// initialize K+K- model type
   void FsiInit();
   void FsiSetLL();
+  int  FsiNS() const;
   void FsiNucl();
   bool SetPid(const int aPid1,const int aPid2);
 
+  /// Weight of the current pair type for k* along z and r* in the xz plane
+  double DirectWeight(double aKStar, double aRStar, double aCosTheta);
+  /// Table of the current pair type, null if the tables cannot be used
+  const std::vector<float>* GetWeightTable();
+  /// Trilinear interpolation, false if the point is out of the table
+  bool InterpolateWeight(const std::vector<float> &aTable, double aKStar,
+                         double aRStar, double aCosTheta, double &aWeight) const;
+
 #ifdef __ROOT__
-  ClassDef(AliFemtoModelWeightGeneratorLednicky, 2);
+  ClassDef(AliFemtoModelWeightGeneratorLednicky, 3);
 #endif
 };
 
@@ -20,6 +20,13 @@ AliFemtoPair::AliFemtoPair():
   fTrack1(nullptr),
   fTrack2(nullptr),
   fPairAngleEP(0.0),
+  fKinematicsCalculated(0),
+  fQInvCalc(0.0),
+  fKTCalc(0.0),
+  fMInvCalc(0.0),
+  fQOutCMSCalc(0.0),
+  fQSideCMSCalc(0.0),
+  fQLongCMSCalc(0.0),
   fNonIdParNotCalculated(0.0),
   fDKSide(0.0),
   fDKOut(0.0),
@@ -60,6 +67,13 @@ AliFemtoPair::AliFemtoPair(AliFemtoParticle* a, AliFemtoParticle* b):
   fTrack1(a),
   fTrack2(b),
   fPairAngleEP(0.0),
+  fKinematicsCalculated(0),
+  fQInvCalc(0.0),
+  fKTCalc(0.0),
+  fMInvCalc(0.0),
+  fQOutCMSCalc(0.0),
+  fQSideCMSCalc(0.0),
+  fQLongCMSCalc(0.0),
   fNonIdParNotCalculated(0.0),
   fDKSide(0.0),
   fDKOut(0.0),
@@ -131,6 +145,13 @@ AliFemtoPair::AliFemtoPair(const AliFemtoPair &aPair):
   fTrack1(aPair.fTrack1),
   fTrack2(aPair.fTrack2),
   fPairAngleEP(aPair.fPairAngleEP),
+  fKinematicsCalculated(aPair.fKinematicsCalculated),
+  fQInvCalc(aPair.fQInvCalc),
+  fKTCalc(aPair.fKTCalc),
+  fMInvCalc(aPair.fMInvCalc),
+  fQOutCMSCalc(aPair.fQOutCMSCalc),
+  fQSideCMSCalc(aPair.fQSideCMSCalc),
+  fQLongCMSCalc(aPair.fQLongCMSCalc),
   fNonIdParNotCalculated(aPair.fNonIdParNotCalculated),
   fDKSide(aPair.fDKSide),
   fDKOut(aPair.fDKOut),
@@ -177,6 +198,14 @@ AliFemtoPair& AliFemtoPair::operator=(const AliFemtoPair &aPair)
 
   fPairAngleEP = aPair.fPairAngleEP;
 
+  fKinematicsCalculated = aPair.fKinematicsCalculated;
+  fQInvCalc = aPair.fQInvCalc;
+  fKTCalc = aPair.fKTCalc;
+  fMInvCalc = aPair.fMInvCalc;
+  fQOutCMSCalc = aPair.fQOutCMSCalc;
+  fQSideCMSCalc = aPair.fQSideCMSCalc;
+  fQLongCMSCalc = aPair.fQLongCMSCalc;
+
   fNonIdParNotCalculated = aPair.fNonIdParNotCalculated;
   fDKSide = aPair.fDKSide;
   fDKOut = aPair.fDKOut;
@@ -226,14 +255,21 @@ double AliFemtoPair::GetPairAngleEP() const
 	return fPairAngleEP;
 }
 //_________________
-double AliFemtoPair::MInv() const
+double AliFemtoPair::CalcQInv() const
+{
+  // invariant relative momentum
+  AliFemtoLorentzVector tDiff = (fTrack1->FourMomentum()-fTrack2->FourMomentum());
+  return -tDiff.m();
+}
+//_________________
+double AliFemtoPair::CalcMInv() const
 {
   // invariant mass
     double tInvariantMass = abs(fTrack1->FourMomentum() + fTrack2->FourMomentum());
     return tInvariantMass;
 }
 //_________________
-double AliFemtoPair::KT() const
+double AliFemtoPair::CalcKT() const
 {
   // transverse momentum
   double tmp = (fTrack1->FourMomentum() + fTrack2->FourMomentum()).Perp();
@@ -388,7 +424,7 @@ void AliFemtoPair::QYKPPF(double& qP, double& qT, double& q0) const
 
 
 //_________________
-double AliFemtoPair::QOutCMS() const
+double AliFemtoPair::CalcQOutCMS() const
 {
   // relative momentum out component in lab frame
   const AliFemtoThreeVector
@@ -409,7 +445,7 @@ double AliFemtoPair::QOutCMS() const
 }
 
 //_________________
-double AliFemtoPair::QSideCMS() const
+double AliFemtoPair::CalcQSideCMS() const
 {
   // relative momentum side component in lab frame
   const AliFemtoThreeVector
@@ -433,7 +469,7 @@ double AliFemtoPair::QSideCMS() const
 }
 
 //_________________________
-double AliFemtoPair::QLongCMS() const
+double AliFemtoPair::CalcQLongCMS() const
 {
   // relative momentum component in lab frame
   const AliFemtoLorentzVector
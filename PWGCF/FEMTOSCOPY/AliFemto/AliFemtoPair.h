@@ -227,6 +227,30 @@ private:
 
   double fPairAngleEP;	//Pair emission angle wrt EP
 
+  /// Bits of fKinematicsCalculated, one per memoized kinematic variable
+  enum {
+    kQInvCalculated     = 1 << 0,
+    kKTCalculated       = 1 << 1,
+    kMInvCalculated     = 1 << 2,
+    kQOutCMSCalculated  = 1 << 3,
+    kQSideCMSCalculated = 1 << 4,
+    kQLongCMSCalculated = 1 << 5
+  };
+
+  mutable unsigned short fKinematicsCalculated; // Bits set for the kinematic variables already calculated for this pair
+  mutable double fQInvCalc;    // cached QInv()
+  mutable double fKTCalc;      // cached KT()
+  mutable double fMInvCalc;    // cached MInv()
+  mutable double fQOutCMSCalc; // cached QOutCMS()
+  mutable double fQSideCMSCalc; // cached QSideCMS()
+  mutable double fQLongCMSCalc; // cached QLongCMS()
+  double CalcQInv() const;
+  double CalcKT() const;
+  double CalcMInv() const;
+  double CalcQOutCMS() const;
+  double CalcQSideCMS() const;
+  double CalcQLongCMS() const;
+
   mutable short fNonIdParNotCalculated; // Set to 1 when NonId variables (kstar) have been already calculated for this pair
   mutable double fDKSide; // momemntum of first particle in PRF - k* side component
   mutable double fDKOut;  // momemntum of first particle in PRF - k* out component
@@ -304,6 +328,7 @@ private:
 };
 
 inline void AliFemtoPair::ResetParCalculated(){
+  fKinematicsCalculated=0;
   fNonIdParNotCalculated=1;
   fNonIdParNotCalculatedGlobal=1;
   fMergingParNotCalculated=1;
@@ -347,9 +372,51 @@ inline double AliFemtoPair::KStar() const{
   if(fNonIdParNotCalculated) CalcNonIdPar();
   return fKStarCalc;
 }
+
+// The kinematic variables below are evaluated on first use and kept until
+// one of the tracks is changed, so that the pair cut and all correlation
+// functions receiving the pair share a single calculation.
 inline double AliFemtoPair::QInv() const {
-  AliFemtoLorentzVector tDiff = (fTrack1->FourMomentum()-fTrack2->FourMomentum());
-  return -tDiff.m();
+  if (!(fKinematicsCalculated & kQInvCalculated)) {
+    fQInvCalc = CalcQInv();
+    fKinematicsCalculated |= kQInvCalculated;
+  }
+  return fQInvCalc;
+}
+inline double AliFemtoPair::KT() const {
+  if (!(fKinematicsCalculated & kKTCalculated)) {
+    fKTCalc = CalcKT();
+    fKinematicsCalculated |= kKTCalculated;
+  }
+  return fKTCalc;
+}
+inline double AliFemtoPair::MInv() const {
+  if (!(fKinematicsCalculated & kMInvCalculated)) {
+    fMInvCalc = CalcMInv();
+    fKinematicsCalculated |= kMInvCalculated;
+  }
+  return fMInvCalc;
+}
+inline double AliFemtoPair::QOutCMS() const {
+  if (!(fKinematicsCalculated & kQOutCMSCalculated)) {
+    fQOutCMSCalc = CalcQOutCMS();
+    fKinematicsCalculated |= kQOutCMSCalculated;
+  }
+  return fQOutCMSCalc;
+}
+inline double AliFemtoPair::QSideCMS() const {
+  if (!(fKinematicsCalculated & kQSideCMSCalculated)) {
+    fQSideCMSCalc = CalcQSideCMS();
+    fKinematicsCalculated |= kQSideCMSCalculated;
+  }
+  return fQSideCMSCalc;
+}
+inline double AliFemtoPair::QLongCMS() const {
+  if (!(fKinematicsCalculated & kQLongCMSCalculated)) {
+    fQLongCMSCalc = CalcQLongCMS();
+    fKinematicsCalculated |= kQLongCMSCalculated;
+  }
+  return fQLongCMSCalc;
 }
 
 // Fabrice private <<<
@@ -0,0 +1,126 @@
+///
+/// \file AliFemtoPairBatch.h
+///
+
+#ifndef ALIFEMTOPAIRBATCH_H
+#define ALIFEMTOPAIRBATCH_H
+
+#include <vector>
+
+#include "AliFemtoPair.h"
+
+
+/// \class AliFemtoPairBatch
+/// \brief Kinematic variables of a block of pairs which passed the pair cut
+///
+/// Filled by AliFemtoSimpleAnalysis::MakePairs for the correlation functions
+/// accepting pair batches (see AliFemtoCorrFctn::AcceptsPairBatch), which are
+/// then called once per block instead of once per pair. The variables are
+/// stored in parallel arrays, indexed by the position of the pair in the
+/// batch, and are taken from the memoized values of AliFemtoPair.
+/// Only the columns selected with SetColumns are filled, the accessors of
+/// the other columns return empty arrays.
+///
+class AliFemtoPairBatch {
+public:
+
+  /// Columns of the batch, to be combined in a bit mask
+  enum EColumn {
+    kQInv  = 1 << 0,
+    kKStar = 1 << 1,
+    kKT    = 1 << 2,
+    kMInv  = 1 << 3,
+    kQCMS  = 1 << 4,  ///< QOutCMS, QSideCMS and QLongCMS
+    kAllColumns = kQInv | kKStar | kKT | kMInv | kQCMS
+  };
+
+  AliFemtoPairBatch();
+
+  /// Select the columns filled by Add; the batch is cleared
+  void SetColumns(unsigned int columns);
+  unsigned int GetColumns() const { return fColumns; }
+
+  /// Remove all pairs, keeping the allocated memory
+  void Clear();
+
+  /// Append the kinematic variables of the pair
+  void Add(const AliFemtoPair &pair);
+
+  size_t Size() const { return fSize; }
+  bool Empty() const { return fSize == 0; }
+
+  const double* QInv() const { return fQInv.data(); }
+  const double* KStar() const { return fKStar.data(); }
+  const double* KT() const { return fKT.data(); }
+  const double* MInv() const { return fMInv.data(); }
+  const double* QOutCMS() const { return fQOutCMS.data(); }
+  const double* QSideCMS() const { return fQSideCMS.data(); }
+  const double* QLongCMS() const { return fQLongCMS.data(); }
+
+private:
+
+  unsigned int fColumns;         ///< columns filled by Add
+  size_t fSize;                  ///< number of pairs
+  std::vector<double> fQInv;     ///< AliFemtoPair::QInv
+  std::vector<double> fKStar;    ///< AliFemtoPair::KStar
+  std::vector<double> fKT;       ///< AliFemtoPair::KT
+  std::vector<double> fMInv;     ///< AliFemtoPair::MInv
+  std::vector<double> fQOutCMS;  ///< AliFemtoPair::QOutCMS
+  std::vector<double> fQSideCMS; ///< AliFemtoPair::QSideCMS
+  std::vector<double> fQLongCMS; ///< AliFemtoPair::QLongCMS
+};
+
+inline AliFemtoPairBatch::AliFemtoPairBatch():
+  fColumns(kAllColumns),
+  fSize(0),
+  fQInv(),
+  fKStar(),
+  fKT(),
+  fMInv(),
+  fQOutCMS(),
+  fQSideCMS(),
+  fQLongCMS()
+{ /* no-op */
+}
+
+inline void AliFemtoPairBatch::SetColumns(unsigned int columns)
+{
+  fColumns = columns;
+  Clear();
+}
+
+inline void AliFemtoPairBatch::Clear()
+{
+  fSize = 0;
+  fQInv.clear();
+  fKStar.clear();
+  fKT.clear();
+  fMInv.clear();
+  fQOutCMS.clear();
+  fQSideCMS.clear();
+  fQLongCMS.clear();
+}
+
+inline void AliFemtoPairBatch::Add(const AliFemtoPair &pair)
+{
+  if (fColumns & kQInv) {
+    fQInv.push_back(pair.QInv());
+  }
+  if (fColumns & kKStar) {
+    fKStar.push_back(pair.KStar());
+  }
+  if (fColumns & kKT) {
+    fKT.push_back(pair.KT());
+  }
+  if (fColumns & kMInv) {
+    fMInv.push_back(pair.MInv());
+  }
+  if (fColumns & kQCMS) {
+    fQOutCMS.push_back(pair.QOutCMS());
+    fQSideCMS.push_back(pair.QSideCMS());
+    fQLongCMS.push_back(pair.QLongCMS());
+  }
+  ++fSize;
+}
+
+#endif  // ALIFEMTOPAIRBATCH_H
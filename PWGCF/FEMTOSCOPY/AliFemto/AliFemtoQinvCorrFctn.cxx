@@ -245,6 +245,40 @@ void AliFemtoQinvCorrFctn::AddMixedPair(AliFemtoPair* pair)
   }
 }
 
+//____________________________
+bool AliFemtoQinvCorrFctn::AcceptsPairBatch() const
+{
+  return !fPairCut && !fDetaDphiscal && !fPairKinematics;
+}
+
+//____________________________
+unsigned int AliFemtoQinvCorrFctn::PairBatchColumns() const
+{
+  return AliFemtoPairBatch::kQInv | AliFemtoPairBatch::kKT;
+}
+
+//____________________________
+void AliFemtoQinvCorrFctn::AddRealPairs(const AliFemtoPairBatch &batch)
+{
+  // add a batch of true pairs
+  const double *qinv = batch.QInv();
+  for (size_t i = 0; i < batch.Size(); ++i) {
+    fNumerator->Fill(fabs(qinv[i]));
+  }
+
+  fkTMonitor->FillN(batch.Size(), batch.KT(), nullptr);
+}
+
+//____________________________
+void AliFemtoQinvCorrFctn::AddMixedPairs(const AliFemtoPairBatch &batch)
+{
+  // add a batch of mixed (background) pairs
+  const double *qinv = batch.QInv();
+  for (size_t i = 0; i < batch.Size(); ++i) {
+    fDenominator->Fill(fabs(qinv[i]));
+  }
+}
+
 void AliFemtoQinvCorrFctn::Write()
 {
   // Write out neccessary objects
@@ -66,6 +66,12 @@ public:
   virtual void AddRealPair(AliFemtoPair* aPair);
   virtual void AddMixedPair(AliFemtoPair* aPair);
 
+  /// Batches are used when no pair cut, (Δη, Δϕ*) or pair kinematics output is requested
+  virtual bool AcceptsPairBatch() const;
+  virtual unsigned int PairBatchColumns() const;
+  virtual void AddRealPairs(const AliFemtoPairBatch &batch);
+  virtual void AddMixedPairs(const AliFemtoPairBatch &batch);
+
   virtual void Finish();
 
   void CalculateDetaDphis(Bool_t, Double_t);
@@ -183,7 +183,10 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis():
   fMinSizePartCollection(0),
   fVerbose(kTRUE),
   fPerformSharedDaughterCut(kFALSE),
-  fEnablePairMonitors(kFALSE)
+  fEnablePairMonitors(kFALSE),
+  fPairCorrFctns(),
+  fBatchCorrFctns(),
+  fPairBatch()
 {
   // Default constructor
   fCorrFctnCollection = new AliFemtoCorrFctnCollection;
@@ -205,7 +208,10 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis(const AliFemtoSimpleAnalysis& a):
   fMinSizePartCollection(a.fMinSizePartCollection),
   fVerbose(a.fVerbose),
   fPerformSharedDaughterCut(a.fPerformSharedDaughterCut),
-  fEnablePairMonitors(a.fEnablePairMonitors)
+  fEnablePairMonitors(a.fEnablePairMonitors),
+  fPairCorrFctns(),
+  fBatchCorrFctns(),
+  fPairBatch()
 {
   /// Copy constructor
 
@@ -620,6 +626,24 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
     tEndInnerLoop = partCollection1->end() ;     //   Inner loop goes to last particle
   }
 
+  // Split the correlation functions by the way they receive the pairs
+  fPairCorrFctns.clear();
+  fBatchCorrFctns.clear();
+  unsigned int tBatchColumns = 0;
+  for (auto &tCorrFctn : *fCorrFctnCollection) {
+    if (tCorrFctn->AcceptsPairBatch()) {
+      fBatchCorrFctns.push_back(tCorrFctn);
+      tBatchColumns |= tCorrFctn->PairBatchColumns();
+    } else {
+      fPairCorrFctns.push_back(tCorrFctn);
+    }
+  }
+  // only compute the variables read by the batch CFs
+  fPairBatch.SetColumns(tBatchColumns);
+
+  // Number of pairs collected before passing them to the batch CFs
+  const size_t kPairBatchSize = 1024;
+
   // Create the pair outside the loop - only allocate once
   AliFemtoPair* tPair = new AliFemtoPair;
 
@@ -664,22 +688,48 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
       }
 
       // If pair passes cut, loop over CF's and add pair to real/mixed
+      // the kinematics of the pair are computed once and shared by all CFs
       if (tmpPassPair) {
-        for (auto &tCorrFctn : *fCorrFctnCollection) {
+        for (auto &tCorrFctn : fPairCorrFctns) {
           if (these_are_real_pairs)
             tCorrFctn->AddRealPair(tPair);
           else
             tCorrFctn->AddMixedPair(tPair);
         } // loop over correlation functions
+
+        if (!fBatchCorrFctns.empty()) {
+          fPairBatch.Add(*tPair);
+          if (fPairBatch.Size() >= kPairBatchSize) {
+            FlushPairBatch(these_are_real_pairs);
+          }
+        }
       }
 
     }    // loop over second particle
   }      // loop over first particle
 
+  FlushPairBatch(these_are_real_pairs);
+
   // we are done with the pair
   delete tPair;
 }
 //_________________________
+void AliFemtoSimpleAnalysis::FlushPairBatch(bool realPairs)
+{
+  if (fPairBatch.Empty()) {
+    return;
+  }
+
+  for (auto &tCorrFctn : fBatchCorrFctns) {
+    if (realPairs)
+      tCorrFctn->AddRealPairs(fPairBatch);
+    else
+      tCorrFctn->AddMixedPairs(fPairBatch);
+  }
+
+  fPairBatch.Clear();
+}
+//_________________________
 void AliFemtoSimpleAnalysis::EventBegin(const AliFemtoEvent* ev)
 {
   /// Perform initialization operations at the beginning of the event processing
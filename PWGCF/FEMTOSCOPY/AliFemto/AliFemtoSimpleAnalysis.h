@@ -11,6 +11,7 @@
 #include "AliFemtoParticleCut.h"
 #include "AliFemtoCorrFctn.h"
 #include "AliFemtoCorrFctnCollection.h"
+#include "AliFemtoPairBatch.h"
 #include "AliFemtoPicoEventCollection.h"
 #include "AliFemtoParticleCollection.h"
 #include "AliFemtoV0SharedDaughterCut.h"
@@ -152,6 +153,9 @@ protected:
   /// AddMixedPair() methods. If no second particle collection is
   /// specfied, make pairs within first particle collection.
   ///
+  /// Correlation functions accepting pair batches get the accepted
+  /// pairs by blocks through AddRealPairs() or AddMixedPairs().
+  ///
   /// \param type Either the string "real" or "mixed", specifying which method
   ///             to call (AddRealPair or AddMixedPair)
   void MakePairs(const char* type,
@@ -178,6 +182,13 @@ protected:
   Bool_t fPerformSharedDaughterCut;
   Bool_t fEnablePairMonitors;
 
+  std::vector<AliFemtoCorrFctn*> fPairCorrFctns;  //!<! correlation functions called once per pair, filled in MakePairs
+  std::vector<AliFemtoCorrFctn*> fBatchCorrFctns; //!<! correlation functions accepting pair batches, filled in MakePairs
+  AliFemtoPairBatch fPairBatch;                   //!<! pairs waiting to be passed to fBatchCorrFctns
+
+  /// Pass the pending pairs to the correlation functions accepting batches
+  void FlushPairBatch(bool realPairs);
+
 #ifdef __ROOT__
   /// \cond CLASSIMP
   ClassDef(AliFemtoSimpleAnalysis, 0);
@@ -83,7 +83,7 @@ class AliFemtoDreamBasePart {
     fEta.push_back(eta);
   }
   ;
-  std::vector<float> GetEta() const {
+  const std::vector<float> &GetEta() const {
     return fEta;
   }
   ;
@@ -107,7 +107,7 @@ class AliFemtoDreamBasePart {
     fPhi.push_back(phi);
   }
   ;
-  std::vector<float> GetPhi() const {
+  const std::vector<float> &GetPhi() const {
     return fPhi;
   }
   ;
@@ -115,7 +115,7 @@ class AliFemtoDreamBasePart {
     fPhiAtRadius.push_back(phiAtRad);
   }
   ;
-  std::vector<std::vector<float>> GetPhiAtRaidius() const {
+  const std::vector<std::vector<float>> &GetPhiAtRaidius() const {
     return fPhiAtRadius;
   }
   ;
@@ -12,12 +12,16 @@
 ClassImp(AliFemtoDreamPartContainer)
 AliFemtoDreamPartContainer::AliFemtoDreamPartContainer()
     : fPartBuffer(),
+      fFirstEvent(0),
+      fNEvents(0),
       fMixingDepth(0) {
 
 }
 
 AliFemtoDreamPartContainer::AliFemtoDreamPartContainer(int MixingDepth)
     : fPartBuffer(),
+      fFirstEvent(0),
+      fNEvents(0),
       fMixingDepth(MixingDepth) {
 
 }
@@ -27,48 +31,66 @@ AliFemtoDreamPartContainer& AliFemtoDreamPartContainer::operator=(
   if (this == &obj) {
     return *this;
   }
-//  std::deque<std::deque<AliFemtoDreamBasePart>>::iterator copyIter;
-//  std::deque<std::deque<AliFemtoDreamBasePart>>::iterator objIter;
-//  for (objIter=obj.fPartBuffer.begin();objIter!=obj.fPartBuffer.end();
-//      ++objIter)
-//  {
-//
-//  }
   this->fMixingDepth = obj.fMixingDepth;
   this->fPartBuffer = obj.fPartBuffer;
+  this->fFirstEvent = obj.fFirstEvent;
+  this->fNEvents = obj.fNEvents;
   return (*this);
 }
 
 AliFemtoDreamPartContainer::~AliFemtoDreamPartContainer() {
 }
 
+AliFemtoDreamPartStore &AliFemtoDreamPartContainer::NextSlot() {
+  //Slot for the new event: the next free one, or the one of the oldest
+  //event once the buffer is full
+  if (fPartBuffer.size() != fMixingDepth) {
+    fPartBuffer.resize(fMixingDepth);
+  }
+  unsigned int slot;
+  if (fNEvents < fMixingDepth) {
+    slot = (fFirstEvent + fNEvents) % fMixingDepth;
+    fNEvents++;
+  } else {
+    slot = fFirstEvent;
+    fFirstEvent = (fFirstEvent + 1) % fMixingDepth;
+  }
+  return fPartBuffer[slot];
+}
+
 void AliFemtoDreamPartContainer::SetEvent(
     std::vector<AliFemtoDreamBasePart> &Particles) {
-  if (!(fPartBuffer.size() < fMixingDepth)) {
-//    std::cout << "Popping Front" << std::endl;
-    fPartBuffer.pop_front();
+  if (fMixingDepth == 0) {
+    return;
+  }
+  NextSlot().Fill(Particles);
+  return;
+}
+
+void AliFemtoDreamPartContainer::SetEvent(AliFemtoDreamPartStore &Event) {
+  //The store of the event is swapped into the buffer, Event gets the
+  //memory of the dropped event to be refilled
+  if (fMixingDepth == 0) {
+    return;
   }
-  fPartBuffer.push_back(Particles);
-//  std::cout << "PartBuffer Size: "<<fPartBuffer.size()<<'\t'<<"Input Size: "
-//      << Particles.size() << '\n';
+  NextSlot().Swap(Event);
   return;
 }
 
 void AliFemtoDreamPartContainer::PrintLastEvent() {
-  for (std::deque<std::vector<AliFemtoDreamBasePart>>::iterator itEvt =
-      fPartBuffer.begin(); itEvt != fPartBuffer.end(); ++itEvt) {
-    std::cout << "Printing Last Event with size: " << itEvt->size() << '\n';
-    for (std::vector<AliFemtoDreamBasePart>::iterator itPart = itEvt->begin();
-        itPart != itEvt->end(); ++itPart) {
-      TVector3 P(itPart->GetMomentum());
+  for (unsigned int iDepth = 0; iDepth < fNEvents; ++iDepth) {
+    const AliFemtoDreamPartStore &evt = GetEvent(iDepth);
+    std::cout << "Printing Last Event with size: " << evt.GetNParticles()
+              << '\n';
+    for (unsigned int iPart = 0; iPart < evt.GetNParticles(); ++iPart) {
+      TVector3 P(evt.GetMomentum(iPart));
       std::cout << "Px: " << P.X() << '\t' << "Py: " << P.Y() << '\t' << "Pz: "
                 << P.Z() << std::endl;
     }
   }
 }
-std::vector<AliFemtoDreamBasePart> &AliFemtoDreamPartContainer::GetEvent(
-    int Depth) {
-  std::deque<std::vector<AliFemtoDreamBasePart>>::iterator itEvt = fPartBuffer
-      .begin() + Depth;
-  return *itEvt;
+const AliFemtoDreamPartStore &AliFemtoDreamPartContainer::GetEvent(
+    int Depth) const {
+  //Depth 0 is the oldest event in the buffer
+  return fPartBuffer[(fFirstEvent + Depth) % fMixingDepth];
 }
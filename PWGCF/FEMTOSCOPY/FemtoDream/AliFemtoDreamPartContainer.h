@@ -7,15 +7,17 @@
 
 #ifndef ALIFEMTODREAMPARTCONTAINER_H_
 #define ALIFEMTODREAMPARTCONTAINER_H_
-#include <deque>
 #include <vector>
 #include "Rtypes.h"
 
 #include "AliFemtoDreamBasePart.h"
+#include "AliFemtoDreamPartStore.h"
 
 //Class Containing the Particles from previous Events up to a certain mixing
 //depth for one Particle Species and Mult/ZVtx Bin
 //ZVtx bin.
+//The events are kept in a ring buffer of flat stores, the slot of the oldest
+//event is recycled for the new one.
 class AliFemtoDreamPartContainer {
  public:
   AliFemtoDreamPartContainer();
@@ -24,18 +26,18 @@ class AliFemtoDreamPartContainer {
   virtual ~AliFemtoDreamPartContainer();
   void PrintLastEvent();
   void SetEvent(std::vector<AliFemtoDreamBasePart> &Particles);
-  std::deque<std::vector<AliFemtoDreamBasePart>> GetEventBuffer() const {
-    return fPartBuffer;
-  }
-  ;
-  std::vector<AliFemtoDreamBasePart> &GetEvent(int Depth);
+  void SetEvent(AliFemtoDreamPartStore &Event);
+  const AliFemtoDreamPartStore &GetEvent(int Depth) const;
   unsigned int GetMixingDepth() const {
-    return fPartBuffer.size();
+    return fNEvents;
   }
   ;
  private:
-  std::deque<std::vector<AliFemtoDreamBasePart>> fPartBuffer;
-  unsigned int fMixingDepth;ClassDef(AliFemtoDreamPartContainer,2)
+  AliFemtoDreamPartStore &NextSlot();
+  std::vector<AliFemtoDreamPartStore> fPartBuffer;
+  unsigned int fFirstEvent;
+  unsigned int fNEvents;
+  unsigned int fMixingDepth;ClassDef(AliFemtoDreamPartContainer,3)
   ;
 };
 
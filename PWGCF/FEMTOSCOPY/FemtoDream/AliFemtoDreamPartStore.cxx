@@ -0,0 +1,158 @@
+/*
+ * AliFemtoDreamPartStore.cxx
+ *
+ *  Flat per-event store of the particles of one species
+ */
+
+#include <cmath>
+#include "AliFemtoDreamPartStore.h"
+#include "TMath.h"
+ClassImp(AliFemtoDreamPartStore)
+
+static const float kTwoPiStore = 2.f * TMath::Pi();
+static const float kInvTwoPiStore = 1.f / kTwoPiStore;
+
+AliFemtoDreamPartStore::AliFemtoDreamPartStore()
+    : fPx(),
+      fPy(),
+      fPz(),
+      fMCPx(),
+      fMCPy(),
+      fMCPz(),
+      fMCPDGCode(),
+      fPt(),
+      fInvMass(),
+      fPhi(),
+      fEtaOffset(1, 0),
+      fEta(),
+      fDaugOffset(1, 0),
+      fDaugEta(),
+      fRadOffset(1, 0),
+      fPhiAtRad() {
+}
+
+AliFemtoDreamPartStore::~AliFemtoDreamPartStore() {
+}
+
+void AliFemtoDreamPartStore::Clear() {
+  //Keeps the allocated memory, the store is refilled every event
+  fPx.clear();
+  fPy.clear();
+  fPz.clear();
+  fMCPx.clear();
+  fMCPy.clear();
+  fMCPz.clear();
+  fMCPDGCode.clear();
+  fPt.clear();
+  fInvMass.clear();
+  fPhi.clear();
+  fEtaOffset.assign(1, 0);
+  fEta.clear();
+  fDaugOffset.assign(1, 0);
+  fDaugEta.clear();
+  fRadOffset.assign(1, 0);
+  fPhiAtRad.clear();
+}
+
+void AliFemtoDreamPartStore::Swap(AliFemtoDreamPartStore &other) {
+  //Exchanges the content without copying the arrays
+  fPx.swap(other.fPx);
+  fPy.swap(other.fPy);
+  fPz.swap(other.fPz);
+  fMCPx.swap(other.fMCPx);
+  fMCPy.swap(other.fMCPy);
+  fMCPz.swap(other.fMCPz);
+  fMCPDGCode.swap(other.fMCPDGCode);
+  fPt.swap(other.fPt);
+  fInvMass.swap(other.fInvMass);
+  fPhi.swap(other.fPhi);
+  fEtaOffset.swap(other.fEtaOffset);
+  fEta.swap(other.fEta);
+  fDaugOffset.swap(other.fDaugOffset);
+  fDaugEta.swap(other.fDaugEta);
+  fRadOffset.swap(other.fRadOffset);
+  fPhiAtRad.swap(other.fPhiAtRad);
+}
+
+void AliFemtoDreamPartStore::Fill(
+    const std::vector<AliFemtoDreamBasePart> &Particles) {
+  Clear();
+  for (auto itPart = Particles.begin(); itPart != Particles.end(); ++itPart) {
+    const TVector3 &mom = itPart->GetMomentum();
+    fPx.push_back(mom.X());
+    fPy.push_back(mom.Y());
+    fPz.push_back(mom.Z());
+    const TVector3 &momMC = itPart->GetMCMomentum();
+    fMCPx.push_back(momMC.X());
+    fMCPy.push_back(momMC.Y());
+    fMCPz.push_back(momMC.Z());
+    fMCPDGCode.push_back(itPart->GetMCPDGCode());
+    fPt.push_back(itPart->GetPt());
+    fInvMass.push_back(itPart->GetInvMass());
+
+    const std::vector<float> &phi = itPart->GetPhi();
+    fPhi.push_back(phi.size() > 0 ? phi[0] : 0.f);
+    const std::vector<float> &eta = itPart->GetEta();
+    fEta.insert(fEta.end(), eta.begin(), eta.end());
+    fEtaOffset.push_back(fEta.size());
+
+    //Single track: eta of the particle, decay: eta of the daughters which
+    //follow the one of the mother
+    const std::vector<std::vector<float>> &phiAtRad = itPart->GetPhiAtRaidius();
+    const unsigned int nDaug = phiAtRad.size();
+    for (unsigned int iDaug = 0; iDaug < nDaug; ++iDaug) {
+      const unsigned int iEta = (nDaug == 1) ? 0 : iDaug + 1;
+      fDaugEta.push_back(iEta < eta.size() ? eta[iEta] : 0.f);
+      fPhiAtRad.insert(fPhiAtRad.end(), phiAtRad[iDaug].begin(),
+                       phiAtRad[iDaug].end());
+      fRadOffset.push_back(fPhiAtRad.size());
+    }
+    fDaugOffset.push_back(fDaugEta.size());
+  }
+}
+
+float AliFemtoDreamPartStore::MinDeltaPhiSquared(const float *phi1,
+                                                 const float *phi2,
+                                                 unsigned int nRad) {
+  //Branch free loop over the contiguous radii, the compiler can vectorize
+  //it. dphi is brought in [-pi,pi]
+  float minDphi2 = 100.f;
+  for (unsigned int iRad = 0; iRad < nRad; ++iRad) {
+    float dphi = phi1[iRad] - phi2[iRad];
+    dphi -= kTwoPiStore * std::floor(dphi * kInvTwoPiStore + 0.5f);
+    const float dphi2 = dphi * dphi;
+    minDphi2 = (dphi2 < minDphi2) ? dphi2 : minDphi2;
+  }
+  return minDphi2;
+}
+
+bool AliFemtoDreamPartStore::RejectClosePairs(
+    const AliFemtoDreamPartStore &store1, unsigned int i1,
+    const AliFemtoDreamPartStore &store2, unsigned int i2,
+    float deltaPhiEtaMax2) {
+  //Method calculates the separation between two tracks at different radii
+  //within the TPC and returns false (pair rejected) if for any combination
+  //of daughters it is below the cut at any radius. The radii are only
+  //looked at if the daughters are close enough in eta.
+  const unsigned int nDaug1 = store1.GetNDaughters(i1);
+  const unsigned int nDaug2 = store2.GetNDaughters(i2);
+  for (unsigned int iDaug1 = 0; iDaug1 < nDaug1; ++iDaug1) {
+    const float eta1 = store1.GetDaughterEta(i1, iDaug1);
+    const unsigned int nRad1 = store1.GetNRadii(i1, iDaug1);
+    const float *phi1 = store1.GetPhiAtRadii(i1, iDaug1);
+    for (unsigned int iDaug2 = 0; iDaug2 < nDaug2; ++iDaug2) {
+      const float deta = eta1 - store2.GetDaughterEta(i2, iDaug2);
+      const float deta2 = deta * deta;
+      if (!(deta2 < deltaPhiEtaMax2)) {
+        continue;
+      }
+      const unsigned int nRad2 = store2.GetNRadii(i2, iDaug2);
+      const unsigned int nRad = nRad1 < nRad2 ? nRad1 : nRad2;
+      if (MinDeltaPhiSquared(phi1, store2.GetPhiAtRadii(i2, iDaug2), nRad)
+          + deta2 < deltaPhiEtaMax2) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
@@ -0,0 +1,108 @@
+/*
+ * AliFemtoDreamPartStore.h
+ *
+ *  Flat per-event store of the particles of one species
+ */
+
+#ifndef ALIFEMTODREAMPARTSTORE_H_
+#define ALIFEMTODREAMPARTSTORE_H_
+#include <vector>
+#include "Rtypes.h"
+#include "TVector3.h"
+
+#include "AliFemtoDreamBasePart.h"
+
+//Structure of arrays with the pair kinematics and the phi* of the daughters
+//at the TPC radii of the particles of one species in one event. Particles
+//are referenced by index, the store is filled once per event and then
+//recycled in the mixing buffer without copying AliFemtoDreamBasePart objects.
+class AliFemtoDreamPartStore {
+ public:
+  AliFemtoDreamPartStore();
+  virtual ~AliFemtoDreamPartStore();
+  void Fill(const std::vector<AliFemtoDreamBasePart> &Particles);
+  void Clear();
+  void Swap(AliFemtoDreamPartStore &other);
+  unsigned int GetNParticles() const {
+    return fPx.size();
+  }
+  ;
+  TVector3 GetMomentum(unsigned int i) const {
+    return TVector3(fPx[i], fPy[i], fPz[i]);
+  }
+  ;
+  TVector3 GetMCMomentum(unsigned int i) const {
+    return TVector3(fMCPx[i], fMCPy[i], fMCPz[i]);
+  }
+  ;
+  int GetMCPDGCode(unsigned int i) const {
+    return fMCPDGCode[i];
+  }
+  ;
+  float GetPt(unsigned int i) const {
+    return fPt[i];
+  }
+  ;
+  float GetInvMass(unsigned int i) const {
+    return fInvMass[i];
+  }
+  ;
+  // entries of AliFemtoDreamBasePart::GetEta() and GetPhi()
+  unsigned int GetNEta(unsigned int i) const {
+    return fEtaOffset[i + 1] - fEtaOffset[i];
+  }
+  ;
+  float GetEta(unsigned int i, unsigned int iEta = 0) const {
+    return (iEta < GetNEta(i)) ? fEta[fEtaOffset[i] + iEta] : 0.f;
+  }
+  ;
+  float GetPhi(unsigned int i) const {
+    return fPhi[i];
+  }
+  ;
+  // daughters, as in AliFemtoDreamBasePart::GetPhiAtRaidius()
+  unsigned int GetNDaughters(unsigned int i) const {
+    return fDaugOffset[i + 1] - fDaugOffset[i];
+  }
+  ;
+  float GetDaughterEta(unsigned int i, unsigned int iDaug) const {
+    return fDaugEta[fDaugOffset[i] + iDaug];
+  }
+  ;
+  unsigned int GetNRadii(unsigned int i, unsigned int iDaug) const {
+    const unsigned int iD = fDaugOffset[i] + iDaug;
+    return fRadOffset[iD + 1] - fRadOffset[iD];
+  }
+  ;
+  const float *GetPhiAtRadii(unsigned int i, unsigned int iDaug) const {
+    return fPhiAtRad.data() + fRadOffset[fDaugOffset[i] + iDaug];
+  }
+  ;
+  static bool RejectClosePairs(const AliFemtoDreamPartStore &store1,
+                               unsigned int i1,
+                               const AliFemtoDreamPartStore &store2,
+                               unsigned int i2, float deltaPhiEtaMax2);
+ private:
+  static float MinDeltaPhiSquared(const float *phi1, const float *phi2,
+                                  unsigned int nRad);
+  std::vector<double> fPx;
+  std::vector<double> fPy;
+  std::vector<double> fPz;
+  std::vector<double> fMCPx;
+  std::vector<double> fMCPy;
+  std::vector<double> fMCPz;
+  std::vector<int> fMCPDGCode;
+  std::vector<float> fPt;
+  std::vector<float> fInvMass;
+  std::vector<float> fPhi;              // first entry of GetPhi()
+  std::vector<unsigned int> fEtaOffset; // size NParticles+1
+  std::vector<float> fEta;              // all entries of GetEta()
+  std::vector<unsigned int> fDaugOffset; // size NParticles+1
+  std::vector<float> fDaugEta;          // eta used for the close pair rejection
+  std::vector<unsigned int> fRadOffset; // size NDaughters+1
+  std::vector<float> fPhiAtRad;         // phi* of all daughters at all radii
+ClassDef(AliFemtoDreamPartStore, 1)
+  ;
+};
+
+#endif /* ALIFEMTODREAMPARTSTORE_H_ */
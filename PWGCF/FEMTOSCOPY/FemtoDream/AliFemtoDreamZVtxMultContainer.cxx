@@ -9,13 +9,15 @@
 #include "AliFemtoDreamZVtxMultContainer.h"
 #include "TLorentzVector.h"
 #include "TDatabasePDG.h"
-#include "TVector2.h"
 
 ClassImp(AliFemtoDreamPartContainer)
 static const float piHi = TMath::Pi();
 AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer()
     : fPartContainer(0),
+      fCurrentEvent(),
+      fCurrentEventSet(false),
       fPDGParticleSpecies(0),
+      fMassParticleSpecies(),
       fWhichPairs(),
       fRejPairs(),
       fDeltaEtaMax(0.f),
@@ -31,7 +33,10 @@ AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer(
     AliFemtoDreamCollConfig *conf)
     : fPartContainer(conf->GetNParticles(),
                      AliFemtoDreamPartContainer(conf->GetMixingDepth())),
+      fCurrentEvent(),
+      fCurrentEventSet(false),
       fPDGParticleSpecies(conf->GetPDGCodes()),
+      fMassParticleSpecies(),
       fWhichPairs(conf->GetWhichPairs()),
       fRejPairs(conf->GetClosePairRej()),
       fDeltaEtaMax(conf->GetDeltaEtaMax()),
@@ -52,76 +57,96 @@ void AliFemtoDreamZVtxMultContainer::SetEvent(
     std::vector<std::vector<AliFemtoDreamBasePart>> &Particles) {
   //This method sets the particles of an event only in the case, that
   //more than one particle was identified, to avoid empty events.
-  //  if (Particles->size()!=fParticleSpecies){
-  //    TString errMessage = Form("Number of Input Particlese (%d) doese not"
-  //        "correspond to the Number of particles Set (%d)",Particles->size(),
-  //        fParticleSpecies);
-  //    AliFatal(errMessage.Data());
-  //  } else {
+  //The flat stores built for the pairing are moved to the mixing buffer.
+  if (!fCurrentEventSet) {
+    FillCurrentEvent(Particles);
+  }
   std::vector<std::vector<AliFemtoDreamBasePart>>::iterator itInput = Particles
       .begin();
+  std::vector<AliFemtoDreamPartStore>::iterator itStore = fCurrentEvent
+      .begin();
   std::vector<AliFemtoDreamPartContainer>::iterator itContainer = fPartContainer
       .begin();
   while (itContainer != fPartContainer.end()) {
     if (itInput->size() > 0) {
-      itContainer->SetEvent(*itInput);
+      itContainer->SetEvent(*itStore);
     }
     ++itInput;
+    ++itStore;
     ++itContainer;
   }
-  //  }
+  fCurrentEventSet = false;
+}
+
+void AliFemtoDreamZVtxMultContainer::FillCurrentEvent(
+    std::vector<std::vector<AliFemtoDreamBasePart>> &Particles) {
+  //Flat copy of the particles of the event, filled once and used for the
+  //same and mixed event pairing
+  if (fMassParticleSpecies.size() != fPDGParticleSpecies.size()) {
+    fMassParticleSpecies.clear();
+    for (auto itPDG = fPDGParticleSpecies.begin();
+        itPDG != fPDGParticleSpecies.end(); ++itPDG) {
+      TParticlePDG *pdgPart =
+          (*itPDG != 0) ? TDatabasePDG::Instance()->GetParticle(*itPDG) : 0;
+      if (!pdgPart) {
+        AliError("Invalid PDG Code");
+        fMassParticleSpecies.push_back(0.);
+      } else {
+        fMassParticleSpecies.push_back(pdgPart->Mass());
+      }
+    }
+  }
+  fCurrentEvent.resize(Particles.size());
+  for (unsigned int iSpec = 0; iSpec < Particles.size(); ++iSpec) {
+    fCurrentEvent[iSpec].Fill(Particles[iSpec]);
+  }
+  fCurrentEventSet = true;
 }
+
 void AliFemtoDreamZVtxMultContainer::PairParticlesSE(
     std::vector<std::vector<AliFemtoDreamBasePart>> &Particles,
     AliFemtoDreamCorrHists *ResultsHist, int iMult, float cent) {
+  FillCurrentEvent(Particles);
   float RelativeK = 0;
   int HistCounter = 0;
   //First loop over all the different Species
-  auto itPDGPar1 = fPDGParticleSpecies.begin();
-  for (auto itSpec1 = Particles.begin(); itSpec1 != Particles.end();
-      ++itSpec1) {
-    auto itPDGPar2 = fPDGParticleSpecies.begin();
-    itPDGPar2 += itSpec1 - Particles.begin();
-    for (auto itSpec2 = itSpec1; itSpec2 != Particles.end(); ++itSpec2) {
-      ResultsHist->FillPartnersSE(HistCounter, itSpec1->size(),
-                                  itSpec2->size());
+  for (unsigned int iSpec1 = 0; iSpec1 < Particles.size(); ++iSpec1) {
+    const AliFemtoDreamPartStore &evt1 = fCurrentEvent[iSpec1];
+    const double mass1 = fMassParticleSpecies[iSpec1];
+    for (unsigned int iSpec2 = iSpec1; iSpec2 < Particles.size(); ++iSpec2) {
+      const AliFemtoDreamPartStore &evt2 = fCurrentEvent[iSpec2];
+      const double mass2 = fMassParticleSpecies[iSpec2];
+      ResultsHist->FillPartnersSE(HistCounter, evt1.GetNParticles(),
+                                  evt2.GetNParticles());
       //Now loop over the actual Particles and correlate them
       unsigned int DoThisPair = fWhichPairs.at(HistCounter);
       bool fillHists = DoThisPair > 0 ? true : false;
       bool CPR = fRejPairs.at(HistCounter);
-      for (auto itPart1 = itSpec1->begin(); itPart1 != itSpec1->end();
-          ++itPart1) {
-        AliFemtoDreamBasePart part1 = *itPart1;
-        std::vector<AliFemtoDreamBasePart>::iterator itPart2;
-        if (itSpec1 == itSpec2) {
-          itPart2 = itPart1 + 1;
-        } else {
-          itPart2 = itSpec2->begin();
-        }
-        while (itPart2 != itSpec2->end()) {
-          AliFemtoDreamBasePart part2 = *itPart2;
+      for (unsigned int iPart1 = 0; iPart1 < evt1.GetNParticles(); ++iPart1) {
+        const TVector3 mom1 = evt1.GetMomentum(iPart1);
+        unsigned int iPart2 = (iSpec1 == iSpec2) ? iPart1 + 1 : 0;
+        for (; iPart2 < evt2.GetNParticles(); ++iPart2) {
           // Delta eta - Delta phi* cut
           if (fDoDeltaEtaDeltaPhiCut && CPR) {
-            if (!RejectClosePairs(part1, part2)) {
-              ++itPart2;
+            if (!AliFemtoDreamPartStore::RejectClosePairs(evt1, iPart1, evt2,
+                                                          iPart2,
+                                                          fDeltaPhiEtaMax)) {
               continue;
             }
           }
-          RelativeK = RelativePairMomentum(itPart1->GetMomentum(), *itPDGPar1,
-                                           itPart2->GetMomentum(), *itPDGPar2);
+          const TVector3 mom2 = evt2.GetMomentum(iPart2);
+          RelativeK = RelativePairMomentum(mom1, mass1, mom2, mass2);
 
           if (fillHists && ResultsHist->GetEtaPhiPlots()) {
-            DeltaEtaDeltaPhi(HistCounter, part1, part2, true, ResultsHist,
-                             RelativeK);
+            DeltaEtaDeltaPhi(HistCounter, evt1, iPart1, evt2, iPart2, true,
+                             ResultsHist, RelativeK);
           }
           if (fillHists && ResultsHist->GetDodPhidEtaPlots()) {
-            float deta = itPart1->GetEta().at(0) - itPart2->GetEta().at(0);
-            float dphi = itPart1->GetPhi().at(0) - itPart2->GetPhi().at(0);
+            float deta = evt1.GetEta(iPart1) - evt2.GetEta(iPart2);
+            float dphi = evt1.GetPhi(iPart1) - evt2.GetPhi(iPart2);
             float mT =
                 ResultsHist->GetDodPhidEtamTPlots() ?
-                    RelativePairmT(itPart1->GetMomentum(), *itPDGPar1,
-                                   itPart2->GetMomentum(), *itPDGPar2) :
-                    0;
+                    RelativePairmT(mom1, mass1, mom2, mass2) : 0;
             if (dphi < 0) {
               ResultsHist->FilldPhidEtaSE(HistCounter, dphi + 2 * TMath::Pi(),
                                           deta, mT);
@@ -140,93 +165,90 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesSE(
           }
           if (fillHists && ResultsHist->GetDokTBinning()) {
             ResultsHist->FillSameEventkTDist(
-                HistCounter,
-                RelativePairkT(itPart1->GetMomentum(), *itPDGPar1,
-                               itPart2->GetMomentum(), *itPDGPar2),
+                HistCounter, RelativePairkT(mom1, mass1, mom2, mass2),
                 RelativeK, cent);
           }
           if (fillHists && ResultsHist->GetDomTBinning()) {
             ResultsHist->FillSameEventmTDist(
-                HistCounter,
-                RelativePairmT(itPart1->GetMomentum(), *itPDGPar1,
-                               itPart2->GetMomentum(), *itPDGPar2),
+                HistCounter, RelativePairmT(mom1, mass1, mom2, mass2),
                 RelativeK);
           }
           if (fillHists && ResultsHist->GetDoPtQA()) {
-            ResultsHist->FillPtQADist(HistCounter, RelativeK, itPart1->GetPt(),
-                                      itPart2->GetPt());
+            ResultsHist->FillPtQADist(HistCounter, RelativeK,
+                                      evt1.GetPt(iPart1), evt2.GetPt(iPart2));
           }
           if (fillHists && ResultsHist->GetDoMassQA()) {
             ResultsHist->FillMassQADist(HistCounter, RelativeK,
-                                        itPart1->GetInvMass(),
-                                        itPart2->GetInvMass());
-	    ResultsHist->FillPairInvMassQAD(HistCounter, part1, part2);
+                                        evt1.GetInvMass(iPart1),
+                                        evt2.GetInvMass(iPart2));
+            ResultsHist->FillPairInvMassQAD(HistCounter,
+                                            Particles[iSpec1][iPart1],
+                                            Particles[iSpec2][iPart2]);
 
           }
-          ++itPart2;
         }
       }
       ++HistCounter;
-      itPDGPar2++;
     }
-    itPDGPar1++;
   }
 }
 
 void AliFemtoDreamZVtxMultContainer::PairParticlesME(
     std::vector<std::vector<AliFemtoDreamBasePart>> &Particles,
     AliFemtoDreamCorrHists *ResultsHist, int iMult, float cent) {
+  if (!fCurrentEventSet) {
+    FillCurrentEvent(Particles);
+  }
   float RelativeK = 0;
   int HistCounter = 0;
-  auto itPDGPar1 = fPDGParticleSpecies.begin();
   //First loop over all the different Species
-  for (auto itSpec1 = Particles.begin(); itSpec1 != Particles.end();
-      ++itSpec1) {
+  for (unsigned int iSpec1 = 0; iSpec1 < Particles.size(); ++iSpec1) {
+    const AliFemtoDreamPartStore &evt1 = fCurrentEvent[iSpec1];
+    const double mass1 = fMassParticleSpecies[iSpec1];
+    const int pdg1 = fPDGParticleSpecies[iSpec1];
     //We dont want to correlate the particles twice. Mixed Event Dist. of
     //Particle1 + Particle2 == Particle2 + Particle 1
-    int SkipPart = itSpec1 - Particles.begin();
-    auto itPDGPar2 = fPDGParticleSpecies.begin() + SkipPart;
-    for (auto itSpec2 = fPartContainer.begin() + SkipPart;
-        itSpec2 != fPartContainer.end(); ++itSpec2) {
-      if (itSpec1->size() > 0) {
+    for (unsigned int iSpec2 = iSpec1; iSpec2 < fPartContainer.size();
+        ++iSpec2) {
+      const AliFemtoDreamPartContainer &mixCont = fPartContainer[iSpec2];
+      const double mass2 = fMassParticleSpecies[iSpec2];
+      const int pdg2 = fPDGParticleSpecies[iSpec2];
+      if (evt1.GetNParticles() > 0) {
         ResultsHist->FillEffectiveMixingDepth(HistCounter,
-                                              (int) itSpec2->GetMixingDepth());
+                                              (int) mixCont.GetMixingDepth());
       }
       unsigned int DoThisPair = fWhichPairs.at(HistCounter);
       bool fillHists = DoThisPair > 0 ? true : false;
       bool CPR = fRejPairs.at(HistCounter);
-      for (int iDepth = 0; iDepth < (int) itSpec2->GetMixingDepth(); ++iDepth) {
-        std::vector<AliFemtoDreamBasePart> ParticlesOfEvent = itSpec2->GetEvent(
-            iDepth);
-        ResultsHist->FillPartnersME(HistCounter, itSpec1->size(),
-                                    ParticlesOfEvent.size());
-        for (auto itPart1 = itSpec1->begin(); itPart1 != itSpec1->end();
-            ++itPart1) {
-          AliFemtoDreamBasePart part1 = *itPart1;
-          for (auto itPart2 = ParticlesOfEvent.begin();
-              itPart2 != ParticlesOfEvent.end(); ++itPart2) {
-            AliFemtoDreamBasePart part2 = *itPart2;
+      for (int iDepth = 0; iDepth < (int) mixCont.GetMixingDepth(); ++iDepth) {
+        const AliFemtoDreamPartStore &evt2 = mixCont.GetEvent(iDepth);
+        ResultsHist->FillPartnersME(HistCounter, evt1.GetNParticles(),
+                                    evt2.GetNParticles());
+        for (unsigned int iPart1 = 0; iPart1 < evt1.GetNParticles();
+            ++iPart1) {
+          const TVector3 mom1 = evt1.GetMomentum(iPart1);
+          for (unsigned int iPart2 = 0; iPart2 < evt2.GetNParticles();
+              ++iPart2) {
             // Delta eta - Delta phi* cut
             if (fDoDeltaEtaDeltaPhiCut && CPR) {
-              if (!RejectClosePairs(part1, part2)) {
+              if (!AliFemtoDreamPartStore::RejectClosePairs(evt1, iPart1, evt2,
+                                                            iPart2,
+                                                            fDeltaPhiEtaMax)) {
                 continue;
               }
             }
-            RelativeK = RelativePairMomentum(itPart1->GetMomentum(), *itPDGPar1,
-                                             itPart2->GetMomentum(),
-                                             *itPDGPar2);
+            const TVector3 mom2 = evt2.GetMomentum(iPart2);
+            RelativeK = RelativePairMomentum(mom1, mass1, mom2, mass2);
             if (fillHists && ResultsHist->GetEtaPhiPlots()) {
-              DeltaEtaDeltaPhi(HistCounter, part1, part2, false, ResultsHist,
-                               RelativeK);
+              DeltaEtaDeltaPhi(HistCounter, evt1, iPart1, evt2, iPart2, false,
+                               ResultsHist, RelativeK);
             }
             if (fillHists && ResultsHist->GetDodPhidEtaPlots()) {
-              float deta = itPart1->GetEta().at(0) - itPart2->GetEta().at(0);
-              float dphi = itPart1->GetPhi().at(0) - itPart2->GetPhi().at(0);
+              float deta = evt1.GetEta(iPart1) - evt2.GetEta(iPart2);
+              float dphi = evt1.GetPhi(iPart1) - evt2.GetPhi(iPart2);
               float mT =
                   ResultsHist->GetDodPhidEtamTPlots() ?
-                      RelativePairmT(itPart1->GetMomentum(), *itPDGPar1,
-                                     itPart2->GetMomentum(), *itPDGPar2) :
-                      0;
+                      RelativePairmT(mom1, mass1, mom2, mass2) : 0;
               if (dphi < 0) {
                 ResultsHist->FilldPhidEtaME(HistCounter, dphi + 2 * TMath::Pi(),
                                             deta, mT);
@@ -245,16 +267,12 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesME(
             }
             if (fillHists && ResultsHist->GetDokTBinning()) {
               ResultsHist->FillMixedEventkTDist(
-                  HistCounter,
-                  RelativePairkT(itPart1->GetMomentum(), *itPDGPar1,
-                                 itPart2->GetMomentum(), *itPDGPar2),
+                  HistCounter, RelativePairkT(mom1, mass1, mom2, mass2),
                   RelativeK, cent);
             }
             if (fillHists && ResultsHist->GetDomTBinning()) {
               ResultsHist->FillMixedEventmTDist(
-                  HistCounter,
-                  RelativePairmT(itPart1->GetMomentum(), *itPDGPar1,
-                                 itPart2->GetMomentum(), *itPDGPar2),
+                  HistCounter, RelativePairmT(mom1, mass1, mom2, mass2),
                   RelativeK);
             }
             if (fillHists && ResultsHist->GetObtainMomentumResolution()) {
@@ -263,12 +281,11 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesME(
               //of the pairs does not change event by event.
               //Now we only want to use the momentum of particles we are after, hence
               //we check the PDG Code!
-              if ((*itPDGPar1 == TMath::Abs(itPart1->GetMCPDGCode()))
-                  && ((*itPDGPar2 == TMath::Abs(itPart2->GetMCPDGCode())))) {
-                float RelKTrue = RelativePairMomentum(itPart1->GetMCMomentum(),
-                                                      *itPDGPar1,
-                                                      itPart2->GetMCMomentum(),
-                                                      *itPDGPar2);
+              if ((pdg1 == TMath::Abs(evt1.GetMCPDGCode(iPart1)))
+                  && (pdg2 == TMath::Abs(evt2.GetMCPDGCode(iPart2)))) {
+                float RelKTrue = RelativePairMomentum(
+                    evt1.GetMCMomentum(iPart1), mass1,
+                    evt2.GetMCMomentum(iPart2), mass2);
                 ResultsHist->FillMomentumResolution(HistCounter, RelKTrue,
                                                     RelativeK);
               }
@@ -277,25 +294,20 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesME(
         }
       }
       ++HistCounter;
-      ++itPDGPar2;
     }
-    ++itPDGPar1;
   }
 }
 float AliFemtoDreamZVtxMultContainer::RelativePairMomentum(
-    TVector3 Part1Momentum, int PDGPart1, TVector3 Part2Momentum,
-    int PDGPart2) {
-  if (PDGPart1 == 0 || PDGPart2 == 0) {
-    AliError("Invalid PDG Code");
-  }
+    const TVector3 &Part1Momentum, double MassPart1,
+    const TVector3 &Part2Momentum, double MassPart2) {
   float results = 0.;
   TLorentzVector SPtrack, TPProng, trackSum, SPtrackCMS, TPProngCMS;
   //Even if the Daughter tracks were switched up during PID doesn't play a role here cause we are
   //only looking at the mother mass
   SPtrack.SetXYZM(Part1Momentum.X(), Part1Momentum.Y(), Part1Momentum.Z(),
-                  TDatabasePDG::Instance()->GetParticle(PDGPart1)->Mass());
+                  MassPart1);
   TPProng.SetXYZM(Part2Momentum.X(), Part2Momentum.Y(), Part2Momentum.Z(),
-                  TDatabasePDG::Instance()->GetParticle(PDGPart2)->Mass());
+                  MassPart2);
   trackSum = SPtrack + TPProng;
 
   float beta = trackSum.Beta();
@@ -315,53 +327,44 @@ float AliFemtoDreamZVtxMultContainer::RelativePairMomentum(
   results = 0.5 * trackRelK.P();
   return results;
 }
-float AliFemtoDreamZVtxMultContainer::RelativePairkT(TVector3 Part1Momentum,
-                                                     int PDGPart1,
-                                                     TVector3 Part2Momentum,
-                                                     int PDGPart2) {
-  if (PDGPart1 == 0 || PDGPart2 == 0) {
-    AliError("Invalid PDG Code");
-  }
+float AliFemtoDreamZVtxMultContainer::RelativePairkT(
+    const TVector3 &Part1Momentum, double MassPart1,
+    const TVector3 &Part2Momentum, double MassPart2) {
   float results = 0.;
   TLorentzVector SPtrack, TPProng, trackSum;
   //Even if the Daughter tracks were switched up during PID doesn't play a role here cause we are
   //only looking at the mother mass
   SPtrack.SetXYZM(Part1Momentum.X(), Part1Momentum.Y(), Part1Momentum.Z(),
-                  TDatabasePDG::Instance()->GetParticle(PDGPart1)->Mass());
+                  MassPart1);
   TPProng.SetXYZM(Part2Momentum.X(), Part2Momentum.Y(), Part2Momentum.Z(),
-                  TDatabasePDG::Instance()->GetParticle(PDGPart2)->Mass());
+                  MassPart2);
   trackSum = SPtrack + TPProng;
 
   results = 0.5 * trackSum.Pt();
   return results;
 }
-float AliFemtoDreamZVtxMultContainer::RelativePairmT(TVector3 Part1Momentum,
-                                                     int PDGPart1,
-                                                     TVector3 Part2Momentum,
-                                                     int PDGPart2) {
-  if (PDGPart1 == 0 || PDGPart2 == 0) {
-    AliError("Invalid PDG Code");
-  }
+float AliFemtoDreamZVtxMultContainer::RelativePairmT(
+    const TVector3 &Part1Momentum, double MassPart1,
+    const TVector3 &Part2Momentum, double MassPart2) {
   float results = 0.;
   TLorentzVector SPtrack, TPProng, trackSum;
   //Even if the Daughter tracks were switched up during PID doesn't play a role here cause we are
   //only looking at the mother mass
   SPtrack.SetXYZM(Part1Momentum.X(), Part1Momentum.Y(), Part1Momentum.Z(),
-                  TDatabasePDG::Instance()->GetParticle(PDGPart1)->Mass());
+                  MassPart1);
   TPProng.SetXYZM(Part2Momentum.X(), Part2Momentum.Y(), Part2Momentum.Z(),
-                  TDatabasePDG::Instance()->GetParticle(PDGPart2)->Mass());
+                  MassPart2);
   trackSum = SPtrack + TPProng;
   float pairKT = 0.5 * trackSum.Pt();
-  float averageMass = 0.5
-      * (TDatabasePDG::Instance()->GetParticle(PDGPart1)->Mass()
-          + TDatabasePDG::Instance()->GetParticle(PDGPart2)->Mass());
+  float averageMass = 0.5 * (MassPart1 + MassPart2);
   results = TMath::Sqrt(pow(pairKT, 2.) + pow(averageMass, 2.));
   return results;
 }
 
 void AliFemtoDreamZVtxMultContainer::DeltaEtaDeltaPhi(
-    int Hist, AliFemtoDreamBasePart &part1, AliFemtoDreamBasePart &part2,
-    bool SEorME, AliFemtoDreamCorrHists *ResultsHist, float relk) {
+    int Hist, const AliFemtoDreamPartStore &evt1, unsigned int iPart1,
+    const AliFemtoDreamPartStore &evt2, unsigned int iPart2, bool SEorME,
+    AliFemtoDreamCorrHists *ResultsHist, float relk) {
   //used to check for track splitting/merging
   //this function only produces meaningful results for track with x Daughter
   //looking at this quantity makes only sense anyways for Track - Track not
@@ -373,32 +376,31 @@ void AliFemtoDreamZVtxMultContainer::DeltaEtaDeltaPhi(
     AliWarning("you are doing something wrong \n");
   }
   unsigned int nDaug2 = (unsigned int) DoThisPair % 10;
-  std::vector<float> eta1 = part1.GetEta();
-  std::vector<float> eta2 = part2.GetEta();
-  for (unsigned int iDaug1 = 0; iDaug1 < nDaug1; ++iDaug1) {
-    std::vector<float> PhiAtRad1 = part1.GetPhiAtRaidius().at(iDaug1);
+  for (unsigned int iDaug1 = 0;
+      iDaug1 < nDaug1 && iDaug1 < evt1.GetNDaughters(iPart1); ++iDaug1) {
+    const float *PhiAtRad1 = evt1.GetPhiAtRadii(iPart1, iDaug1);
+    const unsigned int nRad1 = evt1.GetNRadii(iPart1, iDaug1);
     float etaPar1;
     if (nDaug1 == 1) {
-      etaPar1 = eta1.at(0);
+      etaPar1 = evt1.GetEta(iPart1, 0);
     } else {
-      etaPar1 = eta1.at(iDaug1 + 1);
+      etaPar1 = evt1.GetEta(iPart1, iDaug1 + 1);
     }
-    for (unsigned int iDaug2 = 0; iDaug2 < part2.GetPhiAtRaidius().size();
+    for (unsigned int iDaug2 = 0; iDaug2 < evt2.GetNDaughters(iPart2);
         ++iDaug2) {
-      std::vector<float> phiAtRad2 = part2.GetPhiAtRaidius().at(iDaug2);
+      const float *phiAtRad2 = evt2.GetPhiAtRadii(iPart2, iDaug2);
+      const unsigned int nRad2 = evt2.GetNRadii(iPart2, iDaug2);
       float etaPar2;
       if (nDaug2 == 1) {
-        etaPar2 = eta2.at(0);
+        etaPar2 = evt2.GetEta(iPart2, 0);
       } else {
-        etaPar2 = eta2.at(iDaug2 + 1);
+        etaPar2 = evt2.GetEta(iPart2, iDaug2 + 1);
       }
       float deta = etaPar1 - etaPar2;
-      const int size =
-          (PhiAtRad1.size() > phiAtRad2.size()) ?
-              phiAtRad2.size() : PhiAtRad1.size();
+      const int size = (nRad1 > nRad2) ? nRad2 : nRad1;
       float dphiAvg = 0;
       for (int iRad = 0; iRad < size; ++iRad) {
-        float dphi = PhiAtRad1.at(iRad) - phiAtRad2.at(iRad);
+        float dphi = PhiAtRad1[iRad] - phiAtRad2[iRad];
         dphiAvg += dphi;
         if (dphi > piHi) {
           dphi += -piHi * 2;
@@ -435,8 +437,8 @@ float AliFemtoDreamZVtxMultContainer::ComputeDeltaEta(
 
 float AliFemtoDreamZVtxMultContainer::ComputeDeltaPhi(
     AliFemtoDreamBasePart &part1, AliFemtoDreamBasePart &part2) {
-  std::vector<float> Phirad1 = part1.GetPhiAtRaidius().at(0);
-  std::vector<float> Phirad2 = part2.GetPhiAtRaidius().at(0);
+  const std::vector<float> &Phirad1 = part1.GetPhiAtRaidius().at(0);
+  const std::vector<float> &Phirad2 = part2.GetPhiAtRaidius().at(0);
   std::vector<float> radVector;
   float dphi = 999.f;
   for (unsigned int iRad = 0; iRad < Phirad1.size(); ++iRad) {
@@ -446,53 +448,3 @@ float AliFemtoDreamZVtxMultContainer::ComputeDeltaPhi(
   }
   return dphi;
 }
-
-bool AliFemtoDreamZVtxMultContainer::RejectClosePairs(
-    AliFemtoDreamBasePart& part1, AliFemtoDreamBasePart& part2) {
-  bool outBool = true;
-  //Method calculates the average separation between two tracks
-  //at different radii within the TPC and rejects pairs which a
-  //too low separation
-  unsigned int nDaug1 = part1.GetPhiAtRaidius().size();
-  unsigned int nDaug2 = part2.GetPhiAtRaidius().size();
-  // if nDaug == 1 => Single Track, else decay
-  std::vector<float> eta1 = part1.GetEta();
-  std::vector<float> eta2 = part2.GetEta();
-  for (unsigned int iDaug1 = 0; iDaug1 < nDaug1 && outBool; ++iDaug1) {
-    std::vector<float> PhiAtRad1 = part1.GetPhiAtRaidius().at(iDaug1);
-    float etaPar1;
-    if (nDaug1 == 1) {
-      etaPar1 = eta1.at(0);
-    } else {
-      etaPar1 = eta1.at(iDaug1 + 1);
-    }
-    for (unsigned int iDaug2 = 0;
-        iDaug2 < part2.GetPhiAtRaidius().size() && outBool; ++iDaug2) {
-      std::vector<float> phiAtRad2 = part2.GetPhiAtRaidius().at(iDaug2);
-      float etaPar2;
-      if (nDaug2 == 1) {
-        etaPar2 = eta2.at(0);
-      } else {
-        etaPar2 = eta2.at(iDaug2 + 1);
-      }
-      float deta = etaPar1 - etaPar2;
-      const int size =
-          (PhiAtRad1.size() > phiAtRad2.size()) ?
-              phiAtRad2.size() : PhiAtRad1.size();
-      for (int iRad = 0; iRad < size; ++iRad) {
-        float dphi = PhiAtRad1.at(iRad) - phiAtRad2.at(iRad);
-        if (dphi > piHi) {
-          dphi += -piHi * 2;
-        } else if (dphi < -piHi) {
-          dphi += piHi * 2;
-        }
-        dphi = TVector2::Phi_mpi_pi(dphi);
-        if (dphi * dphi + deta * deta < fDeltaPhiEtaMax) {
-          outBool = false;
-          break;
-        }
-      }
-    }
-  }
-  return outBool;
-}
@@ -26,8 +26,10 @@ class AliFemtoDreamZVtxMultContainer {
   void PairParticlesME(
       std::vector<std::vector<AliFemtoDreamBasePart>> &Particles,
       AliFemtoDreamCorrHists *ResultsHist, int iMult, float cent);
-  void DeltaEtaDeltaPhi(int Hist, AliFemtoDreamBasePart &part1,
-                        AliFemtoDreamBasePart &part2, bool SEorME,
+  void DeltaEtaDeltaPhi(int Hist, const AliFemtoDreamPartStore &evt1,
+                        unsigned int iPart1,
+                        const AliFemtoDreamPartStore &evt2,
+                        unsigned int iPart2, bool SEorME,
                         AliFemtoDreamCorrHists *ResultsHist, float relk);
   float ComputeDeltaEta(AliFemtoDreamBasePart &part1,
                         AliFemtoDreamBasePart &part2);
@@ -39,16 +41,19 @@ class AliFemtoDreamZVtxMultContainer {
   }
   ;
  private:
-  float RelativePairMomentum(TVector3 Part1Momentum, int PDGPart1,
-                             TVector3 Part2Momentum, int PDGPart2);
-  float RelativePairkT(TVector3 Part1Momentum, int PDGPart1,
-                       TVector3 Part2Momentum, int PDGPart2);
-  float RelativePairmT(TVector3 Part1Momentum, int PDGPart1,
-                       TVector3 Part2Momentum, int PDGPart2);
-  bool RejectClosePairs(AliFemtoDreamBasePart& part1,
-                        AliFemtoDreamBasePart& part2);
+  void FillCurrentEvent(
+      std::vector<std::vector<AliFemtoDreamBasePart>> &Particles);
+  float RelativePairMomentum(const TVector3 &Part1Momentum, double MassPart1,
+                             const TVector3 &Part2Momentum, double MassPart2);
+  float RelativePairkT(const TVector3 &Part1Momentum, double MassPart1,
+                       const TVector3 &Part2Momentum, double MassPart2);
+  float RelativePairmT(const TVector3 &Part1Momentum, double MassPart1,
+                       const TVector3 &Part2Momentum, double MassPart2);
   std::vector<AliFemtoDreamPartContainer> fPartContainer;
+  std::vector<AliFemtoDreamPartStore> fCurrentEvent; //! flat copy of the event being paired
+  bool fCurrentEventSet; //! fCurrentEvent filled and not yet moved to the mixing buffer
   std::vector<int> fPDGParticleSpecies;
+  std::vector<double> fMassParticleSpecies; //! masses from fPDGParticleSpecies
   std::vector<unsigned int> fWhichPairs;
   std::vector<bool> fRejPairs;
   float fDeltaEtaMax;
@@ -56,7 +61,7 @@ class AliFemtoDreamZVtxMultContainer {
   float fDeltaPhiEtaMax;
   bool fDoDeltaEtaDeltaPhiCut;
 
-ClassDef(AliFemtoDreamZVtxMultContainer, 4)
+ClassDef(AliFemtoDreamZVtxMultContainer, 5)
   ;
 };
 
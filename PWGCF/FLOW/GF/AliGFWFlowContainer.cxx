@@ -1,4 +1,6 @@
 #include "AliGFWFlowContainer.h"
+#include "TRandom3.h"
+#include <thread>
 
 AliGFWFlowContainer::AliGFWFlowContainer():
   TNamed("",""),
@@ -11,7 +13,12 @@ AliGFWFlowContainer::AliGFWFlowContainer():
   fXAxis(0),
   fNbinsPt(0),
   fbinsPt(0),
-  fPropagateErrors(kFALSE)
+  fPropagateErrors(kFALSE),
+  fNSampleSums(0),
+  fNSumRows(0),
+  fNSumCols(0),
+  fSampleSumWY(),
+  fSampleSumW()
 {
 };
 AliGFWFlowContainer::AliGFWFlowContainer(const char *name):
@@ -25,7 +32,12 @@ AliGFWFlowContainer::AliGFWFlowContainer(const char *name):
   fXAxis(0),
   fNbinsPt(0),
   fbinsPt(0),
-  fPropagateErrors(kFALSE)
+  fPropagateErrors(kFALSE),
+  fNSampleSums(0),
+  fNSumRows(0),
+  fNSumCols(0),
+  fSampleSumWY(),
+  fSampleSumW()
 {
 };
 AliGFWFlowContainer::~AliGFWFlowContainer() {
@@ -159,6 +171,7 @@ void AliGFWFlowContainer::OverrideProfileErrors(TProfile2D *inpf) {
   }
 }
 Long64_t AliGFWFlowContainer::Merge(TCollection *collist) {
+  ClearSampleSums(); //dense copies are outdated
   Long64_t nmerged=0;
   AliGFWFlowContainer *l_FC = 0;
   TIter all_FC(collist);
@@ -213,6 +226,7 @@ void AliGFWFlowContainer::ReadAndMerge(const char *filelist) {
   };
 };
 void AliGFWFlowContainer::PickAndMerge(TFile *tfi) {
+  ClearSampleSums(); //dense copies are outdated
   AliGFWFlowContainer *lfc = (AliGFWFlowContainer*)tfi->Get(this->GetName());
   if(!lfc) {
     printf("Could not pick up the %s from %s\n",this->GetName(),tfi->GetName());
@@ -246,6 +260,7 @@ void AliGFWFlowContainer::PickAndMerge(TFile *tfi) {
   //printf("After merge: %i in target, %i in source\n",fProfRand->GetEntries(),tarr->GetEntries());
 };
 Bool_t AliGFWFlowContainer::OverrideMainWithSub(Int_t ind, Bool_t ExcludeChosen) {
+  ClearSampleSums(); //dense copies are outdated
   if(!fProfRand) {
     printf("Cannot override main profile with a randomized one. Random profile array does not exist.\n");
     return kFALSE;
@@ -276,6 +291,7 @@ Bool_t AliGFWFlowContainer::OverrideMainWithSub(Int_t ind, Bool_t ExcludeChosen)
   };
 };
 Bool_t AliGFWFlowContainer::RandomizeProfile(Int_t nSubsets) {
+  ClearSampleSums(); //dense copies are outdated
   if(!fProfRand) {
     printf("Cannot randomize profile, random array does not exist.\n");
     return kFALSE;
@@ -1001,3 +1017,344 @@ Double_t AliGFWFlowContainer::VDN8Error(Double_t d8, Double_t d8e, Double_t c8,
   Double_t dc = -7*c8e/(8*c8);
   return vdn8v * TMath::Sqrt(dd*dd+dc*dc);
 };
+
+//Columnar post-processing
+static void ReduceSampleSums(const Double_t *sumWY, const Double_t *sumW, Int_t firstSample, Int_t lastSample, Int_t nRows, Int_t nCols,
+                             const std::vector<Int_t> *segOffset, const std::vector<Int_t> *segRow, const std::vector<Int_t> *segFirst,
+                             const std::vector<Int_t> *segLast, Double_t *reduced) {
+  //For samples [firstSample,lastSample), sum w*corr and w over the segments (row, first col., last col.) of each quantity
+  Int_t nQ = (Int_t)segOffset->size()-1;
+  for(Int_t is=firstSample;is<lastSample;is++) {
+    const Double_t *wy = sumWY + (Long64_t)is*nRows*nCols;
+    const Double_t *w  = sumW  + (Long64_t)is*nRows*nCols;
+    Double_t *red = reduced + (Long64_t)is*nQ*2;
+    for(Int_t iq=0;iq<nQ;iq++) {
+      Double_t swy=0, sw=0;
+      for(Int_t iseg=(*segOffset)[iq];iseg<(*segOffset)[iq+1];iseg++) {
+        const Double_t *rwy = wy + (Long64_t)(*segRow)[iseg]*nCols;
+        const Double_t *rw  = w  + (Long64_t)(*segRow)[iseg]*nCols;
+        for(Int_t ix=(*segFirst)[iseg];ix<=(*segLast)[iseg];ix++) { swy+=rwy[ix]; sw+=rw[ix]; };
+      };
+      red[2*iq]   = swy;
+      red[2*iq+1] = sw;
+    };
+  };
+};
+static void EvaluateVariants(AliGFWFlowContainer *fc, Int_t firstVar, Int_t lastVar, Int_t StatType, Int_t nSub, Int_t c, Int_t nBins,
+                             const Double_t *reduced, const Double_t *counts, Double_t *cnValues, Double_t *vnValues) {
+  //Variant 0 is the main profile (sample 0); the others combine the sub-profiles (samples 1..nSub, their sum is stored as sample nSub+1)
+  Int_t nQ = (c/2)*(nBins+1);
+  std::vector<Double_t> comb(2*nQ);
+  std::vector<Double_t> corr(nQ);
+  for(Int_t iv=firstVar;iv<lastVar;iv++) {
+    if(iv==0 || StatType==AliGFWFlowContainer::kSingleSample) {
+      const Double_t *red = reduced + (Long64_t)iv*2*nQ;
+      for(Int_t i=0;i<2*nQ;i++) comb[i] = red[i];
+    } else if(StatType==AliGFWFlowContainer::kJackKnife) {
+      const Double_t *tot = reduced + (Long64_t)(nSub+1)*2*nQ;
+      const Double_t *red = reduced + (Long64_t)iv*2*nQ;
+      for(Int_t i=0;i<2*nQ;i++) comb[i] = tot[i]-red[i];
+    } else {
+      const Double_t *cnt = counts + (Long64_t)(iv-1)*nSub;
+      for(Int_t i=0;i<2*nQ;i++) comb[i] = 0;
+      for(Int_t is=0;is<nSub;is++) {
+        if(cnt[is]==0) continue;
+        const Double_t *red = reduced + (Long64_t)(is+1)*2*nQ;
+        for(Int_t i=0;i<2*nQ;i++) comb[i] += cnt[is]*red[i];
+      };
+    };
+    for(Int_t iq=0;iq<nQ;iq++) corr[iq] = (comb[2*iq+1]!=0)?comb[2*iq]/comb[2*iq+1]:0;
+    fc->EvaluateNNFromCorrelators(c,nBins,corr.data(),cnValues+(Long64_t)iv*(nBins+1),vnValues+(Long64_t)iv*(nBins+1));
+  };
+};
+Bool_t AliGFWFlowContainer::ExtractSampleSums() {
+  ClearSampleSums();
+  if(!fProf) return kFALSE;
+  Int_t nSub = fProfRand?fProfRand->GetEntries():0;
+  fNSampleSums = nSub+1;
+  fNSumRows = fProf->GetNbinsY();
+  fNSumCols = fProf->GetNbinsX()+2;
+  Long64_t sampleSize = (Long64_t)fNSumRows*fNSumCols;
+  fSampleSumWY.assign(fNSampleSums*sampleSize,0);
+  fSampleSumW.assign(fNSampleSums*sampleSize,0);
+  for(Int_t is=0;is<fNSampleSums;is++) {
+    TProfile2D *lProf = is?(TProfile2D*)fProfRand->At(is-1):fProf;
+    if(!lProf || lProf->GetNbinsY()!=fNSumRows || lProf->GetNbinsX()+2!=fNSumCols) {
+      printf("Sample %i does not exist or has a different binning than the main profile!\n",is);
+      ClearSampleSums();
+      return kFALSE;
+    };
+    Double_t *wy = &fSampleSumWY[is*sampleSize];
+    Double_t *w  = &fSampleSumW[is*sampleSize];
+    for(Int_t iy=1;iy<=fNSumRows;iy++)
+      for(Int_t ix=0;ix<fNSumCols;ix++) {
+        Int_t binno = lProf->GetBin(ix,iy);
+        wy[(iy-1)*fNSumCols+ix] = lProf->fArray[binno];
+        w[(iy-1)*fNSumCols+ix]  = lProf->GetBinEntries(binno);
+      };
+  };
+  return kTRUE;
+};
+void AliGFWFlowContainer::ClearSampleSums() {
+  fNSampleSums=0;
+  fNSumRows=0;
+  fNSumCols=0;
+  std::vector<Double_t>().swap(fSampleSumWY);
+  std::vector<Double_t>().swap(fSampleSumW);
+};
+Int_t AliGFWFlowContainer::BuildSumPlan(Int_t n, Int_t c, Bool_t onPt, Double_t arg1, Double_t arg2, std::vector<Int_t> &segOffset,
+                                        std::vector<Int_t> &segRow, std::vector<Int_t> &segFirst, std::vector<Int_t> &segLast) {
+  //Quantity (k,b) = <<n k>> in output bin b, bin 0 being the reference (pt-differential only). Its sums are taken
+  //over segments of the dense arrays, the same bins as the ones added up by GetCorrXXVsPt/Multi and GetRefFlowProfile.
+  Int_t nOrders = c/2;
+  Int_t nMulti = fProf->GetNbinsX();
+  Int_t nBins = onPt?0:nMulti;
+  std::vector<Int_t> ptToOut;
+  Int_t minm=1, maxm=nMulti, refStart=1, refStop=nMulti;
+  if(onPt) {
+    if(!fbinsPt) SetXAxis();
+    Int_t lRebin = fPtRebin>0?fPtRebin:1;
+    ptToOut.assign(fNbinsPt+1,0);
+    if(fPtRebinEdges) {
+      nBins = fPtRebin;
+      for(Int_t j=1;j<=fNbinsPt;j++) {
+        Double_t center = 0.5*(fbinsPt[j-1]+fbinsPt[j]);
+        if(center<fPtRebinEdges[0]) continue;
+        for(Int_t k=1;k<=nBins;k++) if(center<=fPtRebinEdges[k]) { ptToOut[j]=k; break; };
+      };
+    } else {
+      nBins = fNbinsPt/lRebin;
+      for(Int_t j=1;j<=fNbinsPt;j++) { Int_t k=(j-1)/lRebin+1; if(k<=nBins) ptToOut[j]=k; };
+    };
+    if(arg1>0) {
+      minm=fProf->GetXaxis()->FindBin(arg1+0.001);
+      maxm=minm;
+    };
+    if(arg2>arg1) maxm=fProf->GetXaxis()->FindBin(arg2-0.001);
+    minm = TMath::Max(minm,0);
+    maxm = TMath::Min(maxm,nMulti+1);
+    refStart = fProf->GetXaxis()->FindBin(arg1+0.001);
+    refStop = fProf->GetXaxis()->FindBin(arg2-0.001);
+    if(refStart<1) refStart=1;
+    if(refStop<refStart) refStop=nMulti;
+    if(refStop>nMulti) refStop=nMulti;
+  };
+  std::vector<std::vector<Int_t> > segs((nBins+1)*nOrders);
+  for(Int_t ik=0;ik<nOrders;ik++) {
+    TString order(Form("%i%i",n,2*(ik+1)));
+    TString l_name("");
+    Ssiz_t l_pos=0;
+    while(fIDName.Tokenize(l_name,l_pos)) {
+      if(onPt) {
+        Int_t ybin = fProf->GetYaxis()->FindBin(Form("%s%s",l_name.Data(),order.Data()));
+        Int_t ybn1 = fProf->GetYaxis()->FindBin(Form("%s%s_pt_1",l_name.Data(),order.Data()));
+        if(ybin<1 || ybn1<1 || ybn1+fNbinsPt-1>fNSumRows) {
+          printf("Could not find %s%s!\n",l_name.Data(),order.Data());
+          return -1;
+        };
+        std::vector<Int_t> &s0 = segs[ik*(nBins+1)];
+        s0.push_back(ybin-1); s0.push_back(refStart); s0.push_back(refStop);
+        for(Int_t j=1;j<=fNbinsPt;j++) {
+          if(!ptToOut[j]) continue;
+          std::vector<Int_t> &sb = segs[ik*(nBins+1)+ptToOut[j]];
+          sb.push_back(ybn1+j-2); sb.push_back(minm); sb.push_back(maxm);
+        };
+      } else {
+        const char *ptpf = arg1>0?Form("_pt_%i",(Int_t)arg1):"";
+        Int_t ybin = fProf->GetYaxis()->FindBin(Form("%s%s%s",l_name.Data(),order.Data(),ptpf));
+        if(ybin<1) {
+          printf("Could not find %s%s%s!\n",l_name.Data(),order.Data(),ptpf);
+          return -1;
+        };
+        for(Int_t ix=1;ix<=nBins;ix++) {
+          std::vector<Int_t> &sb = segs[ik*(nBins+1)+ix];
+          sb.push_back(ybin-1); sb.push_back(ix); sb.push_back(ix);
+        };
+      };
+    };
+  };
+  segOffset.assign(1,0);
+  segRow.clear(); segFirst.clear(); segLast.clear();
+  for(size_t iq=0;iq<segs.size();iq++) {
+    for(size_t i=0;i<segs[iq].size();i+=3) {
+      segRow.push_back(segs[iq][i]);
+      segFirst.push_back(segs[iq][i+1]);
+      segLast.push_back(segs[iq][i+2]);
+    };
+    segOffset.push_back((Int_t)segRow.size());
+  };
+  return nBins;
+};
+void AliGFWFlowContainer::EvaluateNNFromCorrelators(Int_t c, Int_t nBins, const Double_t *corr, Double_t *cn, Double_t *vn) {
+  //Same steps as GetCN2/4/6/8 followed by GetVN2/4/6/8; corr is [k][b] for <<2>>, <<4>>,... and bins 0..nBins
+  const Double_t *cor2 = corr;
+  const Double_t *cor4 = corr+(nBins+1);
+  const Double_t *cor6 = corr+2*(nBins+1);
+  const Double_t *cor8 = corr+3*(nBins+1);
+  Double_t rf2 = cor2[0];
+  Bool_t OnPt = (rf2!=0);
+  if(c==8) {
+    for(Int_t i=1;i<=nBins;i++) cn[i] = OnPt?DN8Value(cor8[i],cor6[i],cor4[i],cor2[i],cor6[0],cor4[0],rf2):CN8Value(cor8[i],cor6[i],cor4[i],cor2[i]);
+    cn[0] = OnPt?CN8Value(cor8[0],cor6[0],cor4[0],rf2):0;
+  } else if(c==6) {
+    for(Int_t i=1;i<=nBins;i++) cn[i] = OnPt?DN6Value(cor6[i],cor4[i],cor2[i],cor4[0],rf2):CN6Value(cor6[i],cor4[i],cor2[i]);
+    cn[0] = OnPt?CN6Value(cor6[0],cor4[0],rf2):0;
+  } else if(c==4) {
+    for(Int_t i=1;i<=nBins;i++) cn[i] = OnPt?DN4Value(cor4[i],cor2[i],rf2):CN4Value(cor4[i],cor2[i]);
+    cn[0] = OnPt?CN4Value(cor4[0],rf2):0;
+  } else {
+    for(Int_t i=1;i<=nBins;i++) cn[i] = cor2[i];
+    cn[0] = OnPt?rf2:0;
+  };
+  Double_t ref = cn[0];
+  Bool_t OnPtV = (ref!=0);
+  vn[0] = 0;
+  for(Int_t i=1;i<=nBins;i++) {
+    Double_t d = cn[i];
+    vn[i] = 0;
+    if(c==8) {
+      if(OnPtV && ref>0) continue;
+      vn[i] = OnPtV?VDN8Value(d,ref):VN8Value(d);
+    } else if(c==6) {
+      if(OnPtV && ref<=0) continue;
+      vn[i] = OnPtV?VDN6Value(d,ref):VN6Value(d);
+    } else if(c==4) {
+      if(OnPtV && ref>=0) continue;
+      vn[i] = OnPtV?VDN4Value(d,ref):VN4Value(d);
+    } else {
+      if(d<=0) continue;
+      vn[i] = OnPtV?VDN2Value(d,ref):VN2Value(d);
+    };
+  };
+};
+Int_t AliGFWFlowContainer::EvaluateNN(Int_t n, Int_t c, Bool_t onPt, StatisticsType StatType, std::vector<Double_t> &cnValues, std::vector<Double_t> &vnValues,
+                                      Double_t arg1, Double_t arg2, Int_t nBootstrap, Int_t nThreads, UInt_t seed) {
+  if(c!=2 && c!=4 && c!=6 && c!=8) {
+    printf("Only c_n{2}, c_n{4}, c_n{6} and c_n{8} can be evaluated!\n");
+    return -1;
+  };
+  if(!fNSampleSums && !ExtractSampleSums()) {
+    printf("Could not extract the sums of the profiles!\n");
+    return -1;
+  };
+  std::vector<Int_t> segOffset, segRow, segFirst, segLast;
+  Int_t nBins = BuildSumPlan(n,c,onPt,arg1,arg2,segOffset,segRow,segFirst,segLast);
+  if(nBins<0) return -1;
+  Int_t nQ = (Int_t)segOffset.size()-1;
+  Int_t nSub = fNSampleSums-1;
+  if(StatType!=kSingleSample && StatType!=kJackKnife && StatType!=kBootstrap) StatType=kSingleSample;
+  Int_t nVariants = 1 + (StatType==kBootstrap?(nBootstrap>0?nBootstrap:nSub):nSub);
+  if(!nSub) nVariants = 1;
+  if(nThreads<1) nThreads=1;
+
+  //Sums of all the quantities for every sample, plus the sum of the sub-profiles
+  std::vector<Double_t> reduced((Long64_t)(fNSampleSums+1)*2*nQ,0);
+  Int_t nRedThreads = TMath::Min(nThreads,fNSampleSums);
+  Int_t chunk = (fNSampleSums+nRedThreads-1)/nRedThreads;
+  if(nRedThreads==1)
+    ReduceSampleSums(fSampleSumWY.data(),fSampleSumW.data(),0,fNSampleSums,fNSumRows,fNSumCols,&segOffset,&segRow,&segFirst,&segLast,reduced.data());
+  else {
+    std::vector<std::thread> workers;
+    for(Int_t it=0;it<nRedThreads;it++) {
+      Int_t first = it*chunk;
+      Int_t last = TMath::Min(first+chunk,fNSampleSums);
+      if(first>=last) continue;
+      workers.push_back(std::thread(ReduceSampleSums,fSampleSumWY.data(),fSampleSumW.data(),first,last,fNSumRows,fNSumCols,
+                                    &segOffset,&segRow,&segFirst,&segLast,reduced.data()));
+    };
+    for(size_t iw=0;iw<workers.size();iw++) workers[iw].join();
+  };
+  Double_t *tot = &reduced[(Long64_t)fNSampleSums*2*nQ];
+  for(Int_t is=1;is<fNSampleSums;is++) {
+    const Double_t *red = &reduced[(Long64_t)is*2*nQ];
+    for(Int_t i=0;i<2*nQ;i++) tot[i]+=red[i];
+  };
+
+  //Bootstrap: number of times each sub-profile is picked, drawn beforehand so that the result does not depend on nThreads
+  std::vector<Double_t> counts;
+  if(StatType==kBootstrap && nSub) {
+    counts.assign((Long64_t)(nVariants-1)*nSub,0);
+    TRandom3 rndm(seed);
+    for(Int_t iv=0;iv<nVariants-1;iv++)
+      for(Int_t i=0;i<nSub;i++) counts[(Long64_t)iv*nSub+rndm.Integer(nSub)]+=1;
+  };
+
+  cnValues.assign((Long64_t)nVariants*(nBins+1),0);
+  vnValues.assign((Long64_t)nVariants*(nBins+1),0);
+  Int_t nEvalThreads = TMath::Min(nThreads,nVariants);
+  chunk = (nVariants+nEvalThreads-1)/nEvalThreads;
+  if(nEvalThreads==1)
+    EvaluateVariants(this,0,nVariants,StatType,nSub,c,nBins,reduced.data(),counts.data(),cnValues.data(),vnValues.data());
+  else {
+    std::vector<std::thread> workers;
+    for(Int_t it=0;it<nEvalThreads;it++) {
+      Int_t first = it*chunk;
+      Int_t last = TMath::Min(first+chunk,nVariants);
+      if(first>=last) continue;
+      workers.push_back(std::thread(EvaluateVariants,this,first,last,(Int_t)StatType,nSub,c,nBins,reduced.data(),counts.data(),
+                                    cnValues.data(),vnValues.data()));
+    };
+    for(size_t iw=0;iw<workers.size();iw++) workers[iw].join();
+  };
+  return nBins;
+};
+Int_t AliGFWFlowContainer::GetOutputEdges(Bool_t onPt, std::vector<Double_t> &edges) {
+  edges.clear();
+  if(!onPt) {
+    TAxis *lAxis = fProf->GetXaxis();
+    for(Int_t i=1;i<=lAxis->GetNbins();i++) edges.push_back(lAxis->GetBinLowEdge(i));
+    edges.push_back(lAxis->GetBinUpEdge(lAxis->GetNbins()));
+  } else if(fPtRebinEdges) {
+    for(Int_t i=0;i<=fPtRebin;i++) edges.push_back(fPtRebinEdges[i]);
+  } else {
+    if(!fbinsPt) SetXAxis();
+    Int_t lRebin = fPtRebin>0?fPtRebin:1;
+    for(Int_t i=0;i<=fNbinsPt/lRebin;i++) edges.push_back(fbinsPt[i*lRebin]);
+  };
+  return (Int_t)edges.size()-1;
+};
+TH1D *AliGFWFlowContainer::GetNNStat(Bool_t getVN, Int_t n, Int_t c, Bool_t onPt, StatisticsType StatType, Double_t arg1, Double_t arg2,
+                                     Int_t nBootstrap, Int_t nThreads) {
+  //Central value from the main profile, error from the variants: jackknife, spread of bootstrap samples or error of the mean of single samples
+  std::vector<Double_t> cnValues, vnValues;
+  Int_t nBins = EvaluateNN(n,c,onPt,StatType,cnValues,vnValues,arg1,arg2,nBootstrap,nThreads);
+  if(nBins<0) return 0;
+  std::vector<Double_t> edges;
+  if(GetOutputEdges(onPt,edges)!=nBins) {
+    printf("Output binning does not match!\n");
+    return 0;
+  };
+  const std::vector<Double_t> &vals = getVN?vnValues:cnValues;
+  Int_t nVariants = (Int_t)vals.size()/(nBins+1);
+  TH1D *rethist = new TH1D(Form("%s%i%i_%s_%s",getVN?"v":"c",n,c,onPt?"Pt":"Multi",
+                                StatType==kBootstrap?"Bootstrap":(StatType==kJackKnife?"JackKnife":"SingleSample")),"",nBins,edges.data());
+  rethist->SetDirectory(0);
+  for(Int_t i=(getVN?1:0);i<=nBins;i++) {
+    Double_t sum=0, sum2=0;
+    for(Int_t iv=1;iv<nVariants;iv++) {
+      Double_t val = vals[(Long64_t)iv*(nBins+1)+i];
+      sum+=val; sum2+=val*val;
+    };
+    Double_t err=0;
+    Int_t nv = nVariants-1;
+    if(nv>1) {
+      Double_t ssq = sum2-sum*sum/nv;
+      if(ssq<0) ssq=0;
+      if(StatType==kJackKnife) err = TMath::Sqrt(ssq*(nv-1)/nv);
+      else if(StatType==kBootstrap) err = TMath::Sqrt(ssq/(nv-1));
+      else err = TMath::Sqrt(ssq/(nv*(nv-1.)));
+    };
+    rethist->SetBinContent(i,vals[i]);
+    rethist->SetBinError(i,err);
+  };
+  if(onPt) {
+    Int_t bins = fProf->GetXaxis()->FindBin(arg1);
+    Int_t bins2 = fProf->GetXaxis()->FindBin(arg2);
+    Double_t bv1 = fProf->GetXaxis()->GetBinLowEdge(bins);
+    Double_t bv2 = fProf->GetXaxis()->GetBinUpEdge(bins2);
+    rethist->SetTitle(Form("%2.0f - %4.0f;#it{p}_{T} (GeV/#it{c}); %s_{%i}{%i}",bv1,bv2,getVN?"v":"c",n,c));
+  } else {
+    rethist->SetTitle(Form(";#it{N}_{tr};%s_{%i}{%i}",getVN?"v":"c",n,c));
+  };
+  return rethist;
+};
@@ -15,6 +15,7 @@
 #include "TString.h"
 #include "TCollection.h"
 #include "TAxis.h"
+#include <vector>
 
 class AliGFWFlowContainer:public TNamed {
  public:
@@ -27,7 +28,7 @@ class AliGFWFlowContainer:public TNamed {
   Bool_t CreateBinsFromAxis(TAxis *inax);
   void SetXAxis(TAxis *inax);
   void SetXAxis();
-  void RebinMulti(Int_t rN) { if(fProf) fProf->RebinX(rN); };
+  void RebinMulti(Int_t rN) { if(fProf) fProf->RebinX(rN); ClearSampleSums(); };
   Int_t GetNMultiBins() { return fProf->GetNbinsX(); };
   Double_t GetMultiAtBin(Int_t bin) { return fProf->GetXaxis()->GetBinCenter(bin); };
   Int_t FillProfile(const char *hname, Double_t multi, Double_t y, Double_t w, Double_t rn);
@@ -66,6 +67,18 @@ class AliGFWFlowContainer:public TNamed {
   TH1D *GetCNN(Int_t n=2, Int_t c=2, Bool_t onPt=kTRUE, Double_t arg1=-1, Double_t arg2=-1);
   TH1D *GetVNN(Int_t n=2, Int_t c=2, Bool_t onPt=kTRUE, Double_t arg1=-1, Double_t arg2=-1);
 
+  //Columnar post-processing: sums of the main and of the sub-profiles are copied once to dense arrays (ExtractSampleSums),
+  //then c_n{c} and v_n{c} of all bins are evaluated for the main profile and for all the statistics variants at once, without projections.
+  //Central values are the ones of GetCNN/GetVNN, errors are taken from the spread of the variants.
+  Bool_t ExtractSampleSums();
+  void ClearSampleSums();
+  Int_t EvaluateNN(Int_t n, Int_t c, Bool_t onPt, StatisticsType StatType, std::vector<Double_t> &cnValues, std::vector<Double_t> &vnValues,
+                   Double_t arg1=-1, Double_t arg2=-1, Int_t nBootstrap=0, Int_t nThreads=1, UInt_t seed=0); //returns nb. of bins; values are [variant][bin], variant 0 = main profile, bin 0 = reference
+  TH1D *GetCNNStat(Int_t n=2, Int_t c=2, Bool_t onPt=kTRUE, StatisticsType StatType=kJackKnife, Double_t arg1=-1, Double_t arg2=-1, Int_t nBootstrap=0, Int_t nThreads=1)
+    { return GetNNStat(kFALSE,n,c,onPt,StatType,arg1,arg2,nBootstrap,nThreads); };
+  TH1D *GetVNNStat(Int_t n=2, Int_t c=2, Bool_t onPt=kTRUE, StatisticsType StatType=kJackKnife, Double_t arg1=-1, Double_t arg2=-1, Int_t nBootstrap=0, Int_t nThreads=1)
+    { return GetNNStat(kTRUE,n,c,onPt,StatType,arg1,arg2,nBootstrap,nThreads); };
+
 
   // private:
 
@@ -129,6 +142,10 @@ class AliGFWFlowContainer:public TNamed {
   TH1D *GetCN6(TH1D *corrN6, TH1D *corrN4, TH1D *corrN2);
   TH1D *GetCN8(TH1D *corrN8, TH1D *corrN6, TH1D *corrN4, TH1D *corrN2);
   TH1D *ProfToHist(TProfile *inpf);
+  TH1D *GetNNStat(Bool_t getVN, Int_t n, Int_t c, Bool_t onPt, StatisticsType StatType, Double_t arg1, Double_t arg2, Int_t nBootstrap, Int_t nThreads);
+  Int_t BuildSumPlan(Int_t n, Int_t c, Bool_t onPt, Double_t arg1, Double_t arg2, std::vector<Int_t> &segOffset, std::vector<Int_t> &segRow, std::vector<Int_t> &segFirst, std::vector<Int_t> &segLast);
+  Int_t GetOutputEdges(Bool_t onPt, std::vector<Double_t> &edges);
+  void EvaluateNNFromCorrelators(Int_t c, Int_t nBins, const Double_t *corr, Double_t *cn, Double_t *vn);
   TProfile2D *fProf;
   TObjArray *fProfRand;
   Int_t fNRandom;
@@ -139,8 +156,13 @@ class AliGFWFlowContainer:public TNamed {
   Int_t fNbinsPt; //! Do not store; stored in the fXAxis
   Double_t *fbinsPt; //! Do not store; stored in fXAxis
   Bool_t fPropagateErrors; //! do not store
+  Int_t fNSampleSums; //! do not store; nb. of samples in the dense arrays: main profile + sub-profiles
+  Int_t fNSumRows; //! do not store; y bins of the profiles
+  Int_t fNSumCols; //! do not store; x bins of the profiles, including under- and overflow
+  std::vector<Double_t> fSampleSumWY; //! do not store; sum of w*corr, [sample][y-1][x]
+  std::vector<Double_t> fSampleSumW; //! do not store; sum of w, [sample][y-1][x]
   TProfile *GetRefFlowProfile(const char *order, Double_t m1=-1, Double_t m2=-1);
-  ClassDef(AliGFWFlowContainer, 2);
+  ClassDef(AliGFWFlowContainer, 3);
 };
 
 
@@ -20,6 +20,8 @@
 //---------------------------------------------
 ////////////////////////////////////////////////
 
+#include <unordered_map>
+#include <unordered_set>
 #include "AliConversionPhotonCuts.h"
 
 #include "AliKFVertex.h"
@@ -58,11 +60,47 @@
 #include "AliTRDTriggerAnalysis.h"
 #include "AliDalitzAODESDMC.h"
 #include "AliDalitzEventMC.h"
+#include "AliPIDResponseCache.h"
 
 class iostream;
 
 using namespace std;
 
+namespace {
+  // Per-event lookup tables for AOD input shared by all photon cut objects of the train:
+  // wagons with many cut variations evaluate the same candidates, so the scans over the
+  // tracks (track ID -> track) and V0s (daughter IDs) are done once per event
+  struct AODEventTables {
+    const AliVEvent*                      fEvent;
+    Long64_t                              fEntry;
+    Bool_t                                fTracksFilled;
+    std::unordered_map<Int_t, AliVTrack*> fTrackByID;
+    Bool_t                                fV0sFilled;
+    std::unordered_set<Long64_t>          fV0Daughters;
+  };
+  AODEventTables gAODEventTables = { 0, -1, kFALSE, std::unordered_map<Int_t, AliVTrack*>(), kFALSE, std::unordered_set<Long64_t>() };
+
+  // tables of the current event, NULL if event boundaries cannot be determined
+  AODEventTables* GetAODEventTables(const AliVEvent* event){
+    AliAnalysisManager* mgr = AliAnalysisManager::GetAnalysisManager();
+    if(!mgr) return NULL;
+    Long64_t entry = mgr->GetCurrentEntry();
+    AODEventTables& tables = gAODEventTables;
+    if(event != tables.fEvent || entry != tables.fEntry){
+      tables.fEvent = event;
+      tables.fEntry = entry;
+      tables.fTracksFilled = kFALSE;
+      tables.fTrackByID.clear();
+      tables.fV0sFilled = kFALSE;
+      tables.fV0Daughters.clear();
+    }
+    return &tables;
+  }
+
+  // key of an ordered pair of track IDs, the IDs are taken as unsigned since they can be negative
+  Long64_t V0DaughterKey(Int_t id1, Int_t id2){ return ((Long64_t)(UInt_t)id1 << 32) | (UInt_t)id2; }
+}
+
 /// \cond CLASSIMP
 ClassImp(AliConversionPhotonCuts)
 /// \endcond
@@ -1299,13 +1337,26 @@ Bool_t AliConversionPhotonCuts::PhotonIsSelected(AliConversionPhotonBase *photon
     Bool_t bFound = kFALSE;
     Int_t v0PosID = posTrack->GetID();
     Int_t v0NegID = negTrack->GetID();
-    AliAODv0* v0 = NULL;
-    for(Int_t iV=0; iV<aodEvent->GetNumberOfV0s(); iV++){
-      v0 = aodEvent->GetV0(iV);
-      if(!v0) continue;
-      if( (v0PosID == v0->GetPosID() && v0NegID == v0->GetNegID()) || (v0PosID == v0->GetNegID() && v0NegID == v0->GetPosID()) ){
-        bFound = kTRUE;
-        break;
+    if(AODEventTables* tables = GetAODEventTables(event)){
+      if(!tables->fV0sFilled){
+        for(Int_t iV=0; iV<aodEvent->GetNumberOfV0s(); iV++){
+          AliAODv0* v0 = aodEvent->GetV0(iV);
+          if(!v0) continue;
+          tables->fV0Daughters.insert(V0DaughterKey(v0->GetPosID(), v0->GetNegID()));
+          tables->fV0Daughters.insert(V0DaughterKey(v0->GetNegID(), v0->GetPosID()));
+        }
+        tables->fV0sFilled = kTRUE;
+      }
+      bFound = tables->fV0Daughters.count(V0DaughterKey(v0PosID, v0NegID)) > 0;
+    } else {
+      AliAODv0* v0 = NULL;
+      for(Int_t iV=0; iV<aodEvent->GetNumberOfV0s(); iV++){
+        v0 = aodEvent->GetV0(iV);
+        if(!v0) continue;
+        if( (v0PosID == v0->GetPosID() && v0NegID == v0->GetNegID()) || (v0PosID == v0->GetNegID() && v0NegID == v0->GetPosID()) ){
+          bFound = kTRUE;
+          break;
+        }
       }
     }
     if(!bFound){
@@ -1743,7 +1794,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
   if(!fPIDResponse){AliError("No PID Response"); return kTRUE;}// if still missing fatal error
 
   Short_t Charge    = fCurrentTrack->Charge();
-  Double_t electronNSigmaTPC = fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kElectron);
+  Double_t electronNSigmaTPC = GetNumberOfSigmas(AliPIDResponse::kTPC,fCurrentTrack,AliPID::kElectron);
   Double_t electronNSigmaTPCCor=0.;
   Double_t P=0.;
   Double_t Eta=0.;
@@ -1776,12 +1827,12 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
     // TPC Pion Line
     if( fCurrentTrack->P()>fPIDMinPnSigmaAbovePionLine && fCurrentTrack->P()<fPIDMaxPnSigmaAbovePionLine ){
       if(fDoElecDeDxPostCalibration){
-        if( electronNSigmaTPCCor >fPIDnSigmaBelowElectronLine && electronNSigmaTPCCor < fPIDnSigmaAboveElectronLine && fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLine){
+        if( electronNSigmaTPCCor >fPIDnSigmaBelowElectronLine && electronNSigmaTPCCor < fPIDnSigmaAboveElectronLine && GetNumberOfSigmas(AliPIDResponse::kTPC,fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLine){
           if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
           return kFALSE;
         }
       } else{
-        if( electronNSigmaTPC > fPIDnSigmaBelowElectronLine && electronNSigmaTPC < fPIDnSigmaAboveElectronLine && fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLine){
+        if( electronNSigmaTPC > fPIDnSigmaBelowElectronLine && electronNSigmaTPC < fPIDnSigmaAboveElectronLine && GetNumberOfSigmas(AliPIDResponse::kTPC,fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLine){
           if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
           return kFALSE;
         }
@@ -1792,12 +1843,12 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
     // High Pt Pion rej
     if( fCurrentTrack->P()>fPIDMaxPnSigmaAbovePionLine ){
       if(fDoElecDeDxPostCalibration){
-        if( electronNSigmaTPCCor > fPIDnSigmaBelowElectronLine && electronNSigmaTPCCor < fPIDnSigmaAboveElectronLine && fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLineHighPt){
+        if( electronNSigmaTPCCor > fPIDnSigmaBelowElectronLine && electronNSigmaTPCCor < fPIDnSigmaAboveElectronLine && GetNumberOfSigmas(AliPIDResponse::kTPC,fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLineHighPt){
           if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
           return kFALSE;
         }
       } else{
-        if( electronNSigmaTPC > fPIDnSigmaBelowElectronLine && electronNSigmaTPC < fPIDnSigmaAboveElectronLine && fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLineHighPt){
+        if( electronNSigmaTPC > fPIDnSigmaBelowElectronLine && electronNSigmaTPC < fPIDnSigmaAboveElectronLine && GetNumberOfSigmas(AliPIDResponse::kTPC,fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLineHighPt){
           if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
           return kFALSE;
         }
@@ -1809,7 +1860,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
 
   if(fDoKaonRejectionLowP == kTRUE && !fSwitchToKappa){
     if(fCurrentTrack->P()<fPIDMinPKaonRejectionLowP ){
-      if( TMath::Abs(fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kKaon))<fPIDnSigmaAtLowPAroundKaonLine){
+      if( TMath::Abs(GetNumberOfSigmas(AliPIDResponse::kTPC,fCurrentTrack,AliPID::kKaon))<fPIDnSigmaAtLowPAroundKaonLine){
         if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
         return kFALSE;
       }
@@ -1819,7 +1870,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
 
   if(fDoProtonRejectionLowP == kTRUE && !fSwitchToKappa){
     if( fCurrentTrack->P()<fPIDMinPProtonRejectionLowP ){
-      if( TMath::Abs(fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kProton))<fPIDnSigmaAtLowPAroundProtonLine){
+      if( TMath::Abs(GetNumberOfSigmas(AliPIDResponse::kTPC,fCurrentTrack,AliPID::kProton))<fPIDnSigmaAtLowPAroundProtonLine){
         if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
         return kFALSE;
       }
@@ -1829,7 +1880,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
 
   if(fDoPionRejectionLowP == kTRUE && !fSwitchToKappa){
     if( fCurrentTrack->P()<fPIDMinPPionRejectionLowP ){
-      if( TMath::Abs(fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion))<fPIDnSigmaAtLowPAroundPionLine){
+      if( TMath::Abs(GetNumberOfSigmas(AliPIDResponse::kTPC,fCurrentTrack,AliPID::kPion))<fPIDnSigmaAtLowPAroundPionLine){
         if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
         return kFALSE;
       }
@@ -1847,29 +1898,29 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
       Double_t dT = TOFsignal - t0 - times[0];
       fHistoTOFbefore->Fill(fCurrentTrack->P(),dT);
     }
-    if(fHistoTOFSigbefore) fHistoTOFSigbefore->Fill(fCurrentTrack->P(),fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron));
+    if(fHistoTOFSigbefore) fHistoTOFSigbefore->Fill(fCurrentTrack->P(),GetNumberOfSigmas(AliPIDResponse::kTOF,fCurrentTrack,AliPID::kElectron));
     if(fUseTOFpid){
-      if(fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron)>fTofPIDnSigmaAboveElectronLine ||
-        fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron)<fTofPIDnSigmaBelowElectronLine ){
+      if(GetNumberOfSigmas(AliPIDResponse::kTOF,fCurrentTrack,AliPID::kElectron)>fTofPIDnSigmaAboveElectronLine ||
+        GetNumberOfSigmas(AliPIDResponse::kTOF,fCurrentTrack,AliPID::kElectron)<fTofPIDnSigmaBelowElectronLine ){
         if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
         return kFALSE;
       }
     }
-    if(fHistoTOFSigafter)fHistoTOFSigafter->Fill(fCurrentTrack->P(),fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron));
+    if(fHistoTOFSigafter)fHistoTOFSigafter->Fill(fCurrentTrack->P(),GetNumberOfSigmas(AliPIDResponse::kTOF,fCurrentTrack,AliPID::kElectron));
   }
   cutIndex++; //8
 
   if((fCurrentTrack->GetStatus() & AliESDtrack::kITSpid)){
-    if(fHistoITSSigbefore) fHistoITSSigbefore->Fill(fCurrentTrack->P(),fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron));
+    if(fHistoITSSigbefore) fHistoITSSigbefore->Fill(fCurrentTrack->P(),GetNumberOfSigmas(AliPIDResponse::kITS,fCurrentTrack,AliPID::kElectron));
     if(fUseITSpid){
       if(fCurrentTrack->Pt()<=fMaxPtPIDITS){
-        if(fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron)>fITSPIDnSigmaAboveElectronLine || fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron)<fITSPIDnSigmaBelowElectronLine ){
+        if(GetNumberOfSigmas(AliPIDResponse::kITS,fCurrentTrack,AliPID::kElectron)>fITSPIDnSigmaAboveElectronLine || GetNumberOfSigmas(AliPIDResponse::kITS,fCurrentTrack,AliPID::kElectron)<fITSPIDnSigmaBelowElectronLine ){
           if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
           return kFALSE;
         }
       }
     }
-    if(fHistoITSSigafter)fHistoITSSigafter->Fill(fCurrentTrack->P(),fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron));
+    if(fHistoITSSigafter)fHistoITSSigafter->Fill(fCurrentTrack->P(),GetNumberOfSigmas(AliPIDResponse::kITS,fCurrentTrack,AliPID::kElectron));
   }
 
   cutIndex++; //9
@@ -1894,6 +1945,18 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
   return kTRUE;
 }
 
+///________________________________________________________________________
+Float_t AliConversionPhotonCuts::GetNumberOfSigmas(AliPIDResponse::EDetector detector, AliVTrack *track, AliPID::EParticleType type){
+  // the cache is only used if it serves the same PID response as this cut object
+  AliAnalysisManager *man = AliAnalysisManager::GetAnalysisManager();
+  AliInputEventHandler *inputHandler = man ? dynamic_cast<AliInputEventHandler*>(man->GetInputEventHandler()) : NULL;
+  if(inputHandler && inputHandler->GetPIDResponse() == fPIDResponse){
+    AliPIDResponseCache *cache = AliPIDResponseCache::Instance();
+    if(cache->GetPIDResponse() == fPIDResponse) return cache->NumberOfSigmas(detector, track, type);
+  }
+  return fPIDResponse->NumberOfSigmas(detector, track, type);
+}
+
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::KappaCuts(AliConversionPhotonBase * photon,AliVEvent *event) {
   // abort if Kappa selection not enabled
@@ -1955,10 +2018,23 @@ AliVTrack *AliConversionPhotonCuts::GetTrack(AliVEvent * event, Int_t label){
   } else {
     if(label == -999999) return NULL; // if AOD relabelling goes wrong, immediately return NULL
     AliVTrack * track = 0x0;
-    if(AliAnalysisManager::GetAnalysisManager()->GetTask(fV0ReaderName.Data()) && ((AliV0ReaderV1*)AliAnalysisManager::GetAnalysisManager()->GetTask(fV0ReaderName.Data()))->AreAODsRelabeled()){
+    AliV0ReaderV1* v0Reader = (AliV0ReaderV1*)AliAnalysisManager::GetAnalysisManager()->GetTask(fV0ReaderName.Data());
+    if(v0Reader && v0Reader->AreAODsRelabeled()){
       if(event->GetTrack(label)) track = dynamic_cast<AliVTrack*>(event->GetTrack(label));
       return track;
     }
+    else if(AODEventTables* tables = GetAODEventTables(event)){
+      if(!tables->fTracksFilled){
+        // first track with a given ID, as in the scan below
+        for(Int_t ii=0; ii<event->GetNumberOfTracks(); ii++) {
+          AliVTrack* itrack = dynamic_cast<AliVTrack*>(event->GetTrack(ii));
+          if(itrack) tables->fTrackByID.insert(std::make_pair(itrack->GetID(), itrack));
+        }
+        tables->fTracksFilled = kTRUE;
+      }
+      std::unordered_map<Int_t, AliVTrack*>::const_iterator it = tables->fTrackByID.find(label);
+      return it != tables->fTrackByID.end() ? it->second : NULL;
+    }
     else{
       for(Int_t ii=0; ii<event->GetNumberOfTracks(); ii++) {
         if(event->GetTrack(ii)) track = dynamic_cast<AliVTrack*>(event->GetTrack(ii));
@@ -2,6 +2,7 @@
 #define ALICONVERSIONPHOTONCUTS_H
 
 #include "AliAODpidUtil.h"
+#include "AliPIDResponse.h"
 #include "AliConversionPhotonBase.h"
 #include "AliAODConversionMother.h"
 #include "AliAODTrack.h"
@@ -422,6 +423,9 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
     Double_t          fExcludeMaxR;                         ///< r cut exclude region
 
   private:
+    /// n-sigma of the PID response, served from the per-event AliPIDResponseCache shared by all cut objects
+    Float_t GetNumberOfSigmas(AliPIDResponse::EDetector detector, AliVTrack *track, AliPID::EParticleType type);
+
     /// \cond CLASSIMP
     ClassDef(AliConversionPhotonCuts,27)
     /// \endcond
@@ -47,6 +47,8 @@ using namespace std;
 
 ClassImp(AliPhotonIsolation)
 
+const Float_t AliPhotonIsolation::fgkIsoRadii[4] = {0.1,0.2,0.3,0.4};
+
 //_______________________________________________________________________
 AliPhotonIsolation::AliPhotonIsolation(const char *name, Int_t photonType) : AliAnalysisTaskSE(name),
 
@@ -57,6 +59,7 @@ AliPhotonIsolation::AliPhotonIsolation(const char *name, Int_t photonType) : Ali
   fMapClustertoPtR2(),
   fMapClustertoPtR3(),
   fMapClustertoPtR4(),
+  fTrackGrid(),
   fListHistos(NULL),
   fHistTest(NULL),
   fHistClusterEnergy(NULL),
@@ -170,6 +173,20 @@ void AliPhotonIsolation::ProcessEvent(AliVEvent *event){
 
   fHistTest->Fill(nClus);
 
+  //#####################################################FILL TRACK GRID, ONCE PER EVENT
+  fTrackGrid.Reset();
+  for (Int_t itr=0;itr<event->GetNumberOfTracks();itr++){
+    AliVTrack *inTrack = 0x0; //initialise general track variable
+    if(esdev){
+      inTrack = esdev->GetTrack(itr); //get track
+    } else if(aodev) { //same for AODs
+      inTrack = dynamic_cast<AliVTrack*>(aodev->GetTrack(itr));
+    }
+    if(!inTrack) continue; //test track
+    fTrackGrid.Add(inTrack->Eta(),inTrack->Phi(),inTrack->Pt(),itr);
+  }
+  fTrackGrid.Build();
+
   //#########################################################################LOOP OVER CLUSTERS
   for(Int_t iclus=0;iclus < nClus;iclus++){ 
 
@@ -215,68 +232,16 @@ void AliPhotonIsolation::ProcessEvent(AliVEvent *event){
 
     fHistClusterEnergy->Fill(ET_clus);
       
-      //#########################################################################LOOP OVER TRACKS
-      for (Int_t itr=0;itr<event->GetNumberOfTracks();itr++){ 
-        if(debug){
-          cout << "______________________________This is a new track_______________________" << endl;
-        }
-	
-	//#####################################################INITIALISE AND CREATE TRACK OBJECT
-	AliVTrack *inTrack = 0x0; //initialise general track variable
-	if(esdev){
-	  inTrack = esdev->GetTrack(itr); //get track
-	  if(!inTrack) continue; //test track
-	  //  AliESDtrack *esdt = dynamic_cast<AliESDtrack*>(inTrack); //create class with track information      
-	} else if(aodev) { //same for AODs
-      inTrack = dynamic_cast<AliVTrack*>(aodev->GetTrack(itr));
-      if(!inTrack) continue;
-	  //  AliAODTrack *aodt = dynamic_cast<AliAODTrack*>(inTrack);
-	}
-	 
-	//####################################################DETERMINE ETA AND PHI FOR THE TRACK
-	Float_t eta_track = 0., phi_track = 0.; //define variables for track properties
-	eta_track = inTrack->Eta(); 
-	phi_track = inTrack->Phi();
-	
-	//#####################################CHECK THE DISTANCE/ANGLE BETWEEN TRACK AND CLUSTER
-	Float_t R2 = (TMath::Power(eta_clus-eta_track,2)+TMath::Power(phi_clus-phi_track,2)); //calculate the squared radius      
-/*
-    if(debug){
-      cout << "PhiTrack:  " << phi_track <<  endl;
-      cout << "EtaTrack:  " << eta_track <<  endl;
-      cout << "PhiClus:   " << phi_clus <<  endl;
-      cout << "EtaClus:   " << eta_clus <<  endl;
-      cout << "R:         " << R2 <<  endl;
-    }
-*/
-/*
-    if(debug){
-      cout <<  << endl;
-    }
-*/
-
-	Float_t pT = inTrack->Pt();//get pT of track
-
-	//add up pT values of tracks in cone
-	if(R2<0.01){//compare to R=0.1
-	  ptsum1 += pT;
-	}else if(R2<0.04){//compare to R=0.2
-	  ptsum2 += pT;
-	}else if(R2<0.09){//compare to R=0.3
-	  ptsum3 += pT;
-	}else if(R2<0.16){//compare to R=0.4
-	  ptsum4 += pT;
-	}
-	
-    if(debug && R2<0.16){
-      cout << "R2:     " << R2 << endl;
-    }
-
-      } //end of for loop tracks
-
-      ptsum2+=ptsum1; //add pT of innerst cone to second cone
-      ptsum3+=ptsum2; //add complete second to third
-      ptsum4+=ptsum3; //add complete third to fourth
+      //########################################################SUM PT OF TRACKS IN CONES
+      // all cones in one pass on the track grid cells around R=0.4
+      Float_t ptsum[4] = {0.,0.,0.,0.};
+      fTrackGrid.GetSumPtInCones(eta_clus,phi_clus,4,fgkIsoRadii,ptsum);
+
+      // cones include the smaller ones
+      ptsum1 = ptsum[0];
+      ptsum2 = ptsum[1];
+      ptsum3 = ptsum[2];
+      ptsum4 = ptsum[3];
       
       if(debug){
         cout << "ptsum1:  " << ptsum1 << endl;
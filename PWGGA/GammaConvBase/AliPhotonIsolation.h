@@ -3,6 +3,7 @@
 #define ALIPHOTONISOLATION_H
 
 #include "AliAnalysisTaskSE.h"
+#include "AliIsolationConeGrid.h"
 #include <vector>
 #include <map>
 #include <utility>
@@ -49,6 +50,9 @@ class AliPhotonIsolation : public AliAnalysisTaskSE {
   map<Int_t,Float_t> fMapClustertoPtR2;    // Map cluster ID to pTsum in cone R=0.2
   map<Int_t,Float_t> fMapClustertoPtR3;    // Map cluster ID to pTsum in cone R=0.3
   map<Int_t,Float_t> fMapClustertoPtR4;    // Map cluster ID to pTsum in cone R=0.4
+  AliIsolationConeGrid  fTrackGrid;              //! eta-phi grid of the tracks of the event
+
+  static const Float_t  fgkIsoRadii[4];          // cone radii R=0.1,0.2,0.3,0.4
 
   //histos
   TList*                fListHistos;             // list with histogram(s)
@@ -56,7 +60,7 @@ class AliPhotonIsolation : public AliAnalysisTaskSE {
   TH1F*                 fHistClusterEnergy;
   TH1F*                 fHistIso;
 
-  ClassDef(AliPhotonIsolation,1)
+  ClassDef(AliPhotonIsolation,2)
     };
 
 #endif
@@ -222,6 +222,8 @@ fFillMCGenTrees(kTRUE),
 fDsMassKKOpt(1),
 fLc2V0bachelorCalcSecoVtx(0),
 fTreeSingleTrackVarsOpt(AliHFTreeHandler::kRedSingleTrackVars),
+fTreeBufferedMode(kFALSE),
+fTreeMaxBufferedCand(1000),
 fJetRadius(0.4),
 fSubJetRadius(0.2),
 fJetAlgorithm(JetAlgorithm::antikt),
@@ -579,6 +581,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     OpenFile(6);
     TString nameoutput = "tree_D0";
     fTreeHandlerD0 = new AliHFTreeHandlerD0toKpi(fPIDoptD0);
+    if(fTreeBufferedMode) fTreeHandlerD0->SetBufferedMode(kTRUE,fTreeMaxBufferedCand);
     fTreeHandlerD0->SetOptSingleTrackVars(fTreeSingleTrackVarsOpt);
     if(fReadMC && fWriteOnlySignal) fTreeHandlerD0->SetFillOnlySignal(fWriteOnlySignal);
     if(fEnableNsigmaTPCDataCorr) fTreeHandlerD0->EnableNsigmaTPCDataDrivenCorrection(fSystemForNsigmaTPCDataCorr);
@@ -594,6 +597,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
       OpenFile(7);
       TString nameoutput = "tree_D0_gen";
       fTreeHandlerGenD0 = new AliHFTreeHandlerD0toKpi(0);
+      if(fTreeBufferedMode) fTreeHandlerGenD0->SetBufferedMode(kTRUE,fTreeMaxBufferedCand);
       fTreeHandlerGenD0->SetFillJets(fFillJets);
       fTreeHandlerGenD0->SetDoJetSubstructure(fDoJetSubstructure);
       fTreeHandlerGenD0->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
@@ -607,6 +611,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     OpenFile(8);
     TString nameoutput = "tree_Ds";
     fTreeHandlerDs = new AliHFTreeHandlerDstoKKpi(fPIDoptDs);
+    if(fTreeBufferedMode) fTreeHandlerDs->SetBufferedMode(kTRUE,fTreeMaxBufferedCand);
     fTreeHandlerDs->SetOptSingleTrackVars(fTreeSingleTrackVarsOpt);
     if(fReadMC && fWriteOnlySignal) fTreeHandlerDs->SetFillOnlySignal(fWriteOnlySignal);
     if(fEnableNsigmaTPCDataCorr) fTreeHandlerDs->EnableNsigmaTPCDataDrivenCorrection(fSystemForNsigmaTPCDataCorr);
@@ -623,6 +628,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
       OpenFile(9);
       TString nameoutput = "tree_Ds_gen";
       fTreeHandlerGenDs = new AliHFTreeHandlerDstoKKpi(0);
+      if(fTreeBufferedMode) fTreeHandlerGenDs->SetBufferedMode(kTRUE,fTreeMaxBufferedCand);
       fTreeHandlerGenDs->SetFillJets(fFillJets);
       fTreeHandlerGenDs->SetDoJetSubstructure(fDoJetSubstructure);
       fTreeHandlerGenDs->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
@@ -636,6 +642,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     OpenFile(10);
     TString nameoutput = "tree_Dplus";
     fTreeHandlerDplus = new AliHFTreeHandlerDplustoKpipi(fPIDoptDplus);
+    if(fTreeBufferedMode) fTreeHandlerDplus->SetBufferedMode(kTRUE,fTreeMaxBufferedCand);
     fTreeHandlerDplus->SetOptSingleTrackVars(fTreeSingleTrackVarsOpt);
     if(fReadMC && fWriteOnlySignal) fTreeHandlerDplus->SetFillOnlySignal(fWriteOnlySignal);
     if(fEnableNsigmaTPCDataCorr) fTreeHandlerDplus->EnableNsigmaTPCDataDrivenCorrection(fSystemForNsigmaTPCDataCorr);
@@ -650,6 +657,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
       OpenFile(11);
       TString nameoutput = "tree_Dplus_gen";
       fTreeHandlerGenDplus = new AliHFTreeHandlerDplustoKpipi(0);
+      if(fTreeBufferedMode) fTreeHandlerGenDplus->SetBufferedMode(kTRUE,fTreeMaxBufferedCand);
       fTreeHandlerGenDplus->SetFillJets(fFillJets);
       fTreeHandlerGenDplus->SetDoJetSubstructure(fDoJetSubstructure);
       fTreeHandlerGenDplus->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
@@ -663,6 +671,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     OpenFile(12);
     TString nameoutput = "tree_LctopKpi";
     fTreeHandlerLctopKpi = new AliHFTreeHandlerLctopKpi(fPIDoptLctopKpi);
+    if(fTreeBufferedMode) fTreeHandlerLctopKpi->SetBufferedMode(kTRUE,fTreeMaxBufferedCand);
     fTreeHandlerLctopKpi->SetOptSingleTrackVars(fTreeSingleTrackVarsOpt);
     if(fReadMC && fWriteOnlySignal) fTreeHandlerLctopKpi->SetFillOnlySignal(fWriteOnlySignal);
     if(fEnableNsigmaTPCDataCorr) fTreeHandlerLctopKpi->EnableNsigmaTPCDataDrivenCorrection(fSystemForNsigmaTPCDataCorr);
@@ -677,6 +686,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
       OpenFile(13);
       TString nameoutput = "tree_LctopKpi_gen";
       fTreeHandlerGenLctopKpi = new AliHFTreeHandlerLctopKpi(0);
+      if(fTreeBufferedMode) fTreeHandlerGenLctopKpi->SetBufferedMode(kTRUE,fTreeMaxBufferedCand);
       fTreeHandlerGenLctopKpi->SetFillJets(fFillJets);
       fTreeHandlerGenLctopKpi->SetDoJetSubstructure(fDoJetSubstructure);
       fTreeHandlerGenLctopKpi->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
@@ -691,6 +701,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     OpenFile(14);
     TString nameoutput = "tree_Bplus";
     fTreeHandlerBplus = new AliHFTreeHandlerBplustoD0pi(fPIDoptBplus);
+    if(fTreeBufferedMode) fTreeHandlerBplus->SetBufferedMode(kTRUE,fTreeMaxBufferedCand);
     fTreeHandlerBplus->SetOptSingleTrackVars(fTreeSingleTrackVarsOpt);
     if(fReadMC && fWriteOnlySignal) fTreeHandlerBplus->SetFillOnlySignal(fWriteOnlySignal);
     if(fEnableNsigmaTPCDataCorr) fTreeHandlerBplus->EnableNsigmaTPCDataDrivenCorrection(fSystemForNsigmaTPCDataCorr);
@@ -705,6 +716,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
       OpenFile(15);
       TString nameoutput = "tree_Bplus_gen";
       fTreeHandlerGenBplus = new AliHFTreeHandlerBplustoD0pi(0);
+      if(fTreeBufferedMode) fTreeHandlerGenBplus->SetBufferedMode(kTRUE,fTreeMaxBufferedCand);
       fTreeHandlerGenBplus->SetFillJets(fFillJets);
       fTreeHandlerGenBplus->SetDoJetSubstructure(fDoJetSubstructure);
       fTreeHandlerGenBplus->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
@@ -718,6 +730,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     OpenFile(16);
     TString nameoutput = "tree_Dstar";
     fTreeHandlerDstar = new AliHFTreeHandlerDstartoKpipi(fPIDoptDstar);
+    if(fTreeBufferedMode) fTreeHandlerDstar->SetBufferedMode(kTRUE,fTreeMaxBufferedCand);
     fTreeHandlerDstar->SetOptSingleTrackVars(fTreeSingleTrackVarsOpt);
     if(fReadMC && fWriteOnlySignal) fTreeHandlerDstar->SetFillOnlySignal(fWriteOnlySignal);
     if(fEnableNsigmaTPCDataCorr) fTreeHandlerDstar->EnableNsigmaTPCDataDrivenCorrection(fSystemForNsigmaTPCDataCorr);
@@ -732,6 +745,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
       OpenFile(17);
       TString nameoutput = "tree_Dstar_gen";
       fTreeHandlerGenDstar = new AliHFTreeHandlerDstartoKpipi(0);
+      if(fTreeBufferedMode) fTreeHandlerGenDstar->SetBufferedMode(kTRUE,fTreeMaxBufferedCand);
       fTreeHandlerGenDstar->SetFillJets(fFillJets);
       fTreeHandlerGenDstar->SetDoJetSubstructure(fDoJetSubstructure);
       fTreeHandlerGenDstar->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
@@ -745,6 +759,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     OpenFile(18);
     TString nameoutput = "tree_Lc2V0bachelor";
     fTreeHandlerLc2V0bachelor = new AliHFTreeHandlerLc2V0bachelor(fPIDoptLc2V0bachelor);
+    if(fTreeBufferedMode) fTreeHandlerLc2V0bachelor->SetBufferedMode(kTRUE,fTreeMaxBufferedCand);
     fTreeHandlerLc2V0bachelor->SetOptSingleTrackVars(fTreeSingleTrackVarsOpt);
     if(fReadMC && fWriteOnlySignal) fTreeHandlerLc2V0bachelor->SetFillOnlySignal(fWriteOnlySignal);
     if(fEnableNsigmaTPCDataCorr) fTreeHandlerLc2V0bachelor->EnableNsigmaTPCDataDrivenCorrection(fSystemForNsigmaTPCDataCorr);
@@ -760,6 +775,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
       OpenFile(19);
       TString nameoutput = "tree_Lc2V0bachelor_gen";
       fTreeHandlerGenLc2V0bachelor = new AliHFTreeHandlerLc2V0bachelor(0);
+      if(fTreeBufferedMode) fTreeHandlerGenLc2V0bachelor->SetBufferedMode(kTRUE,fTreeMaxBufferedCand);
       fTreeHandlerGenLc2V0bachelor->SetFillJets(fFillJets);
       fTreeHandlerGenLc2V0bachelor->SetDoJetSubstructure(fDoJetSubstructure);
       fTreeHandlerGenLc2V0bachelor->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
@@ -773,6 +789,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     OpenFile(20);
     TString nameoutput = "tree_Bs";
     fTreeHandlerBs = new AliHFTreeHandlerBstoDspi(fPIDoptBs);
+    if(fTreeBufferedMode) fTreeHandlerBs->SetBufferedMode(kTRUE,fTreeMaxBufferedCand);
     fTreeHandlerBs->SetOptSingleTrackVars(fTreeSingleTrackVarsOpt);
     if(fReadMC && fWriteOnlySignal) fTreeHandlerBs->SetFillOnlySignal(fWriteOnlySignal);
     if(fEnableNsigmaTPCDataCorr) fTreeHandlerBs->EnableNsigmaTPCDataDrivenCorrection(fSystemForNsigmaTPCDataCorr);
@@ -787,6 +804,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
       OpenFile(21);
       TString nameoutput = "tree_Bs_gen";
       fTreeHandlerGenBs = new AliHFTreeHandlerBstoDspi(0);
+      if(fTreeBufferedMode) fTreeHandlerGenBs->SetBufferedMode(kTRUE,fTreeMaxBufferedCand);
       fTreeHandlerGenBs->SetFillJets(fFillJets);
       fTreeHandlerGenBs->SetDoJetSubstructure(fDoJetSubstructure);
       fTreeHandlerGenBs->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
@@ -800,6 +818,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     OpenFile(22);
     TString nameoutput = "tree_Lb";
     fTreeHandlerLb = new AliHFTreeHandlerLbtoLcpi(fPIDoptLb);
+    if(fTreeBufferedMode) fTreeHandlerLb->SetBufferedMode(kTRUE,fTreeMaxBufferedCand);
     fTreeHandlerLb->SetOptSingleTrackVars(fTreeSingleTrackVarsOpt);
     if(fReadMC && fWriteOnlySignal) fTreeHandlerLb->SetFillOnlySignal(fWriteOnlySignal);
     if(fEnableNsigmaTPCDataCorr) fTreeHandlerLb->EnableNsigmaTPCDataDrivenCorrection(fSystemForNsigmaTPCDataCorr);
@@ -814,6 +833,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
       OpenFile(23);
       TString nameoutput = "tree_Lb_gen";
       fTreeHandlerGenLb = new AliHFTreeHandlerLbtoLcpi(0);
+      if(fTreeBufferedMode) fTreeHandlerGenLb->SetBufferedMode(kTRUE,fTreeMaxBufferedCand);
       fTreeHandlerGenLb->SetFillJets(fFillJets);
       fTreeHandlerGenLb->SetDoJetSubstructure(fDoJetSubstructure);
       fTreeHandlerGenLb->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
@@ -1045,6 +1065,20 @@ std::string AliAnalysisTaskSEHFTreeCreator::GetPeriod(const AliVEvent* event){
   return "undefined";
 }
 //________________________________________________________________________
+void AliAnalysisTaskSEHFTreeCreator::FlushCandidateTrees()
+{
+  /// Write the candidates buffered by the tree handlers (buffered mode)
+
+  AliHFTreeHandler* handlers[] = {fTreeHandlerD0,fTreeHandlerDs,fTreeHandlerDplus,fTreeHandlerLctopKpi,fTreeHandlerBplus,
+                                    fTreeHandlerBs,fTreeHandlerDstar,fTreeHandlerLc2V0bachelor,fTreeHandlerLb,
+                                    fTreeHandlerGenD0,fTreeHandlerGenDs,fTreeHandlerGenDplus,fTreeHandlerGenLctopKpi,fTreeHandlerGenBplus,
+                                    fTreeHandlerGenBs,fTreeHandlerGenDstar,fTreeHandlerGenLc2V0bachelor,fTreeHandlerGenLb};
+  const Int_t nHandlers = sizeof(handlers)/sizeof(handlers[0]);
+  for(Int_t iHandler=0; iHandler<nHandlers; iHandler++) {
+    if(handlers[iHandler]) handlers[iHandler]->FlushBuffer();
+  }
+}
+//________________________________________________________________________
 void AliAnalysisTaskSEHFTreeCreator::UserExec(Option_t */*option*/)
 
 {
@@ -1323,6 +1357,9 @@ void AliAnalysisTaskSEHFTreeCreator::UserExec(Option_t */*option*/)
   if(fWriteVariableTreeLb) ProcessLb(array3Prong,aod,mcArray,aod->GetMagneticField());
   if(fFillMCGenTrees && fReadMC) ProcessMCGen(mcArray);
   
+  // Write the candidates buffered in this event
+  if(fTreeBufferedMode) FlushCandidateTrees();
+
   // Fill the jet tree
   if (fWriteNJetTrees > 0 || fFillParticleTree) {
     FillJetTree();
@@ -154,6 +154,7 @@ public:
     void SetLc2V0bachelorCalcSecoVtx(Int_t opt=1) {fLc2V0bachelorCalcSecoVtx=opt;}
   
     void SetTreeSingleTrackVarsOpt(Int_t opt) {fTreeSingleTrackVarsOpt=opt;}
+    void SetTreeBufferedMode(Bool_t buffered=kTRUE, Int_t maxcand=1000) {fTreeBufferedMode=buffered; fTreeMaxBufferedCand=maxcand;}
   
     Int_t  GetSystem() const {return fSys;}
     Bool_t GetWriteOnlySignalTree() const {return fWriteOnlySignal;}
@@ -193,6 +194,7 @@ public:
     AliJetContainer* AddJetContainer(const char *n, UInt_t accType, Float_t jetRadius);
     AliJetContainer* GetJetContainer(Int_t i=0) const;
     void FillJetTree();
+    void FlushCandidateTrees();
   
     
     unsigned int GetEvID();
@@ -345,6 +347,8 @@ private:
     Int_t                   fLc2V0bachelorCalcSecoVtx;             /// option to calculate the secondary vertex for Lc2V0bachelor. False by default, has to be added to AddTask in case we want to start using it.
   
     Int_t                   fTreeSingleTrackVarsOpt;               /// option for single-track variables to be filled in the trees
+    Bool_t                  fTreeBufferedMode;                     /// flag to write the candidate trees in buffered (columnar) mode
+    Int_t                   fTreeMaxBufferedCand;                  /// max number of candidates per entry in buffered mode
 
     Double_t                fJetRadius;                            //Setting the radius for jet finding
     Double_t                fSubJetRadius;                         //Setting the radius for subjet finding
@@ -421,7 +425,7 @@ private:
     bool fCorrV0MVtx;
 
     /// \cond CLASSIMP
-    ClassDef(AliAnalysisTaskSEHFTreeCreator,17);
+    ClassDef(AliAnalysisTaskSEHFTreeCreator,18);
     /// \endcond
 };
 
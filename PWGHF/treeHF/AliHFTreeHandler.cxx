@@ -21,12 +21,14 @@
 
 #include <cmath>
 #include <limits>
+#include <cstring>
 #include "AliHFTreeHandler.h"
 #include "AliPID.h"
 #include "AliAODRecoDecayHF.h"
 #include "AliPIDResponse.h"
 #include "AliESDtrack.h"
 #include "TMath.h"
+#include "TLeaf.h"
 
 /// \cond CLASSIMP
 ClassImp(AliHFTreeHandler);
@@ -95,7 +97,18 @@ AliHFTreeHandler::AliHFTreeHandler():
   fSubJetRadius(0.2),
   fJetAlgorithm(0),
   fSubJetAlgorithm(2),
-  fMinJetPt(0.0)
+  fMinJetPt(0.0),
+  fBufferedMode(false),
+  fMaxBufferedCand(1000),
+  fColumnPrecision(),
+  fBufferedTree(nullptr),
+  fNBufferedCand(0),
+  fBufferCapacity(0),
+  fColSource(),
+  fColType(),
+  fColSize(),
+  fColNBits(),
+  fColBuffer()
 {
   //
   // Default constructor
@@ -196,7 +209,18 @@ AliHFTreeHandler::AliHFTreeHandler(int PIDopt):
   fSubJetRadius(0.2),
   fJetAlgorithm(0),
   fSubJetAlgorithm(2),
-  fMinJetPt(0.0)
+  fMinJetPt(0.0),
+  fBufferedMode(false),
+  fMaxBufferedCand(1000),
+  fColumnPrecision(),
+  fBufferedTree(nullptr),
+  fNBufferedCand(0),
+  fBufferCapacity(0),
+  fColSource(),
+  fColType(),
+  fColSize(),
+  fColNBits(),
+  fColBuffer()
 {
   //
   // Standard constructor
@@ -833,3 +857,114 @@ void AliHFTreeHandler::GetNsigmaTPCMeanSigmaData(float &mean, float &sigma, AliP
     }
   }
 }
+
+//________________________________________________________________
+void AliHFTreeHandler::SetColumnPrecision(TString colname, int nmantissabits)
+{
+  //
+  // Set the number of mantissa bits (2-16) kept for a float column in buffered mode
+  // (the column is written as Float16_t with range [0,0,nmantissabits], i.e. exponent
+  // and truncated mantissa, which reduces the size of the output)
+  //
+
+  if(nmantissabits<2 || nmantissabits>16) {
+    AliWarning(Form("Invalid number of mantissa bits (%d) for column %s, full precision kept",nmantissabits,colname.Data()));
+    return;
+  }
+  fColumnPrecision[colname] = nmantissabits;
+}
+
+//________________________________________________________________
+void AliHFTreeHandler::InitBufferedColumns()
+{
+  //
+  // Replace the scalar branches booked in BuildTree with array branches (one
+  // element per buffered candidate) reading from contiguous column buffers.
+  // The addresses of the scalar variables are kept to copy them at each FillTree.
+  //
+
+  fColSource.clear();
+  fColType.clear();
+  fColSize.clear();
+  fColNBits.clear();
+  fColBuffer.clear();
+
+  TObjArray *branches = fTreeVar->GetListOfBranches();
+  std::vector<TString> colnames;
+  for(int iBr=0; iBr<branches->GetEntriesFast(); iBr++) {
+    TBranch *br = (TBranch*)branches->UncheckedAt(iBr);
+    TLeaf *leaf = (TLeaf*)br->GetListOfLeaves()->At(0);
+    if(!leaf || br->GetListOfLeaves()->GetEntriesFast()!=1 || leaf->GetLen()!=1) {
+      AliFatal(Form("Branch %s cannot be converted to a column",br->GetName()));
+      return;
+    }
+    TString type = leaf->GetTypeName();
+    char code = 0;
+    if(type=="Float_t") code = 'F';
+    else if(type=="Double_t") code = 'D';
+    else if(type=="Int_t") code = 'I';
+    else if(type=="UInt_t") code = 'i';
+    else if(type=="Bool_t") code = 'O';
+    else if(type=="Short_t") code = 'S';
+    else if(type=="UShort_t") code = 's';
+    else if(type=="Char_t") code = 'B';
+    else if(type=="UChar_t") code = 'b';
+    else if(type=="Long64_t") code = 'L';
+    else if(type=="ULong64_t") code = 'l';
+    else {
+      AliFatal(Form("Type %s of branch %s not supported in buffered mode",type.Data(),br->GetName()));
+      return;
+    }
+    colnames.push_back(br->GetName());
+    fColSource.push_back((void*)br->GetAddress());
+    fColType.push_back(code);
+    fColSize.push_back(leaf->GetLenType());
+    std::map<TString,int>::iterator itprec = fColumnPrecision.find(br->GetName());
+    fColNBits.push_back((code=='F' && itprec!=fColumnPrecision.end()) ? itprec->second : -1);
+  }
+
+  // remove the scalar branches (the tree is still empty) and book the array ones
+  branches->Delete();
+  fTreeVar->GetListOfLeaves()->Clear();
+
+  if(fMaxBufferedCand==0) fMaxBufferedCand = 1;
+  fBufferCapacity = fMaxBufferedCand;
+  fColBuffer.resize(colnames.size());
+  fTreeVar->Branch("n_cand",&fNBufferedCand,"n_cand/I");
+  for(unsigned int iCol=0; iCol<colnames.size(); iCol++) {
+    fColBuffer[iCol].resize(fBufferCapacity*fColSize[iCol]);
+    if(fColNBits[iCol]>=0) // Float16_t in the file, float in memory
+      fTreeVar->Branch(colnames[iCol].Data(),fColBuffer[iCol].data(),Form("%s[n_cand]/f[0,0,%d]",colnames[iCol].Data(),fColNBits[iCol]));
+    else
+      fTreeVar->Branch(colnames[iCol].Data(),fColBuffer[iCol].data(),Form("%s[n_cand]/%c",colnames[iCol].Data(),fColType[iCol]));
+  }
+  fNBufferedCand = 0;
+  fBufferedTree = fTreeVar;
+}
+
+//________________________________________________________________
+void AliHFTreeHandler::BufferCandidate()
+{
+  //
+  // Copy the current candidate variables into the column buffers
+  //
+
+  if(fBufferedTree!=fTreeVar) InitBufferedColumns();
+  if(fNBufferedCand>=fBufferCapacity) FlushBuffer();
+
+  for(unsigned int iCol=0; iCol<fColSource.size(); iCol++)
+    memcpy(fColBuffer[iCol].data()+fNBufferedCand*fColSize[iCol],fColSource[iCol],fColSize[iCol]);
+  fNBufferedCand++;
+}
+
+//________________________________________________________________
+void AliHFTreeHandler::FlushBuffer()
+{
+  //
+  // Write the buffered candidates as one tree entry
+  //
+
+  if(!fBufferedMode || fBufferedTree!=fTreeVar || fNBufferedCand==0) return;
+  fTreeVar->Fill();
+  fNBufferedCand = 0;
+}
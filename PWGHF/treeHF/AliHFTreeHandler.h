@@ -22,6 +22,8 @@
 // N. Zardoshti, nima.zardoshti@cern.ch
 /////////////////////////////////////////////////////////////
 
+#include <map>
+#include <vector>
 #include <TTree.h>
 #include "AliAODTrack.h"
 #include "AliPIDResponse.h"
@@ -100,12 +102,25 @@ class AliHFTreeHandler : public TObject
       if(fFillOnlySignal && !(fCandType&kSignal)) { //if fill only signal and not signal candidate, do not store 
         fCandType=0;
       }
+      else if(fBufferedMode) {
+        BufferCandidate();
+        fCandType=0;
+        fRunNumberPrevCand = fRunNumber;
+      }
       else {      
         fTreeVar->Fill(); 
         fCandType=0;
         fRunNumberPrevCand = fRunNumber;
       }
     } 
+
+    //buffered (columnar) mode: candidates are accumulated in per-column arrays and
+    //written as one tree entry (arrays of size n_cand) at each FlushBuffer() call
+    //or when maxcand candidates are buffered. To be enabled before BuildTree.
+    void SetBufferedMode(bool buffered=true, unsigned int maxcand=1000) {fBufferedMode=buffered; fMaxBufferedCand=maxcand;}
+    bool IsBufferedMode() const {return fBufferedMode;}
+    void SetColumnPrecision(TString colname, int nmantissabits);
+    void FlushBuffer(); //to be called at the end of each event in buffered mode
     
     //common methods
     void SetFillJets(bool FillJets) {fFillJets=FillJets;}
@@ -189,6 +204,10 @@ class AliHFTreeHandler : public TObject
     bool SetSingleTrackVars(AliAODTrack* prongtracks[]);
     bool SetPidVars(AliAODTrack* prongtracks[], AliPIDResponse* pidrespo, bool usePionHypo, bool useKaonHypo, bool useProtonHypo, bool useTPC, bool useTOF);
   
+    //buffered mode methods
+    void InitBufferedColumns();
+    void BufferCandidate();
+
     //utils methods
     double CombineNsigmaDiffDet(double nsigmaTPC, double nsigmaTOF);
     int RoundFloatToInt(double num);
@@ -279,8 +298,20 @@ class AliHFTreeHandler : public TObject
     Int_t fSubJetAlgorithm; //SubJet finding algorithm
     Double_t fMinJetPt; //Jet finding mimimum Jet pT
 
+    bool fBufferedMode; ///flag to enable buffered (columnar) filling
+    unsigned int fMaxBufferedCand; ///max number of candidates per buffered entry
+    std::map<TString,int> fColumnPrecision; ///number of mantissa bits kept per float column (stored as Float16_t)
+    TTree* fBufferedTree; //!<! tree for which the column buffers are set up
+    int fNBufferedCand; //!<! number of candidates currently buffered
+    int fBufferCapacity; //!<! number of candidates that fit in the column buffers
+    std::vector<void*> fColSource; //!<! address of the scalar variable of each column
+    std::vector<char> fColType; //!<! leaf type code of each column
+    std::vector<int> fColSize; //!<! size in bytes of one element of each column
+    std::vector<int> fColNBits; //!<! mantissa bits of the Float16_t columns (-1 = full precision Float_t)
+    std::vector<std::vector<char> > fColBuffer; //!<! contiguous buffer of each column
+
   /// \cond CLASSIMP
-  ClassDef(AliHFTreeHandler,9); ///
+  ClassDef(AliHFTreeHandler,10); ///
   /// \endcond
 };
 #endif
@@ -69,6 +69,7 @@
 #include "AliAODv0.h"
 #include "AliCodeTimer.h"
 #include "AliMultSelection.h"
+#include "AliVertexingHFTrackSnapshot.h"
 #include <cstring>
 
 /// \cond CLASSIMP
@@ -138,6 +139,10 @@ fFindVertexForDstar(kTRUE),
 fFindVertexForCascades(kTRUE),
 fV0TypeForCascadeVertex(0),
 fMassCutBeforeVertexing(kFALSE),
+fMassCut2ProngAtPrimVtx(kFALSE),
+fUseHelixPreFilter(kTRUE),
+fNThreadsPreFilter(1),
+fTrackSnapshot(0x0),
 fMassCalc2(0),
 fMassCalc3(0),
 fMassCalc4(0),
@@ -233,6 +238,10 @@ fFindVertexForDstar(source.fFindVertexForDstar),
 fFindVertexForCascades(source.fFindVertexForCascades),
 fV0TypeForCascadeVertex(source.fV0TypeForCascadeVertex),
 fMassCutBeforeVertexing(source.fMassCutBeforeVertexing),
+fMassCut2ProngAtPrimVtx(source.fMassCut2ProngAtPrimVtx),
+fUseHelixPreFilter(source.fUseHelixPreFilter),
+fNThreadsPreFilter(source.fNThreadsPreFilter),
+fTrackSnapshot(0x0),
 fMassCalc2(source.fMassCalc2),
 fMassCalc3(source.fMassCalc3),
 fMassCalc4(source.fMassCalc4),
@@ -327,6 +336,9 @@ AliAnalysisVertexingHF &AliAnalysisVertexingHF::operator=(const AliAnalysisVerte
   fFindVertexForCascades = source.fFindVertexForCascades;
   fV0TypeForCascadeVertex = source.fV0TypeForCascadeVertex;
   fMassCutBeforeVertexing = source.fMassCutBeforeVertexing;
+  fMassCut2ProngAtPrimVtx = source.fMassCut2ProngAtPrimVtx;
+  fUseHelixPreFilter = source.fUseHelixPreFilter;
+  fNThreadsPreFilter = source.fNThreadsPreFilter;
   fMassCalc2 = source.fMassCalc2;
   fMassCalc3 = source.fMassCalc3;
   fMassCalc4 = source.fMassCalc4;
@@ -371,6 +383,7 @@ AliAnalysisVertexingHF::~AliAnalysisVertexingHF() {
   if(fMassCalc2) { delete fMassCalc2; fMassCalc2=0; }
   if(fMassCalc3) { delete fMassCalc3; fMassCalc3=0; }
   if(fMassCalc4) { delete fMassCalc4; fMassCalc4=0; }
+  if(fTrackSnapshot) { delete fTrackSnapshot; fTrackSnapshot=0; }
 }
 //----------------------------------------------------------------------------
 TList *AliAnalysisVertexingHF::FillListOfCuts() {
@@ -618,6 +631,17 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   AliDebug(1,Form(" Selected tracks: %d",nSeleTrks));
   fnSeleTrksTotal += nSeleTrks;
 
+  // snapshot of the selected tracks at the primary vertex and list of
+  // displaced-track pairs that can pass the DCA cut (analytic lower bound)
+  if(fUseHelixPreFilter || fMassCut2ProngAtPrimVtx) {
+    if(!fTrackSnapshot) fTrackSnapshot = new AliVertexingHFTrackSnapshot();
+    fTrackSnapshot->Fill(tracksAtVertex,nSeleTrks,fBzkG);
+  }
+  if(fUseHelixPreFilter) {
+    fTrackSnapshot->BuildPairCandidates(seleFlags,BIT(kBitDispl),dcaMax,fNThreadsPreFilter);
+    AliDebug(1,Form(" Pair candidates after pre-filter: %d",fTrackSnapshot->GetNPairCandidates()));
+  }
+
 
   TObjArray *twoTrackArray1    = new TObjArray(2);
   TObjArray *twoTrackArray2    = new TObjArray(2);
@@ -828,7 +852,15 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
     if(postrack1->Charge()<0 && !fLikeSign) continue;
 
     // LOOP ON  NEGATIVE  TRACKS
-    for(iTrkN1=0; iTrkN1<nSeleTrks; iTrkN1++) {
+    // (only on the partners surviving the pre-filter, if enabled)
+    Int_t firstN1=0, lastN1=nSeleTrks;
+    if(fUseHelixPreFilter) {
+      firstN1 = fTrackSnapshot->GetFirstPartner(iTrkP1);
+      lastN1  = fTrackSnapshot->GetLastPartner(iTrkP1);
+    }
+    for(Int_t iPartN1=firstN1; iPartN1<lastN1; iPartN1++) {
+
+      iTrkN1 = (fUseHelixPreFilter ? fTrackSnapshot->GetPartner(iPartN1) : iPartN1);
 
       //if(iTrkN1%1==0) AliDebug(1,Form("    1st loop on neg: track number %d of %d",iTrkN1,nSeleTrks));
       //if(iTrkN1%1==0) printf("    1st loop on neg: track number %d of %d\n",iTrkN1,nSeleTrks);
@@ -859,6 +891,15 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 
       }
 
+      // invariant mass cut with the momenta at primary vertex from the snapshot,
+      // before the DCA and the vertexing (only if the pair is not needed for 3 and 4 prongs)
+      if(fMassCut2ProngAtPrimVtx && !f3Prong && !f4Prong) {
+	Double_t pxDau[2]={fTrackSnapshot->GetPx(iTrkP1),fTrackSnapshot->GetPx(iTrkN1)};
+	Double_t pyDau[2]={fTrackSnapshot->GetPy(iTrkP1),fTrackSnapshot->GetPy(iTrkN1)};
+	Double_t pzDau[2]={fTrackSnapshot->GetPz(iTrkP1),fTrackSnapshot->GetPz(iTrkN1)};
+	if(!SelectInvMassAndPt2prong(pxDau,pyDau,pzDau)) { negtrack1=0; continue; }
+      }
+
       // back to primary vertex
       //      postrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
       //      negtrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
@@ -1131,6 +1172,9 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 
 	//printf("********** %d %d %d\n",postrack1->GetID(),postrack2->GetID(),negtrack1->GetID());
 
+	if(fUseHelixPreFilter &&
+	   (!fTrackSnapshot->IsPairCompatible(iTrkP2,iTrkN1,dcaMax) ||
+	    !fTrackSnapshot->IsPairCompatible(iTrkP2,iTrkP1,dcaMax))) { postrack2=0; continue; }
 	dcap2n1 = postrack2->GetDCA(negtrack1,fBzkG,xdummy,ydummy);
 	if(dcap2n1>dcaMax) { postrack2=0; continue; }
 	dcap1p2 = postrack2->GetDCA(postrack1,fBzkG,xdummy,ydummy);
@@ -1275,6 +1319,9 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	    SetParametersAtVertex(postrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkP2));
 	    SetParametersAtVertex(negtrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkN2));
 
+	    if(fUseHelixPreFilter &&
+	       (!fTrackSnapshot->IsPairCompatible(iTrkP1,iTrkN2,fCutsD0toKpipipi->GetDCACut()) ||
+		!fTrackSnapshot->IsPairCompatible(iTrkP2,iTrkN2,fCutsD0toKpipipi->GetDCACut()))) { negtrack2=0; continue; }
 	    dcap1n2 = postrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
 	    if(dcap1n2 > fCutsD0toKpipipi->GetDCACut()) { negtrack2=0; continue; }
             dcap2n2 = postrack2->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
@@ -1409,6 +1456,9 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	SetParametersAtVertex(negtrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkN2));
 	//printf("********** %d %d %d\n",postrack1->GetID(),negtrack1->GetID(),negtrack2->GetID());
 
+	if(fUseHelixPreFilter &&
+	   (!fTrackSnapshot->IsPairCompatible(iTrkP1,iTrkN2,dcaMax) ||
+	    !fTrackSnapshot->IsPairCompatible(iTrkN1,iTrkN2,dcaMax))) { negtrack2=0; continue; }
 	dcap1n2 = postrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
 	if(dcap1n2>dcaMax) { negtrack2=0; continue; }
 	dcan1n2 = negtrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
@@ -2321,13 +2371,8 @@ AliAODRecoDecayHF2Prong *AliAnalysisVertexingHF::Make2Prong(
   px[1] = momentum[0]; py[1] = momentum[1]; pz[1] = momentum[2];
 
   if(!refill){//skip if it is called in refill step because already checked
-    // invariant mass cut (try to improve coding here..)
-    Bool_t okMassCut=kFALSE;
-    if(!okMassCut && fD0toKpi)   if(SelectInvMassAndPtD0Kpi(px,py,pz))     okMassCut=kTRUE;
-    if(!okMassCut && fJPSItoEle) if(SelectInvMassAndPtJpsiee(px,py,pz))    okMassCut=kTRUE;
-    if(!okMassCut && fDstar)     if(SelectInvMassAndPtDstarD0pi(px,py,pz)) okMassCut=kTRUE;
-    if(!okMassCut && fCascades)  if(SelectInvMassAndPtCascade(px,py,pz))   okMassCut=kTRUE;
-    if(!okMassCut) {
+    // invariant mass cut
+    if(!SelectInvMassAndPt2prong(px,py,pz)) {
       //AliDebug(2," candidate didn't pass mass cut");
       return 0x0;
     }
@@ -2904,6 +2949,8 @@ void AliAnalysisVertexingHF::PrintStatus() const {
   }
   if(fRecoPrimVtxSkippingTrks) printf("RecoPrimVtxSkippingTrks\n");
   if(fRmTrksFromPrimVtx) printf("RmTrksFromPrimVtx\n");
+  if(fUseHelixPreFilter) printf("Pair pre-filter with analytic DCA bound (%d threads)\n",fNThreadsPreFilter);
+  if(fMassCut2ProngAtPrimVtx) printf("2-prong mass cut with momenta at primary vertex before vertexing\n");
   if(fD0toKpi) {
     printf("Reconstruct D0->Kpi candidates with cuts:\n");
     if(fCutsD0toKpi) fCutsD0toKpi->PrintAll();
@@ -3065,6 +3112,19 @@ Bool_t AliAnalysisVertexingHF::SelectInvMassAndPtDstarD0pi(TObjArray *trkArray){
   return retval;
 }
 //-----------------------------------------------------------------------------
+Bool_t AliAnalysisVertexingHF::SelectInvMassAndPt2prong(Double_t *px,
+							Double_t *py,
+							Double_t *pz){
+  /// Check invariant mass and pt cuts for all enabled 2 prong hypotheses
+
+  Bool_t okMassCut=kFALSE;
+  if(!okMassCut && fD0toKpi)   if(SelectInvMassAndPtD0Kpi(px,py,pz))     okMassCut=kTRUE;
+  if(!okMassCut && fJPSItoEle) if(SelectInvMassAndPtJpsiee(px,py,pz))    okMassCut=kTRUE;
+  if(!okMassCut && fDstar)     if(SelectInvMassAndPtDstarD0pi(px,py,pz)) okMassCut=kTRUE;
+  if(!okMassCut && fCascades)  if(SelectInvMassAndPtCascade(px,py,pz))   okMassCut=kTRUE;
+  return okMassCut;
+}
+//-----------------------------------------------------------------------------
 Bool_t AliAnalysisVertexingHF::SelectInvMassAndPtD0Kpi(Double_t *px,
 						       Double_t *py,
 						       Double_t *pz){
@@ -45,6 +45,7 @@ class AliAODVertex;
 class AliVertexerTracks;
 class AliESDv0;
 class AliAODv0;
+class AliVertexingHFTrackSnapshot;
 
 //-----------------------------------------------------------------------------
 class AliAnalysisVertexingHF : public TNamed {
@@ -179,6 +180,11 @@ class AliAnalysisVertexingHF : public TNamed {
   void SetCutsDStartoKpipi(AliRDHFCutsDStartoKpipi* cuts) { fCutsDStartoKpipi = cuts; }
   AliRDHFCutsDStartoKpipi* GetCutsDStartoKpipi() const { return fCutsDStartoKpipi; }
   void SetMassCutBeforeVertexing(Bool_t flag) { fMassCutBeforeVertexing=flag; }
+  void SetMassCut2ProngAtPrimVtx(Bool_t flag=kTRUE) { fMassCut2ProngAtPrimVtx=flag; }
+  void SetUseHelixPreFilter(Bool_t flag=kTRUE) { fUseHelixPreFilter=flag; }
+  Bool_t GetUseHelixPreFilter() const { return fUseHelixPreFilter; }
+  void SetNThreadsForPreFilter(Int_t nth) { fNThreadsPreFilter=nth; }
+  Int_t GetNThreadsForPreFilter() const { return fNThreadsPreFilter; }
 
   void SetMasses();
   Bool_t CheckCutsConsistency();
@@ -326,6 +332,10 @@ class AliAnalysisVertexingHF : public TNamed {
   Bool_t fFindVertexForCascades;  /// reconstruct a secondary vertex or assume it's from the primary vertex
   Int_t  fV0TypeForCascadeVertex;  /// Select which V0 type we want to use for the cascas
   Bool_t fMassCutBeforeVertexing; /// to go faster in PbPb
+  Bool_t fMassCut2ProngAtPrimVtx; /// 2-prong mass cut with momenta at primary vertex before vertexing (no 3,4 prongs)
+  Bool_t fUseHelixPreFilter; /// discard pairs with the analytic lower bound on the DCA before GetDCA and vertexing
+  Int_t  fNThreadsPreFilter; /// number of threads used to build the pair candidates
+  AliVertexingHFTrackSnapshot *fTrackSnapshot; //! per-event snapshot of selected tracks at primary vertex
   // dummies for invariant mass calculation
   AliAODRecoDecay *fMassCalc2; /// for 2 prong
   AliAODRecoDecay *fMassCalc3; /// for 3 prong
@@ -396,6 +406,7 @@ class AliAnalysisVertexingHF : public TNamed {
   AliAODVertex* PrimaryVertex(const TObjArray *trkArray=0x0,AliVEvent *event=0x0) const;
   AliAODVertex* ReconstructSecondaryVertex(TObjArray *trkArray,Double_t &dispersion,Bool_t useTRefArray=kTRUE) const;
 
+  Bool_t SelectInvMassAndPt2prong(Double_t *px,Double_t *py,Double_t *pz);
   Bool_t SelectInvMassAndPt3prong(Double_t *px,Double_t *py,Double_t *pz, Int_t pidLcStatus=3);
   Bool_t SelectInvMassAndPt4prong(Double_t *px,Double_t *py,Double_t *pz);
   Bool_t SelectInvMassAndPtD0Kpi(Double_t *px,Double_t *py,Double_t *pz);
@@ -422,7 +433,7 @@ class AliAnalysisVertexingHF : public TNamed {
 				  TObjArray *twoTrackArrayV0);
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisVertexingHF,27);  // Reconstruction of HF decay candidates
+  ClassDef(AliAnalysisVertexingHF,29);  // Reconstruction of HF decay candidates
   /// \endcond
 };
 
@@ -0,0 +1,187 @@
+/**************************************************************************
+ * Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//----------------------------------------------------------------------------
+//  Per-event snapshot of the tracks selected by AliAnalysisVertexingHF,
+//  stored as structure of arrays at the primary vertex.
+//  The transverse projection of each helix is a circle: the distance
+//  between two circles is a lower bound on the geometric 3D distance of
+//  closest approach of the two tracks. GetDCA weights the transverse and
+//  longitudinal residuals with the summed SigmaY2 and SigmaZ2 of the two
+//  tracks; scaling the gap by min(sqrt(sz2/sy2),sqrt(sy2/sz2)) makes it a
+//  lower bound on that weighted distance too, so pairs for which it exceeds
+//  the DCA cut are discarded without calling AliExternalTrackParam::GetDCA
+//  and without running the secondary vertex fit.
+//----------------------------------------------------------------------------
+
+#include <functional>
+#include <thread>
+#include <TMath.h>
+#include <TObjArray.h>
+#include "AliExternalTrackParam.h"
+#include "AliVertexingHFTrackSnapshot.h"
+
+/// \cond CLASSIMP
+ClassImp(AliVertexingHFTrackSnapshot);
+/// \endcond
+
+namespace {
+  // safety margin (cm) on the analytic bound, covers rounding for large radii
+  const Double_t kDistanceTolerance = 1.e-4;
+}
+
+//----------------------------------------------------------------------------
+AliVertexingHFTrackSnapshot::AliVertexingHFTrackSnapshot():
+TObject(),
+fNTracks(0),
+fPx(),
+fPy(),
+fPz(),
+fSigmaY2(),
+fSigmaZ2(),
+fXc(),
+fYc(),
+fR(),
+fPartnerOffset(),
+fPartner()
+{
+  /// Default constructor
+}
+//----------------------------------------------------------------------------
+void AliVertexingHFTrackSnapshot::Fill(const TObjArray &tracksAtVertex, Int_t nTracks, Double_t bzkG)
+{
+  /// Copy momentum, position errors and helix circle of the tracks at the primary vertex
+
+  fNTracks = nTracks;
+  fPx.resize(nTracks); fPy.resize(nTracks); fPz.resize(nTracks);
+  fSigmaY2.resize(nTracks); fSigmaZ2.resize(nTracks);
+  fXc.resize(nTracks); fYc.resize(nTracks); fR.resize(nTracks);
+  fPartnerOffset.assign(nTracks+1,0);
+  fPartner.clear();
+
+  Double_t xyz[3],pxpypz[3];
+  for(Int_t i=0; i<nTracks; i++) {
+    const AliExternalTrackParam *track = (const AliExternalTrackParam*)tracksAtVertex.UncheckedAt(i);
+    track->GetXYZ(xyz);
+    track->GetPxPyPz(pxpypz);
+    fPx[i] = pxpypz[0]; fPy[i] = pxpypz[1]; fPz[i] = pxpypz[2];
+    fSigmaY2[i] = track->GetSigmaY2();
+    fSigmaZ2[i] = track->GetSigmaZ2();
+    Double_t pt = TMath::Sqrt(pxpypz[0]*pxpypz[0]+pxpypz[1]*pxpypz[1]);
+    Double_t curv = track->GetC(bzkG);
+    if(TMath::Abs(curv)<kAlmost0 || pt<kAlmost0) {
+      // no field or infinite momentum: straight line, no bound available
+      fXc[i] = 0.; fYc[i] = 0.; fR[i] = -1.;
+      continue;
+    }
+    // center of the circle: displaced by 1/C perpendicular to the momentum
+    fXc[i] = xyz[0] - pxpypz[1]/pt/curv;
+    fYc[i] = xyz[1] + pxpypz[0]/pt/curv;
+    fR[i]  = 1./TMath::Abs(curv);
+  }
+}
+//----------------------------------------------------------------------------
+Double_t AliVertexingHFTrackSnapshot::MinDistanceXY(Int_t i, Int_t j) const
+{
+  /// Minimum distance between the transverse projections of two helices,
+  /// scaled by the ratio of the summed transverse and longitudinal errors
+  /// so that it is a lower bound on AliExternalTrackParam::GetDCA.
+
+  if(fR[i]<0. || fR[j]<0.) return 0.;
+  Double_t sy2 = fSigmaY2[i]+fSigmaY2[j];
+  Double_t sz2 = fSigmaZ2[i]+fSigmaZ2[j];
+  if(sy2<=0. || sz2<=0.) return 0.;
+  Double_t dx = fXc[i]-fXc[j];
+  Double_t dy = fYc[i]-fYc[j];
+  Double_t d  = TMath::Sqrt(dx*dx+dy*dy);
+  Double_t gap = 0.;
+  if(d > fR[i]+fR[j]) gap = d-fR[i]-fR[j];                 // disjoint circles
+  else if(d < TMath::Abs(fR[i]-fR[j])) gap = TMath::Abs(fR[i]-fR[j])-d; // nested circles
+  gap *= TMath::Min(TMath::Sqrt(sz2/sy2),TMath::Sqrt(sy2/sz2));
+  gap -= kDistanceTolerance;
+  return (gap>0. ? gap : 0.);
+}
+//----------------------------------------------------------------------------
+void AliVertexingHFTrackSnapshot::FillPartners(Int_t first, Int_t last,
+					       const UChar_t *seleFlags, UChar_t mask,
+					       Double_t dcaMax,
+					       std::vector<Int_t> &partners,
+					       std::vector<Int_t> &counts) const
+{
+  /// Fill partner lists for tracks in [first,last)
+
+  for(Int_t i=first; i<last; i++) {
+    Int_t nPart = 0;
+    if(seleFlags[i]&mask) {
+      for(Int_t j=0; j<fNTracks; j++) {
+	if(j==i) continue;
+	if(!(seleFlags[j]&mask)) continue;
+	if(!IsPairCompatible(i,j,dcaMax)) continue;
+	partners.push_back(j);
+	nPart++;
+      }
+    }
+    counts[i-first] = nPart;
+  }
+}
+//----------------------------------------------------------------------------
+void AliVertexingHFTrackSnapshot::BuildPairCandidates(const UChar_t *seleFlags, UChar_t mask,
+						      Double_t dcaMax, Int_t nThreads)
+{
+  /// Build, for each track with the bits in mask set, the sorted list of
+  /// partners that can satisfy the DCA cut. The outer loop on tracks is split
+  /// in contiguous chunks that can run in parallel threads; the chunks are
+  /// merged in order so that the result does not depend on nThreads.
+
+  fPartnerOffset.assign(fNTracks+1,0);
+  fPartner.clear();
+  if(fNTracks<2) return;
+
+  if(nThreads<1) nThreads = 1;
+  if(nThreads>fNTracks) nThreads = fNTracks;
+  Int_t chunk = (fNTracks+nThreads-1)/nThreads;
+
+  std::vector<std::vector<Int_t> > partners(nThreads);
+  std::vector<std::vector<Int_t> > counts(nThreads);
+  for(Int_t it=0; it<nThreads; it++) {
+    Int_t first = it*chunk;
+    Int_t last  = TMath::Min(first+chunk,fNTracks);
+    counts[it].assign(TMath::Max(last-first,0),0);
+  }
+
+  if(nThreads==1) {
+    FillPartners(0,fNTracks,seleFlags,mask,dcaMax,partners[0],counts[0]);
+  } else {
+    std::vector<std::thread> workers;
+    for(Int_t it=0; it<nThreads; it++) {
+      Int_t first = it*chunk;
+      Int_t last  = TMath::Min(first+chunk,fNTracks);
+      if(first>=last) continue;
+      workers.push_back(std::thread(&AliVertexingHFTrackSnapshot::FillPartners,this,first,last,
+				    seleFlags,mask,dcaMax,std::ref(partners[it]),std::ref(counts[it])));
+    }
+    for(size_t iw=0; iw<workers.size(); iw++) workers[iw].join();
+  }
+
+  // merge chunks
+  Int_t iTrk = 0;
+  for(Int_t it=0; it<nThreads; it++) {
+    for(size_t ic=0; ic<counts[it].size(); ic++) {
+      fPartnerOffset[iTrk+1] = fPartnerOffset[iTrk]+counts[it][ic];
+      iTrk++;
+    }
+    fPartner.insert(fPartner.end(),partners[it].begin(),partners[it].end());
+  }
+}
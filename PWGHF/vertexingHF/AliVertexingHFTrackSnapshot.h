@@ -0,0 +1,69 @@
+#ifndef ALIVERTEXINGHFTRACKSNAPSHOT_H
+#define ALIVERTEXINGHFTRACKSNAPSHOT_H
+/* Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//-------------------------------------------------------------------------
+/// \class AliVertexingHFTrackSnapshot
+/// \brief Per-event snapshot of the selected tracks at the primary vertex
+///
+/// Structure-of-arrays copy of momentum, position errors and transverse helix
+/// (circle center and radius) of the tracks selected by
+/// AliAnalysisVertexingHF. It provides a cheap analytic lower bound on the
+/// track-to-track DCA of AliExternalTrackParam::GetDCA, used to discard pairs
+/// before GetDCA and the secondary vertex fit, and the list of compatible
+/// partners per track.
+//-------------------------------------------------------------------------
+
+#include <vector>
+#include <TObject.h>
+
+class TObjArray;
+
+class AliVertexingHFTrackSnapshot : public TObject {
+ public:
+  AliVertexingHFTrackSnapshot();
+  virtual ~AliVertexingHFTrackSnapshot() {}
+
+  void Fill(const TObjArray &tracksAtVertex, Int_t nTracks, Double_t bzkG);
+  void BuildPairCandidates(const UChar_t *seleFlags, UChar_t mask, Double_t dcaMax, Int_t nThreads=1);
+
+  Int_t    GetNTracks() const { return fNTracks; }
+  Double_t GetPx(Int_t i) const { return fPx[i]; }
+  Double_t GetPy(Int_t i) const { return fPy[i]; }
+  Double_t GetPz(Int_t i) const { return fPz[i]; }
+
+  Double_t MinDistanceXY(Int_t i, Int_t j) const;
+  Bool_t   IsPairCompatible(Int_t i, Int_t j, Double_t dcaMax) const { return MinDistanceXY(i,j)<=dcaMax; }
+
+  /// range [GetFirstPartner(i),GetLastPartner(i)) of the partners of track i
+  Int_t GetFirstPartner(Int_t i) const { return fPartnerOffset[i]; }
+  Int_t GetLastPartner(Int_t i) const { return fPartnerOffset[i+1]; }
+  Int_t GetPartner(Int_t k) const { return fPartner[k]; }
+  Int_t GetNPairCandidates() const { return (Int_t)fPartner.size(); }
+
+ private:
+  AliVertexingHFTrackSnapshot(const AliVertexingHFTrackSnapshot &source);
+  AliVertexingHFTrackSnapshot& operator=(const AliVertexingHFTrackSnapshot &source);
+
+  void FillPartners(Int_t first, Int_t last, const UChar_t *seleFlags, UChar_t mask,
+		    Double_t dcaMax, std::vector<Int_t> &partners, std::vector<Int_t> &counts) const;
+
+  Int_t fNTracks;                   /// number of tracks in the snapshot
+  std::vector<Double_t> fPx;        /// px at primary vertex
+  std::vector<Double_t> fPy;        /// py at primary vertex
+  std::vector<Double_t> fPz;        /// pz at primary vertex
+  std::vector<Double_t> fSigmaY2;   /// sigma^2 of the local y at primary vertex
+  std::vector<Double_t> fSigmaZ2;   /// sigma^2 of z at primary vertex
+  std::vector<Double_t> fXc;        /// x of the helix center in the transverse plane
+  std::vector<Double_t> fYc;        /// y of the helix center in the transverse plane
+  std::vector<Double_t> fR;         /// helix radius (<0 for straight tracks)
+  std::vector<Int_t>    fPartnerOffset; /// offsets of the partner lists (size fNTracks+1)
+  std::vector<Int_t>    fPartner;   /// partner indices, sorted per track
+
+  /// \cond CLASSIMP
+  ClassDef(AliVertexingHFTrackSnapshot,2); // per-event helix snapshot of HF vertexing tracks
+  /// \endcond
+};
+
+#endif
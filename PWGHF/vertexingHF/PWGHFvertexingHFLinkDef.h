@@ -15,6 +15,7 @@
 #pragma link C++ class AliAODPidHF+;
 #pragma link C++ class AliRDHFCuts+;
 #pragma link C++ class AliVertexingHFUtils+;
+#pragma link C++ class AliVertexingHFTrackSnapshot+;
 #pragma link C++ class AliHFSystErr+;
 #pragma link C++ class AliRDHFCutsD0toKpi+;
 #pragma link C++ class AliRDHFCutsB0toDStarPi+;
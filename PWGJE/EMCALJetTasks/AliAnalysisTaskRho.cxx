@@ -40,6 +40,8 @@ Bool_t AliAnalysisTaskRho::Run()
   fOutRho->SetVal(0);
   if (fOutRhoScaled)
     fOutRhoScaled->SetVal(0);
+  if (fOutRhoMass)
+    fOutRhoMass->SetVal(0);
 
   if (!fJets)
     return kFALSE;
@@ -76,8 +78,9 @@ Bool_t AliAnalysisTaskRho::Run()
     }
   }
 
-  static Double_t rhovec[999];
-  Int_t NjetAcc = 0;
+  fRhoBuffer.clear();
+  fRhoMassBuffer.clear();
+  fAreaBuffer.clear();
 
   // push all jets within selected acceptance into stack
   for (Int_t iJets = 0; iJets < Njets; ++iJets) {
@@ -95,20 +98,25 @@ Bool_t AliAnalysisTaskRho::Run()
     if (!AcceptJet(jet))
       continue;
 
-    rhovec[NjetAcc] = jet->Pt() / jet->Area();
-    ++NjetAcc;
+    fRhoBuffer.push_back(jet->Pt() / jet->Area());
+    if (fOutRhoMass)
+      fRhoMassBuffer.push_back(GetJetMd(jet) / jet->Area());
+    if (fAreaWeightedMedian)
+      fAreaBuffer.push_back(jet->Area());
   }
 
-
-  if (NjetAcc > 0) {
+  if (!fRhoBuffer.empty()) {
     //find median value
-    Double_t rho = TMath::Median(NjetAcc, rhovec);
+    Double_t rho = GetMedianDensity(fRhoBuffer);
     fOutRho->SetVal(rho);
 
     if (fOutRhoScaled) {
       Double_t rhoScaled = rho * GetScaleFactor(fCent);
       fOutRhoScaled->SetVal(rhoScaled);
     }
+
+    if (fOutRhoMass)
+      fOutRhoMass->SetVal(GetMedianDensity(fRhoMassBuffer));
   }
 
   return kTRUE;
@@ -118,7 +126,7 @@ Bool_t AliAnalysisTaskRho::Run()
 AliAnalysisTaskRho* AliAnalysisTaskRho::AddTaskRhoNew (
     const char* nTracks, const char* nClusters, const char* nRho,
     Double_t jetradius, UInt_t acceptance,  AliJetContainer::EJetType_t jetType, const Bool_t histo,
-    AliJetContainer::ERecoScheme_t rscheme, const char* suffix
+    AliJetContainer::ERecoScheme_t rscheme, const char* suffix, const char* nJets
 )
 {
   // Get the pointer to the existing analysis manager via the static access method.
@@ -209,7 +217,19 @@ AliAnalysisTaskRho* AliAnalysisTaskRho::AddTaskRhoNew (
     clusterCont->SetDefaultClusterEnergy(AliVCluster::kHadCorr);
   }
 
-  AliJetContainer *jetCont = rhotask->AddJetContainer(jetType, AliJetContainer::kt_algorithm, rscheme, jetradius, acceptance, partCont, clusterCont);
+  // kT jets with ghost area already produced by an AliEmcalJetTask can be used directly by name,
+  // otherwise the jet branch name is derived from the jet definition
+  AliJetContainer *jetCont = 0;
+  if (strcmp(nJets,"") != 0) {
+    jetCont = rhotask->AddJetContainer(nJets, acceptance, jetradius);
+    if (jetCont) {
+      jetCont->ConnectParticleContainer(partCont);
+      jetCont->ConnectClusterContainer(clusterCont);
+    }
+  }
+  else {
+    jetCont = rhotask->AddJetContainer(jetType, AliJetContainer::kt_algorithm, rscheme, jetradius, acceptance, partCont, clusterCont);
+  }
   if (jetCont) jetCont->SetJetPtCut(0);
 
   //-------------------------------------------------------
@@ -58,7 +58,8 @@ class AliAnalysisTaskRho : public AliAnalysisTaskRhoBase {
     AliJetContainer::EJetType_t jetType           = AliJetContainer::kChargedJet,
     const Bool_t   histo                          = kFALSE,
     AliJetContainer::ERecoScheme_t rscheme        = AliJetContainer::pt_scheme,
-    const char    *suffix                         = ""
+    const char    *suffix                         = "",
+    const char    *nJets                          = ""
 );
 
  protected:
@@ -24,6 +24,8 @@
  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
  ************************************************************************************/
+#include <algorithm>
+
 #include <TFile.h>
 #include <TF1.h>
 #include <TH1F.h>
@@ -31,6 +33,7 @@
 #include <TH3F.h>
 #include <TClonesArray.h>
 #include <TGrid.h>
+#include <TMath.h>
 
 #include "AliLog.h"
 #include "AliRhoParameter.h"
@@ -38,6 +41,7 @@
 #include "AliParticleContainer.h"
 #include "AliClusterContainer.h"
 #include "AliVVZERO.h"
+#include "AliVParticle.h"
 
 #include "AliAnalysisTaskRhoBase.h"
 
@@ -54,10 +58,17 @@ AliAnalysisTaskRhoBase::AliAnalysisTaskRhoBase() :
   fInEventSigmaRho(35.83),
   fAttachToEvent(kTRUE),
   fIsPbPb(kTRUE),
+  fOutRhoMassName(),
+  fAreaWeightedMedian(kFALSE),
   fOutRho(0),
   fOutRhoScaled(0),
   fCompareRho(0),
   fCompareRhoScaled(0),
+  fOutRhoMass(0),
+  fRhoBuffer(),
+  fRhoMassBuffer(),
+  fAreaBuffer(),
+  fIndexBuffer(),
   fHistJetPtvsCent(0),
   fHistJetAreavsCent(0),
   fHistJetRhovsCent(0),
@@ -96,10 +107,17 @@ AliAnalysisTaskRhoBase::AliAnalysisTaskRhoBase(const char *name, Bool_t histo) :
   fInEventSigmaRho(35.83),
   fAttachToEvent(kTRUE),
   fIsPbPb(kTRUE),
+  fOutRhoMassName(),
+  fAreaWeightedMedian(kFALSE),
   fOutRho(0),
   fOutRhoScaled(0),
   fCompareRho(0),
   fCompareRhoScaled(0),
+  fOutRhoMass(0),
+  fRhoBuffer(),
+  fRhoMassBuffer(),
+  fAreaBuffer(),
+  fIndexBuffer(),
   fHistJetPtvsCent(0),
   fHistJetAreavsCent(0),
   fHistJetRhovsCent(0),
@@ -429,6 +447,19 @@ void AliAnalysisTaskRhoBase::ExecOnce()
     }
   }
 
+  if (!fOutRhoMassName.IsNull() && !fOutRhoMass) {
+    fOutRhoMass = new AliRhoParameter(fOutRhoMassName, 0);
+
+    if (fAttachToEvent) {
+      if (!(InputEvent()->FindListObject(fOutRhoMassName))) {
+        InputEvent()->AddObject(fOutRhoMass);
+      } else {
+        AliFatal(Form("%s: Container with same name %s already present. Aborting", GetName(), fOutRhoMassName.Data()));
+        return;
+      }
+    }
+  }
+
   if (!fCompareRhoName.IsNull() && !fCompareRho) {
     fCompareRho = dynamic_cast<AliRhoParameter*>(InputEvent()->FindListObject(fCompareRhoName));
     if (!fCompareRho) {
@@ -493,3 +524,79 @@ TF1* AliAnalysisTaskRhoBase::LoadRhoFunction(const char* path, const char* name)
 
   return fScaleFunction;
 }
+
+Double_t AliAnalysisTaskRhoBase::GetMedian(std::vector<Double_t>& values)
+{
+  const Int_t n = values.size();
+  if (n == 0) return 0;
+
+  std::vector<Double_t>::iterator mid = values.begin() + n / 2;
+  std::nth_element(values.begin(), mid, values.end());
+  if (n % 2) return *mid;
+
+  // even number of values: average with the largest value of the lower half
+  return 0.5 * (*mid + *std::max_element(values.begin(), mid));
+}
+
+namespace {
+  struct IndexValueLess {
+    IndexValueLess(const std::vector<Double_t>& v) : fValues(v) {}
+    bool operator()(Int_t i, Int_t j) const { return fValues[i] < fValues[j]; }
+    const std::vector<Double_t>& fValues;
+  };
+}
+
+Double_t AliAnalysisTaskRhoBase::GetWeightedMedian(const std::vector<Double_t>& values, const std::vector<Double_t>& weights, std::vector<Int_t>& index)
+{
+  const Int_t n = values.size();
+  if (n == 0) return 0;
+
+  index.resize(n);
+  Double_t half = 0;
+  for (Int_t i = 0; i < n; i++) {
+    index[i] = i;
+    half += weights[i];
+  }
+  half *= 0.5;
+
+  // quickselect on the weight: the median lies in [lo,hi), wBelow is the weight of [0,lo)
+  IndexValueLess less(values);
+  Int_t lo = 0, hi = n;
+  Double_t wBelow = 0;
+  while (hi - lo > 1) {
+    Int_t mid = lo + (hi - lo) / 2;
+    std::nth_element(index.begin() + lo, index.begin() + mid, index.begin() + hi, less);
+    Double_t wLeft = wBelow;
+    for (Int_t i = lo; i < mid; i++) wLeft += weights[index[i]];
+    if (wLeft >= half) {
+      hi = mid;
+    }
+    else if (wLeft + weights[index[mid]] >= half) {
+      return values[index[mid]];
+    }
+    else {
+      wBelow = wLeft + weights[index[mid]];
+      lo = mid + 1;
+    }
+  }
+  return values[index[lo < n ? lo : n - 1]];
+}
+
+Double_t AliAnalysisTaskRhoBase::GetMedianDensity(std::vector<Double_t>& values)
+{
+  if (fAreaWeightedMedian) return GetWeightedMedian(values, fAreaBuffer, fIndexBuffer);
+  return GetMedian(values);
+}
+
+Double_t AliAnalysisTaskRhoBase::GetJetMd(AliEmcalJet *jet) const
+{
+  Double_t sum = 0.;
+  if (!fTracks) return sum;
+
+  for (Int_t icc = 0; icc < jet->GetNumberOfTracks(); icc++) {
+    AliVParticle *vp = static_cast<AliVParticle*>(jet->TrackAt(icc, fTracks));
+    if (!vp) continue;
+    sum += TMath::Sqrt(vp->M()*vp->M() + vp->Pt()*vp->Pt()) - vp->Pt();
+  }
+  return sum;
+}
@@ -27,12 +27,15 @@
 #ifndef ALIANALYSISTASKRHOBASE_H
 #define ALIANALYSISTASKRHOBASE_H
 
+#include <vector>
+
 class TString;
 class TF1;
 class TH1F;
 class TH2F;
 class TH3F;
 class AliRhoParameter;
+class AliEmcalJet;
 
 #include "AliAnalysisTaskEmcalJet.h"
 
@@ -71,6 +74,7 @@ class AliAnalysisTaskRhoBase : public AliAnalysisTaskEmcalJet {
 
   void                   SetOutRhoName(const char *name)                       { fOutRhoName           = name    ;
                                                                                  fOutRhoScaledName     = Form("%s_Scaled",name);     }
+  void                   SetOutRhoMassName(const char *name)                   { fOutRhoMassName       = name    ;                   }
   void                   SetCompareRhoName(const char *name)                   { fCompareRhoName       = name    ;                   }
   void                   SetCompareRhoScaledName(const char *name)             { fCompareRhoScaledName = name    ;                   }
   void                   SetScaleFunction(TF1* sf)                             { fScaleFunction        = sf      ;                   }
@@ -85,6 +89,28 @@ class AliAnalysisTaskRhoBase : public AliAnalysisTaskEmcalJet {
   void                   SetInEventSigmaRho(Double_t s)                        { fInEventSigmaRho      = s       ;                   }
   void                   SetAttachToEvent(Bool_t a)                            { fAttachToEvent        = a       ;                   }
   void                   SetSmallSystem(Bool_t setter = kTRUE)                 { fIsPbPb               = !setter ;                   }
+  void                   SetAreaWeightedMedian(Bool_t b = kTRUE)               { fAreaWeightedMedian   = b       ;                   }
+
+  /**
+   * @brief Median of a set of values, equivalent to TMath::Median.
+   *
+   * Uses a linear-time selection (std::nth_element) instead of a full sort.
+   * The values are partially reordered.
+   * @param values Values (reordered on output)
+   * @return Median value, 0 for an empty set
+   */
+  static Double_t        GetMedian(std::vector<Double_t>& values);
+  /**
+   * @brief Weighted median of a set of values.
+   *
+   * Smallest value for which the cumulative weight of the values not larger than it
+   * reaches half of the total weight. Linear-time selection on an index buffer.
+   * @param values Values
+   * @param weights Weights (same size as values)
+   * @param index Work buffer, resized as needed
+   * @return Weighted median value, 0 for an empty set
+   */
+  static Double_t        GetWeightedMedian(const std::vector<Double_t>& values, const std::vector<Double_t>& weights, std::vector<Int_t>& index);
 
   const char*            GetOutRhoName() const                                 { return fOutRhoName.Data()       ;                   }
   const char*            GetOutRhoScaledName() const                           { return fOutRhoScaledName.Data() ;                   }
@@ -120,6 +146,20 @@ class AliAnalysisTaskRhoBase : public AliAnalysisTaskEmcalJet {
    */
   virtual Double_t       GetScaleFactor(Double_t cent);
 
+  /**
+   * @brief Median of the per-jet densities of the event (area weighted if requested).
+   * @param values Per-jet densities, in the same order as fAreaBuffer
+   * @return Median density
+   */
+  Double_t               GetMedianDensity(std::vector<Double_t>& values);
+
+  /**
+   * @brief Sum of (m_T - p_T) of the jet constituents, as for AliAnalysisTaskRhoMass (kMd).
+   * @param jet Jet
+   * @return Sum over the jet tracks
+   */
+  Double_t               GetJetMd(AliEmcalJet *jet) const;
+
   TString                fOutRhoName;                    ///< name of output rho object
   TString                fOutRhoScaledName;              ///< name of output scaled rho object
   TString                fCompareRhoName;                ///< name of rho object to compare
@@ -129,11 +169,19 @@ class AliAnalysisTaskRhoBase : public AliAnalysisTaskEmcalJet {
   Double_t               fInEventSigmaRho;               ///< in-event sigma rho
   Bool_t                 fAttachToEvent;                 ///< whether or not attach rho to the event objects list
   Bool_t                 fIsPbPb;                        ///< different histogram ranges for pp/pPb and PbPb
+  TString                fOutRhoMassName;                ///< name of output rho_m object, computed in the same jet loop as rho (optional)
+  Bool_t                 fAreaWeightedMedian;            ///< weight the jets with their area in the median
   
   AliRhoParameter       *fOutRho;                        //!<! output rho object
   AliRhoParameter       *fOutRhoScaled;                  //!<! output scaled rho object
   AliRhoParameter       *fCompareRho;                    //!<! rho object to compare
   AliRhoParameter       *fCompareRhoScaled;              //!<! scaled rho object to compare
+  AliRhoParameter       *fOutRhoMass;                    //!<! output rho_m object
+
+  std::vector<Double_t>  fRhoBuffer;                     //!<! per-jet pt/area of the accepted jets, reused across events
+  std::vector<Double_t>  fRhoMassBuffer;                 //!<! per-jet m_delta/area of the accepted jets
+  std::vector<Double_t>  fAreaBuffer;                    //!<! area of the accepted jets
+  std::vector<Int_t>     fIndexBuffer;                   //!<! work buffer of the weighted median
 
   TH2F                  *fHistJetPtvsCent;               //!<! jet pt vs. centrality
   TH2F                  *fHistJetAreavsCent;             //!<! jet area vs. centrality
@@ -161,6 +209,6 @@ class AliAnalysisTaskRhoBase : public AliAnalysisTaskEmcalJet {
   AliAnalysisTaskRhoBase(const AliAnalysisTaskRhoBase&);             // not implemented
   AliAnalysisTaskRhoBase& operator=(const AliAnalysisTaskRhoBase&);  // not implemented
   
-  ClassDef(AliAnalysisTaskRhoBase, 11); // Rho base task
+  ClassDef(AliAnalysisTaskRhoBase, 12); // Rho base task
 };
 #endif
@@ -8,6 +8,8 @@
 
 #include "AliAnalysisTaskRhoSparse.h"
 
+#include <algorithm>
+
 #include <TClonesArray.h>
 #include <TMath.h>
 
@@ -27,7 +29,8 @@ AliAnalysisTaskRhoSparse::AliAnalysisTaskRhoSparse() :
   fRhoCMS(0),
   fUseTPCArea(0),
   fExcludeAreaExcludedJets(0),
-  fHistOccCorrvsCent(0)
+  fHistOccCorrvsCent(0),
+  fSignalTracks()
 {
 }
 
@@ -38,7 +41,8 @@ AliAnalysisTaskRhoSparse::AliAnalysisTaskRhoSparse(const char *name, Bool_t hist
   fRhoCMS(0),
   fUseTPCArea(0),
   fExcludeAreaExcludedJets(0),
-  fHistOccCorrvsCent(0)
+  fHistOccCorrvsCent(0),
+  fSignalTracks()
 {
 }
 
@@ -82,6 +86,8 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
   fOutRho->SetVal(0);
   if (fOutRhoScaled)
     fOutRhoScaled->SetVal(0);
+  if (fOutRhoMass)
+    fOutRhoMass->SetVal(0);
 
   if (!fJets)
     return kFALSE;
@@ -122,8 +128,26 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
     }
   }
 
-  static Double_t rhovec[999];
-  Int_t NjetAcc = 0;
+  // Track labels of the signal jets, collected once per event: a background jet
+  // overlaps with a signal jet if it shares at least one of these tracks
+  std::vector<Int_t>& sigTracks = fSignalTracks;
+  sigTracks.clear();
+  if (sigjets && fExcludeOverlaps) {
+    for (Int_t j = 0; j < NjetsSig; j++) {
+      AliEmcalJet* signalJet = sigjets->GetAcceptJet(j);
+      if (!signalJet)
+        continue;
+      if (!IsJetSignal(signalJet))
+        continue;
+      for (Int_t i = 0; i < signalJet->GetNumberOfTracks(); ++i)
+        sigTracks.push_back(signalJet->TrackAt(i));
+    }
+    std::sort(sigTracks.begin(), sigTracks.end());
+  }
+
+  fRhoBuffer.clear();
+  fRhoMassBuffer.clear();
+  fAreaBuffer.clear();
   Double_t TotaljetAreaPhys=0;
   Double_t TotalAreaCovered=0;
   Double_t TotalTPCArea=2*TMath::Pi()*0.9;
@@ -159,27 +183,18 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
     if (!AcceptJet(jet))
       continue;
 
-    // Search for overlap with signal jets
-    Bool_t isOverlapping = kFALSE;
-    if (sigjets) {
-      for(Int_t j=0;j<NjetsSig;j++)
-      {
-        AliEmcalJet* signalJet = sigjets->GetAcceptJet(j);
-        if(!signalJet)
-          continue;
-        if(!IsJetSignal(signalJet))
-          continue;
-
-        if(IsJetOverlapping(signalJet, jet))
-        {
+    // Exclude background jets that overlap with anti-kT signal jets
+    if (!sigTracks.empty()) {
+      Bool_t isOverlapping = kFALSE;
+      for (Int_t i = 0; i < jet->GetNumberOfTracks(); ++i) {
+        if (std::binary_search(sigTracks.begin(), sigTracks.end(), jet->TrackAt(i))) {
           isOverlapping = kTRUE;
           break;
         }
       }
+      if (isOverlapping)
+        continue;
     }
-    // Exclude background jets that overlap with anti-kT signal jets
-    if(fExcludeOverlaps && isOverlapping)
-      continue;
 
     // Take into account only real jets (no pure ghost jets) that also
     // contribute to the rho calculation
@@ -201,8 +216,11 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
     // Eg. real signal jets should not bias the background rho
     if(jet->GetNumberOfTracks()>0)
     {
-      rhovec[NjetAcc] = jet->Pt() / jet->Area();
-      ++NjetAcc;
+      fRhoBuffer.push_back(jet->Pt() / jet->Area());
+      if (fOutRhoMass)
+        fRhoMassBuffer.push_back(GetJetMd(jet) / jet->Area());
+      if (fAreaWeightedMedian)
+        fAreaBuffer.push_back(jet->Area());
     }
   }
 
@@ -221,9 +239,9 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
   if (fCreateHisto)
     fHistOccCorrvsCent->Fill(fCent, OccCorr);
 
-  if (NjetAcc > 0) {
+  if (!fRhoBuffer.empty()) {
     //find median value
-    Double_t rho = TMath::Median(NjetAcc, rhovec);
+    Double_t rho = GetMedianDensity(fRhoBuffer);
 
     if(fRhoCMS){
       rho = rho * OccCorr;
@@ -235,6 +253,14 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
       Double_t rhoScaled = rho * GetScaleFactor(fCent);
       fOutRhoScaled->SetVal(rhoScaled);
     }
+
+    if (fOutRhoMass) {
+      Double_t rhom = GetMedianDensity(fRhoMassBuffer);
+      if(fRhoCMS){
+        rhom = rhom * OccCorr;
+      }
+      fOutRhoMass->SetVal(rhom);
+    }
   }
 
   return kTRUE;
@@ -254,7 +280,8 @@ AliAnalysisTaskRhoSparse* AliAnalysisTaskRhoSparse::AddTaskRhoSparse(
     Double_t       jetptcut,
     Double_t       jetareacut,
     Double_t       emcareacut,
-    const char    *suffix
+    const char    *suffix,
+    const char    *nJetsBkg
 )
 {
 
@@ -358,7 +385,19 @@ AliAnalysisTaskRhoSparse* AliAnalysisTaskRhoSparse::AddTaskRhoSparse(
   }
 
   //
-  AliJetContainer *bkgJetCont = rhotask->AddJetContainer(jetType, AliJetContainer::kt_algorithm, rscheme, jetradius, acceptance, partCont, clusterCont);
+  // kT jets with ghost area already produced by an AliEmcalJetTask can be used directly by name,
+  // otherwise the jet branch name is derived from the jet definition
+  AliJetContainer *bkgJetCont = 0;
+  if (strcmp(nJetsBkg,"") != 0) {
+    bkgJetCont = rhotask->AddJetContainer(nJetsBkg, acceptance, jetradius);
+    if (bkgJetCont) {
+      bkgJetCont->ConnectParticleContainer(partCont);
+      bkgJetCont->ConnectClusterContainer(clusterCont);
+    }
+  }
+  else {
+    bkgJetCont = rhotask->AddJetContainer(jetType, AliJetContainer::kt_algorithm, rscheme, jetradius, acceptance, partCont, clusterCont);
+  }
   if (bkgJetCont) {
     //why?? bkgJetCont->SetJetAreaCut(jetareacut);
     //why?? bkgJetCont->SetAreaEmcCut(emcareacut);
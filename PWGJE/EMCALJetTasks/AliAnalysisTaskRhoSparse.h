@@ -73,7 +73,8 @@ class AliAnalysisTaskRhoSparse : public AliAnalysisTaskRhoBase {
   		Double_t       jetptcut    = 0.0,
   		Double_t       jetareacut  = 0.01,
   		Double_t       emcareacut  = 0,
-  		const char    *suffix      = ""
+  		const char    *suffix      = "",
+  		const char    *nJetsBkg    = ""
   		);
 
   /**
@@ -119,10 +120,11 @@ class AliAnalysisTaskRhoSparse : public AliAnalysisTaskRhoBase {
   Bool_t           fUseTPCArea;                                       ///< use the full TPC area for the denominator of the occupancy calculation
   Bool_t           fExcludeAreaExcludedJets;                          ///<
   TH2F            *fHistOccCorrvsCent;            				            //!<! occupancy correction vs. centrality
+  std::vector<Int_t> fSignalTracks;                                  //!<! sorted track labels of the signal jets in the event
 
   AliAnalysisTaskRhoSparse(const AliAnalysisTaskRhoSparse&);           ///< not implemented
   AliAnalysisTaskRhoSparse& operator=(const AliAnalysisTaskRhoSparse&);///< not implemented
   
-  ClassDef(AliAnalysisTaskRhoSparse, 2);                               ///< Rho task
+  ClassDef(AliAnalysisTaskRhoSparse, 3);                               ///< Rho task
 };
 #endif
@@ -24,6 +24,7 @@
  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS      *
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                       *
  **************************************************************************************/
+#include <thread>
 #include <vector>
 
 #include <TClonesArray.h>
@@ -97,8 +98,16 @@ AliEmcalJetTask::AliEmcalJetTask() :
   fEnableAliBasicParticleCompatibility(kFALSE),
   fLegacyMode(kFALSE),
   fFillGhost(kFALSE),
+  fExtraJetAlgos(),
+  fExtraRadii(),
+  fExtraRecombSchemes(),
+  fNThreads(1),
   fJets(0),
   fFastJetWrapper("AliEmcalJetTask","AliEmcalJetTask"),
+  fExtraWrappers(),
+  fExtraJets(),
+  fSharedGhosts(),
+  fSharedGhostArea(0),
   fClusterContainerIndexMap(),
   fParticleContainerIndexMap()
 {
@@ -138,8 +147,16 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
   fEnableAliBasicParticleCompatibility(kFALSE),
   fLegacyMode(kFALSE),
   fFillGhost(kFALSE),
+  fExtraJetAlgos(),
+  fExtraRadii(),
+  fExtraRecombSchemes(),
+  fNThreads(1),
   fJets(0),
   fFastJetWrapper(name,name),
+  fExtraWrappers(),
+  fExtraJets(),
+  fSharedGhosts(),
+  fSharedGhostArea(0),
   fClusterContainerIndexMap(),
   fParticleContainerIndexMap()
 {
@@ -150,6 +167,23 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
  */
 AliEmcalJetTask::~AliEmcalJetTask()
 {
+  for (UInt_t i = 0; i < fExtraWrappers.size(); i++) delete fExtraWrappers[i];
+}
+
+/**
+ * Add a jet definition to be run in addition to the main one. The additional definitions
+ * use the same input vectors (prepared once per event) and the same jet type, tag and
+ * jet cuts as the main one. The name of the jet branch is generated as for the main definition.
+ * @param algo Jet algorithm
+ * @param r Jet radius
+ * @param scheme Recombination scheme
+ */
+void AliEmcalJetTask::AddJetDefinition(EJetAlgo_t algo, Double_t r, ERecoScheme_t scheme)
+{
+  if (IsLocked()) return;
+  fExtraJetAlgos.push_back(algo);
+  fExtraRadii.push_back(r);
+  fExtraRecombSchemes.push_back(scheme);
 }
 
 /**
@@ -233,11 +267,15 @@ Bool_t AliEmcalJetTask::Run()
   InitEvent();
   // clear the jet array (normally a null operation)
   fJets->Delete();
+  for (UInt_t i = 0; i < fExtraJets.size(); i++) fExtraJets[i]->Delete();
   Int_t n = FindJets();
 
   if (n == 0) return kFALSE;
 
   FillJetBranch();
+  for (UInt_t i = 0; i < fExtraWrappers.size(); i++) {
+    FillJetBranch(*fExtraWrappers[i], fExtraJets[i], fExtraWrappers[i]->GetR(), kFALSE);
+  }
 
   return kTRUE;
 }
@@ -323,9 +361,44 @@ Int_t AliEmcalJetTask::FindJets()
   // run jet finder
   fFastJetWrapper.Run();
 
+  if (!fExtraWrappers.empty()) {
+    // the additional jet definitions get a copy of the input vectors and one common set of ghosts
+    fSharedGhostArea = fFastJetWrapper.GenerateGhosts(fSharedGhosts);
+    for (UInt_t i = 0; i < fExtraWrappers.size(); i++) {
+      fExtraWrappers[i]->Clear();
+      fExtraWrappers[i]->SetInputVectors(fFastJetWrapper.GetInputVectors());
+    }
+
+    Int_t nThreads = TMath::Min(fNThreads, (Int_t)fExtraWrappers.size());
+    if (nThreads <= 1) {
+      RunExtraJetFinders(0, 1);
+    }
+    else {
+      std::vector<std::thread> threads;
+      for (Int_t i = 0; i < nThreads; i++) {
+        threads.push_back(std::thread(&AliEmcalJetTask::RunExtraJetFinders, this, i, nThreads));
+      }
+      for (UInt_t i = 0; i < threads.size(); i++) threads[i].join();
+    }
+  }
+
   return fFastJetWrapper.GetInclusiveJets().size();
 }
 
+/**
+ * Run the jet finders of the additional jet definitions first, first+step, ...
+ * Each wrapper only reads the shared inputs and ghosts, hence this method can be
+ * called concurrently from several threads with different values of first.
+ * @param first Index of the first jet definition
+ * @param step Index step
+ */
+void AliEmcalJetTask::RunExtraJetFinders(Int_t first, Int_t step)
+{
+  for (UInt_t i = first; i < fExtraWrappers.size(); i += step) {
+    fExtraWrappers[i]->RunWithGhosts(fSharedGhosts, fSharedGhostArea);
+  }
+}
+
 /**
  * This method fills the jet output branch (TClonesArray) with the jet found by the FastJet
  * wrapper. Before filling the jet branch, the utilities are prepared. Then the utilities are
@@ -335,8 +408,22 @@ void AliEmcalJetTask::FillJetBranch()
 {
   PrepareUtilities();
 
+  FillJetBranch(fFastJetWrapper, fJets, fRadius, kTRUE);
+
+  TerminateUtilities();
+}
+
+/**
+ * This method fills a jet output branch (TClonesArray) with the jets found by a FastJet wrapper.
+ * @param fjw FastJet wrapper after jet finding
+ * @param jets Output jet branch
+ * @param radius Jet radius used to determine the jet acceptance type
+ * @param runUtilities If kTRUE the utilities are executed for each jet
+ */
+void AliEmcalJetTask::FillJetBranch(AliFJWrapper& fjw, TClonesArray* jets, Double_t radius, Bool_t runUtilities)
+{
   // loop over fastjet jets
-  std::vector<fastjet::PseudoJet> jets_incl = fFastJetWrapper.GetInclusiveJets();
+  const std::vector<fastjet::PseudoJet>& jets_incl = fjw.GetInclusiveJets();
   // sort jets according to jet pt
   static Int_t indexes[9999] = {-1};
   GetSortedArray(indexes, jets_incl);
@@ -344,27 +431,27 @@ void AliEmcalJetTask::FillJetBranch()
   AliDebug(1,Form("%d jets found", (Int_t)jets_incl.size()));
   for (UInt_t ijet = 0, jetCount = 0; ijet < jets_incl.size(); ++ijet) {
     Int_t ij = indexes[ijet];
-    AliDebug(3,Form("Jet pt = %f, area = %f", jets_incl[ij].perp(), fFastJetWrapper.GetJetArea(ij)));
+    AliDebug(3,Form("Jet pt = %f, area = %f", jets_incl[ij].perp(), fjw.GetJetArea(ij)));
 
     if (jets_incl[ij].perp() < fMinJetPt) continue;
-    if (fFastJetWrapper.GetJetArea(ij) < fMinJetArea) continue;
+    if (fjw.GetJetArea(ij) < fMinJetArea) continue;
     if ((jets_incl[ij].eta() < fJetEtaMin) || (jets_incl[ij].eta() > fJetEtaMax) ||
         (jets_incl[ij].phi() < fJetPhiMin) || (jets_incl[ij].phi() > fJetPhiMax))
       continue;
 
-    AliEmcalJet *jet = new ((*fJets)[jetCount])
+    AliEmcalJet *jet = new ((*jets)[jetCount])
     		          AliEmcalJet(jets_incl[ij].perp(), jets_incl[ij].eta(), jets_incl[ij].phi(), jets_incl[ij].m());
     jet->SetLabel(ij);
 
-    fastjet::PseudoJet area(fFastJetWrapper.GetJetAreaVector(ij));
+    fastjet::PseudoJet area(fjw.GetJetAreaVector(ij));
     jet->SetArea(area.perp());
     jet->SetAreaEta(area.eta());
     jet->SetAreaPhi(area.phi());
     jet->SetAreaE(area.E());
-    jet->SetJetAcceptanceType(FindJetAcceptanceType(jet->Eta(), jet->Phi_0_2pi(), fRadius));
+    jet->SetJetAcceptanceType(FindJetAcceptanceType(jet->Eta(), jet->Phi_0_2pi(), radius));
 
     // Fill constituent info
-    std::vector<fastjet::PseudoJet> constituents(fFastJetWrapper.GetJetConstituents(ij));
+    std::vector<fastjet::PseudoJet> constituents(fjw.GetJetConstituents(ij));
     FillJetConstituents(jet, constituents, constituents);
 
     if (fGeom) {
@@ -375,13 +462,11 @@ void AliEmcalJetTask::FillJetBranch()
         jet->SetAxisInEmcal(kTRUE);
     }
 
-    ExecuteUtilities(jet, ij);
+    if (runUtilities) ExecuteUtilities(jet, ij);
 
     AliDebug(2,Form("Added jet n. %d, pt = %f, area = %f, constituents = %d", jetCount, jet->Pt(), jet->Area(), jet->GetNumberOfConstituents()));
     jetCount++;
   }
-
-  TerminateUtilities();
 }
 
 /**
@@ -390,7 +475,7 @@ void AliEmcalJetTask::FillJetBranch()
  * @param[in] array Vector containing the list of jets obtained by the FastJet wrapper
  * @return kTRUE if at least one jet was found in array; kFALSE otherwise
  */
-Bool_t AliEmcalJetTask::GetSortedArray(Int_t indexes[], std::vector<fastjet::PseudoJet> array) const
+Bool_t AliEmcalJetTask::GetSortedArray(Int_t indexes[], const std::vector<fastjet::PseudoJet>& array) const
 {
   static Float_t pt[9999] = {0};
 
@@ -472,6 +557,28 @@ void AliEmcalJetTask::ExecOnce()
     fFastJetWrapper.SetLegacyMode(kTRUE);
   }
 
+  // additional jet definitions: same settings as the main wrapper except algorithm, radius and scheme
+  for (UInt_t i = 0; i < fExtraJetAlgos.size(); i++) {
+    TString jetsName = AliJetContainer::GenerateJetName(fJetType, (EJetAlgo_t)fExtraJetAlgos[i], (ERecoScheme_t)fExtraRecombSchemes[i], fExtraRadii[i],
+                                                        GetParticleContainer(0), GetClusterContainer(0), fJetsTag);
+    if (InputEvent()->FindListObject(jetsName)) {
+      AliError(Form("%s: Object with name %s already in event! Skipping this jet definition", GetName(), jetsName.Data()));
+      continue;
+    }
+    TClonesArray* jets = new TClonesArray("AliEmcalJet");
+    jets->SetName(jetsName);
+    ::Info("AliEmcalJetTask::ExecOnce", "Jet collection with name '%s' has been added to the event.", jetsName.Data());
+    InputEvent()->AddObject(jets);
+    fExtraJets.push_back(jets);
+
+    AliFJWrapper* fjw = new AliFJWrapper(jetsName, jetsName);
+    fjw->CopySettingsFrom(fFastJetWrapper);
+    fjw->SetR(fExtraRadii[i]);
+    fjw->SetAlgorithm(ConvertToFJAlgo((EJetAlgo_t)fExtraJetAlgos[i]));
+    fjw->SetRecombScheme(ConvertToFJRecoScheme((ERecoScheme_t)fExtraRecombSchemes[i]));
+    fExtraWrappers.push_back(fjw);
+  }
+
   InitUtilities();
 
   AliAnalysisTaskEmcal::ExecOnce();
@@ -71,6 +71,12 @@ namespace fastjet {
  * and its derived classes. Utilities can be added via the AddUtility(AliEmcalJetUtility*) method.
  * All the utilities added in the list will be executed. Users can implement new utilities
  * deriving a new class from AliEmcalJetUtility to interface functionalities of the FastJet contribs.
+ *
+ * Additional jet definitions (algorithm, radius, recombination scheme) can be added via
+ * AddJetDefinition(). They are run on the same input vectors as the main definition, which
+ * are prepared only once per event, and share one set of ghosts; each of them fills its own
+ * jet branch. With SetNumberOfThreads() the additional clusterings run in parallel.
+ * The utilities are executed for the main jet definition only.
  */
 class AliEmcalJetTask : public AliAnalysisTaskEmcal {
  public:
@@ -108,6 +114,8 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   void                   SetLegacyMode(Bool_t mode)                 { if (IsLocked()) return; fLegacyMode       = mode  ; }
   void                   SetFillGhost(Bool_t b=kTRUE)               { if (IsLocked()) return; fFillGhost        = b     ; }
   void                   SetRadius(Double_t r)                      { if (IsLocked()) return; fRadius           = r     ; }
+  void                   SetNumberOfThreads(Int_t n)                { if (IsLocked()) return; fNThreads         = n     ; }
+  void                   AddJetDefinition(EJetAlgo_t algo, Double_t r, ERecoScheme_t scheme);
 
   void                   SetEtaRange(Double_t emi, Double_t ema);
   void                   SetMinJetClusPt(Double_t min);
@@ -136,6 +144,8 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   Bool_t                 GetTrackEfficiencyOnlyForEmbedding() { return fTrackEfficiencyOnlyForEmbedding; }
 
   TClonesArray*          GetJets()                        { return fJets              ; }
+  Int_t                  GetNExtraJetCollections() const  { return fExtraJets.size()  ; }
+  TClonesArray*          GetExtraJets(Int_t i)            { return fExtraJets[i]      ; }
   TObjArray*             GetUtilities()                   { return fUtilities         ; }
 
   void                   FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet::PseudoJet>& constituents,
@@ -184,13 +194,15 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
 
   Int_t                  FindJets();
   void                   FillJetBranch();
+  void                   FillJetBranch(AliFJWrapper& fjw, TClonesArray* jets, Double_t radius, Bool_t runUtilities);
+  void                   RunExtraJetFinders(Int_t first, Int_t step);
   void                   ExecOnce();
   void                   InitEvent();
   void                   InitUtilities();
   void                   PrepareUtilities();
   void                   ExecuteUtilities(AliEmcalJet* jet, Int_t ij);
   void                   TerminateUtilities();
-  Bool_t                 GetSortedArray(Int_t indexes[], std::vector<fastjet::PseudoJet> array) const;
+  Bool_t                 GetSortedArray(Int_t indexes[], const std::vector<fastjet::PseudoJet>& array) const;
   Bool_t                 IsJetInEmcal(Double_t eta, Double_t phi, Double_t r);
   Bool_t                 IsJetInDcal(Double_t eta, Double_t phi, Double_t r);
   Bool_t                 IsJetInDcalOnly(Double_t eta, Double_t phi, Double_t r);
@@ -227,9 +239,17 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   Bool_t                 fEnableAliBasicParticleCompatibility; ///< Flag to allow compatibility with AliBasicParticle constituents
   Bool_t                 fLegacyMode;             //!<!=true to enable FJ 2.x behavior
   Bool_t                 fFillGhost;              ///< =true ghost particles will be filled in AliEmcalJet obj
+  std::vector<Int_t>     fExtraJetAlgos;          ///< jet algorithms of the additional jet definitions
+  std::vector<Double_t>  fExtraRadii;             ///< radii of the additional jet definitions
+  std::vector<Int_t>     fExtraRecombSchemes;     ///< recombination schemes of the additional jet definitions
+  Int_t                  fNThreads;               ///< number of threads running the additional jet definitions
 
   TClonesArray          *fJets;                   //!<!jet collection
   AliFJWrapper           fFastJetWrapper;         //!<!fastjet wrapper
+  std::vector<AliFJWrapper*> fExtraWrappers;      //!<!fastjet wrappers of the additional jet definitions (owned)
+  std::vector<TClonesArray*> fExtraJets;          //!<!jet collections of the additional jet definitions
+  std::vector<fastjet::PseudoJet> fSharedGhosts;  //!<!ghosts shared by the additional jet definitions
+  Double_t               fSharedGhostArea;        //!<!actual area of the shared ghosts
 
   static const Int_t     fgkConstIndexShift;      //!<!contituent index shift
 
@@ -244,7 +264,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   AliEmcalJetTask &operator=(const AliEmcalJetTask&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalJetTask, 30);
+  ClassDef(AliEmcalJetTask, 31);
   /// \endcond
 };
 #endif
@@ -19,6 +19,7 @@ class AliFJWrapper
   virtual void  AddInputVector (Double_t px, Double_t py, Double_t pz, Double_t E, Int_t index = -99999);
   virtual void  AddInputVector (const fastjet::PseudoJet& vec,                Int_t index = -99999);
   virtual void  AddInputVectors(const std::vector<fastjet::PseudoJet>& vecs,  Int_t offsetIndex = -99999);
+  virtual void  SetInputVectors(const std::vector<fastjet::PseudoJet>& vecs)   { fInputVectors = vecs; }
   virtual void  AddInputGhost  (Double_t px, Double_t py, Double_t pz, Double_t E, Int_t index = -99999);
   virtual const char *ClassName()                            const { return "AliFJWrapper";              }
   virtual void  Clear(const Option_t* /*opt*/ = "");
@@ -40,6 +41,7 @@ class AliFJWrapper
   Double_t                                GetMedianUsedForBgSubtraction() const { return fMedUsedForBgSub; }
   const char*                             GetName()            const { return fName;                       }
   const char*                             GetTitle()           const { return fTitle;                      }
+  Double_t                                GetR()               const { return fR;                          }
   Double_t                                GetJetArea         (UInt_t idx) const;
   Double_t                                GetEventSubJetArea         (UInt_t idx) const;
   fastjet::PseudoJet                      GetJetAreaVector   (UInt_t idx) const;
@@ -88,6 +90,8 @@ class AliFJWrapper
   virtual void RemoveLastInputVector();
 
   virtual Int_t Run();
+  virtual Int_t RunWithGhosts(const std::vector<fastjet::PseudoJet>& ghosts, Double_t ghostArea);
+  virtual Double_t GenerateGhosts(std::vector<fastjet::PseudoJet>& ghosts) const;
   virtual Int_t Filter();
   virtual void  DoGenericSubtraction(const fastjet::FunctionOfPseudoJet<Double32_t>& jetshape, std::vector<fastjet::contrib::GenericSubtractorInfo>& output);
   virtual Int_t DoGenericSubtractionJetMass();
@@ -513,7 +517,8 @@ Double_t AliFJWrapper::GetJetArea(UInt_t idx) const
 
   Double_t retval = -1; // really wrong area..
   if ( idx < fInclusiveJets.size() ) {
-    retval = fClustSeq->area(fInclusiveJets[idx]);
+    if (fClustSeq) retval = fClustSeq->area(fInclusiveJets[idx]);
+    else           retval = fClustSeqActGhosts->area(fInclusiveJets[idx]);
   } else {
     AliError(Form("[e] ::GetJetArea wrong index: %d",idx));
   }
@@ -553,7 +558,8 @@ fastjet::PseudoJet AliFJWrapper::GetJetAreaVector(UInt_t idx) const
   // Get the jet area as vector.
   fastjet::PseudoJet retval;
   if ( idx < fInclusiveJets.size() ) {
-    retval = fClustSeq->area_4vector(fInclusiveJets[idx]);
+    if (fClustSeq) retval = fClustSeq->area_4vector(fInclusiveJets[idx]);
+    else           retval = fClustSeqActGhosts->area_4vector(fInclusiveJets[idx]);
   } else {
     AliError(Form("[e] ::GetJetArea wrong index: %d",idx));
   }
@@ -620,7 +626,8 @@ AliFJWrapper::GetJetConstituents(UInt_t idx) const
   std::vector<fastjet::PseudoJet> retval;
 
   if ( idx < fInclusiveJets.size() ) {
-    retval = fClustSeq->constituents(fInclusiveJets[idx]);
+    if (fClustSeq) retval = fClustSeq->constituents(fInclusiveJets[idx]);
+    else           retval = fClustSeqActGhosts->constituents(fInclusiveJets[idx]);
   } else {
     AliError(Form("[e] ::GetJetConstituents wrong index: %d",idx));
   }
@@ -772,6 +779,50 @@ Int_t AliFJWrapper::Run()
   return 0;
 }
 
+//_________________________________________________________________________________________________
+Double_t AliFJWrapper::GenerateGhosts(std::vector<fastjet::PseudoJet>& ghosts) const
+{
+  // Generate one set of ghosts with the ghost settings of this wrapper.
+  // The set can be given to RunWithGhosts() of several wrappers sharing the same input.
+  // Returns the actual ghost area (adjusted by FastJet to fit the grid).
+
+  ghosts.clear();
+  fj::GhostedAreaSpec ghostSpec(fMaxRap, 1, fGhostArea, fGridScatter, fKtScatter, fMeanGhostKt);
+  ghostSpec.add_ghosts(ghosts);
+
+  return ghostSpec.actual_ghost_area();
+}
+
+//_________________________________________________________________________________________________
+Int_t AliFJWrapper::RunWithGhosts(const std::vector<fastjet::PseudoJet>& ghosts, Double_t ghostArea)
+{
+  // Run the jet finder with active area from a set of explicit ghosts (see GenerateGhosts()).
+  // Nothing is shared with other wrappers, so that several instances can run in parallel
+  // on the same input vectors and ghosts. Plugins and event-wise subtraction are not supported.
+
+  if (fAlgor == fj::plugin_algorithm) {
+    AliError("[e] Plugin algorithms cannot be run with external ghosts!");
+    return -1;
+  }
+
+  fJetDef = new fj::JetDefinition(fAlgor, fR, fScheme, fStrategy);
+
+  try {
+    fClustSeqActGhosts = new fj::ClusterSequenceActiveAreaExplicitGhosts(fInputVectors,
+                                                                         *fJetDef,
+                                                                         ghosts,
+                                                                         ghostArea);
+  } catch (fj::Error) {
+    AliError(" [w] FJ Exception caught.");
+    return -1;
+  }
+
+  fInclusiveJets.clear();
+  fInclusiveJets = fClustSeqActGhosts->inclusive_jets(0.0);
+
+  return 0;
+}
+
 //_________________________________________________________________________________________________
 Int_t AliFJWrapper::Filter()
 {
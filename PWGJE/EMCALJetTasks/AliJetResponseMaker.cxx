@@ -19,9 +19,12 @@
 
 #include "AliJetResponseMaker.h"
 
+#include <algorithm>
+
 #include <TClonesArray.h>
 #include <TH2F.h>
 #include <THnSparse.h>
+#include <TVector2.h>
 
 #include "AliTLorentzVector.h"
 #include "AliAnalysisManager.h"
@@ -46,6 +49,7 @@ AliJetResponseMaker::AliJetResponseMaker() :
   fMatchingPar2(0),
   fUseCellsToMatch(kFALSE),
   fMinJetMCPt(1),
+  fUseHashMatching(kFALSE),
   fEmbeddingQA(),
   fHistoType(0),
   fDeltaPtAxis(0),
@@ -120,7 +124,16 @@ AliJetResponseMaker::AliJetResponseMaker() :
   fHistDeltaMCPtvsArea1(0),
   fHistDeltaMCPtvsArea2(0),
   fHistDeltaMCPtvsDeltaArea(0),
-  fHistJet1MCPtvsJet2Pt(0)
+  fHistJet1MCPtvsJet2Pt(0),
+  fMatchHead(),
+  fMatchNext(),
+  fMatchJet(),
+  fMatchPt(),
+  fMatchStamp(),
+  fMatchJetStamp(),
+  fMatchShared1(),
+  fMatchShared2(),
+  fMatchCandidates()
 {
   // Default constructor.
 
@@ -135,6 +148,7 @@ AliJetResponseMaker::AliJetResponseMaker(const char *name) :
   fMatchingPar2(0),
   fUseCellsToMatch(kFALSE),
   fMinJetMCPt(1),
+  fUseHashMatching(kFALSE),
   fEmbeddingQA(),
   fHistoType(0),
   fDeltaPtAxis(0),
@@ -209,7 +223,16 @@ AliJetResponseMaker::AliJetResponseMaker(const char *name) :
   fHistDeltaMCPtvsArea1(0),
   fHistDeltaMCPtvsArea2(0),
   fHistDeltaMCPtvsDeltaArea(0),
-  fHistJet1MCPtvsJet2Pt(0)
+  fHistJet1MCPtvsJet2Pt(0),
+  fMatchHead(),
+  fMatchNext(),
+  fMatchJet(),
+  fMatchPt(),
+  fMatchStamp(),
+  fMatchJetStamp(),
+  fMatchShared1(),
+  fMatchShared2(),
+  fMatchCandidates()
 {
   // Standard constructor.
 
@@ -1430,9 +1453,24 @@ void AliJetResponseMaker::DoJetLoop()
   while ((jet2 = jets2->GetNextJet())) jet2->ResetMatching();
 
   jets1->ResetCurrentID();
-  while ((jet1 = jets1->GetNextJet())) {
-    jet1->ResetMatching();
+  while ((jet1 = jets1->GetNextJet())) jet1->ResetMatching();
+
+  if (fUseHashMatching) {
+    if (fMatching == kGeometrical && fMatchingPar1 > 0 && fMatchingPar2 > 0) {
+      DoJetLoopGrid(jets1, jets2);
+      return;
+    }
+    // the cell-based matching of same collections is done pairwise; pairs not sharing
+    // constituents (matching level 1) are skipped, which is only exact for distances < 1
+    if (fMatchingPar1 < 1 && fMatchingPar2 < 1 &&
+        (fMatching == kMCLabel || (fMatching == kSameCollections && !(fUseCellsToMatch && fCaloCells)))) {
+      DoJetLoopSharedConstituents(jets1, jets2);
+      return;
+    }
+  }
 
+  jets1->ResetCurrentID();
+  while ((jet1 = jets1->GetNextJet())) {
     if (jet1->MCPt() < fMinJetMCPt) continue;
 
     jets2->ResetCurrentID();
@@ -1442,6 +1480,281 @@ void AliJetResponseMaker::DoJetLoop()
   } // jet1 loop
 }
 
+//________________________________________________________________________
+void AliJetResponseMaker::DoJetLoopGrid(AliJetContainer *jets1, AliJetContainer *jets2)
+{
+  // Geometrical matching comparing each jet 1 only with the jets 2 in the neighbouring
+  // cells of an (eta,phi) grid with cell size >= the maximum matching distance.
+  // Pairs farther apart than the maximum matching distance are not considered, so that
+  // the matched pairs are the same as with the full comparison.
+
+  const Double_t maxDist = TMath::Max(fMatchingPar1, fMatchingPar2);
+  const Int_t nJets2 = jets2->GetNEntries();
+
+  Double_t etaMin = 0, etaMax = 0;
+  Bool_t first = kTRUE;
+  for (Int_t ijet2 = 0; ijet2 < nJets2; ijet2++) {
+    AliEmcalJet *jet2 = jets2->GetJet(ijet2);
+    if (!jet2) continue;
+    if (first || jet2->Eta() < etaMin) etaMin = jet2->Eta();
+    if (first || jet2->Eta() > etaMax) etaMax = jet2->Eta();
+    first = kFALSE;
+  }
+  if (first) return;
+
+  // at most 100x100 cells, each at least as large as the maximum distance
+  const Double_t etaWidth = TMath::Max(maxDist, (etaMax - etaMin) / 100);
+  const Int_t nEta = Int_t((etaMax - etaMin) / etaWidth) + 1;
+  const Int_t nPhi = TMath::Max(TMath::Min(Int_t(TMath::TwoPi() / maxDist), 100), 1);
+  const Double_t phiWidth = TMath::TwoPi() / nPhi;
+  const Int_t nPhiNeighbours = TMath::Min(nPhi, 3);
+
+  fMatchHead.assign(nEta * nPhi, -1);
+  fMatchNext.assign(nJets2, -1);
+  for (Int_t ijet2 = nJets2 - 1; ijet2 >= 0; ijet2--) {
+    AliEmcalJet *jet2 = jets2->GetJet(ijet2);
+    if (!jet2) continue;
+    Int_t ieta = TMath::Min(Int_t((jet2->Eta() - etaMin) / etaWidth), nEta - 1);
+    Int_t iphi = TMath::Min(Int_t(TVector2::Phi_0_2pi(jet2->Phi()) / phiWidth), nPhi - 1);
+    Int_t cell = ieta * nPhi + iphi;
+    fMatchNext[ijet2] = fMatchHead[cell];
+    fMatchHead[cell] = ijet2;
+  }
+
+  AliEmcalJet* jet1 = 0;
+  jets1->ResetCurrentID();
+  while ((jet1 = jets1->GetNextJet())) {
+    if (jet1->MCPt() < fMinJetMCPt) continue;
+
+    Int_t ieta1 = TMath::FloorNint((jet1->Eta() - etaMin) / etaWidth);
+    Int_t iphi1 = TMath::Min(Int_t(TVector2::Phi_0_2pi(jet1->Phi()) / phiWidth), nPhi - 1);
+
+    fMatchCandidates.clear();
+    for (Int_t ieta = TMath::Max(ieta1 - 1, 0); ieta <= TMath::Min(ieta1 + 1, nEta - 1); ieta++) {
+      for (Int_t k = 0; k < nPhiNeighbours; k++) {
+        Int_t iphi = (iphi1 - 1 + k + nPhi) % nPhi;
+        for (Int_t ijet2 = fMatchHead[ieta * nPhi + iphi]; ijet2 >= 0; ijet2 = fMatchNext[ijet2]) fMatchCandidates.push_back(ijet2);
+      }
+    }
+
+    // same order as the full comparison, for identical results in case of ties
+    std::sort(fMatchCandidates.begin(), fMatchCandidates.end());
+    for (UInt_t icand = 0; icand < fMatchCandidates.size(); icand++) {
+      AliEmcalJet *jet2 = jets2->GetJet(fMatchCandidates[icand]);
+      Double_t d = -1;
+      GetGeometricalMatchingLevel(jet1, jet2, d);
+      if (d > maxDist) continue;
+      SetMatchingLevel(jet1, jet2, d, d);
+    }
+  }
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::IndexJetConstituents(AliJetContainer *jets1, AliJetContainer *jets2)
+{
+  // Index the constituents of all jets 2 by key: the index of the MC particle (MC label matching)
+  // or the index of the track or cluster (same collections, clusters after the tracks)
+
+  AliParticleContainer *tracks1   = jets1->GetParticleContainer();
+  AliClusterContainer  *clusters1 = jets1->GetClusterContainer();
+  AliParticleContainer *tracks2   = jets2->GetParticleContainer();
+  AliClusterContainer  *clusters2 = jets2->GetClusterContainer();
+
+  const Bool_t useTracks   = tracks2 && (fMatching == kMCLabel || tracks1);
+  const Bool_t useClusters = fMatching == kSameCollections && clusters1 && clusters2;
+  const Int_t nTrackKeys   = useTracks ? tracks2->GetNEntries() : 0;
+  const Int_t nKeys        = nTrackKeys + (useClusters ? clusters2->GetNEntries() : 0);
+
+  fMatchHead.assign(nKeys, -1);
+  fMatchNext.clear();
+  fMatchJet.clear();
+  fMatchPt.clear();
+
+  for (Int_t ijet2 = jets2->GetNEntries() - 1; ijet2 >= 0; ijet2--) {
+    AliEmcalJet *jet2 = jets2->GetJet(ijet2);
+    if (!jet2) continue;
+
+    for (Int_t iTrack2 = 0; useTracks && iTrack2 < jet2->GetNumberOfTracks(); iTrack2++) {
+      Int_t key = jet2->TrackAt(iTrack2);
+      if (key < 0 || key >= nTrackKeys) continue;
+      AliVParticle *part2 = jet2->Track(iTrack2);
+      if (!part2) {
+        AliWarning(Form("Could not find track %d!", key));
+        continue;
+      }
+      fMatchNext.push_back(fMatchHead[key]);
+      fMatchJet.push_back(ijet2);
+      fMatchPt.push_back(part2->Pt());
+      fMatchHead[key] = fMatchJet.size() - 1;
+    }
+
+    for (Int_t iClus2 = 0; useClusters && iClus2 < jet2->GetNumberOfClusters(); iClus2++) {
+      Int_t key = nTrackKeys + jet2->ClusterAt(iClus2);
+      if (key < nTrackKeys || key >= nKeys) continue;
+      AliVCluster *clus2 = jet2->Cluster(iClus2);
+      if (!clus2) {
+        AliWarning(Form("Could not find cluster %d!", key - nTrackKeys));
+        continue;
+      }
+      TLorentzVector part2;
+      clus2->GetMomentum(part2, fVertex);
+      fMatchNext.push_back(fMatchHead[key]);
+      fMatchJet.push_back(ijet2);
+      fMatchPt.push_back(part2.Pt());
+      fMatchHead[key] = fMatchJet.size() - 1;
+    }
+  }
+
+  fMatchStamp.assign(fMatchJet.size(), -1);
+  fMatchJetStamp.assign(jets2->GetNEntries(), -1);
+  fMatchShared1.assign(jets2->GetNEntries(), 0.);
+  fMatchShared2.assign(jets2->GetNEntries(), 0.);
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::AddSharedConstituent(Int_t key, Int_t ijet1, Double_t pt1, Double_t weight2)
+{
+  // A constituent of jet 1 with the given key is shared with all jets 2 containing it.
+  // On the jet 2 side, each constituent counts once per jet 1 (weighted as its first match).
+
+  if (key < 0 || key >= (Int_t)fMatchHead.size()) return;
+
+  for (Int_t entry = fMatchHead[key]; entry >= 0; entry = fMatchNext[entry]) {
+    Int_t ijet2 = fMatchJet[entry];
+    if (fMatchJetStamp[ijet2] != ijet1) {
+      fMatchJetStamp[ijet2] = ijet1;
+      fMatchShared1[ijet2] = 0;
+      fMatchShared2[ijet2] = 0;
+      fMatchCandidates.push_back(ijet2);
+    }
+    fMatchShared1[ijet2] += pt1;
+    if (fMatchStamp[entry] != ijet1) {
+      fMatchStamp[entry] = ijet1;
+      fMatchShared2[ijet2] += fMatchPt[entry] * weight2;
+    }
+  }
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::DoJetLoopSharedConstituents(AliJetContainer *jets1, AliJetContainer *jets2)
+{
+  // MC label or same collections matching with one sweep over the constituents of each jet 1,
+  // looking up the jets 2 sharing them in an index built once per event.
+  // Only pairs sharing constituents are compared: the other pairs have matching level 1,
+  // i.e. they would never be matched with maximum matching distances < 1.
+
+  AliParticleContainer *tracks1   = jets1->GetParticleContainer();
+  AliParticleContainer *tracks2   = jets2->GetParticleContainer();
+  AliClusterContainer  *clusters1 = jets1->GetClusterContainer();
+  AliClusterContainer  *clusters2 = jets2->GetClusterContainer();
+
+  if (fMatching == kMCLabel && !tracks2) return;
+
+  IndexJetConstituents(jets1, jets2);
+  const Int_t nTrackKeys = (tracks2 && (fMatching == kMCLabel || tracks1)) ? tracks2->GetNEntries() : 0;
+  const Bool_t useCells = fUseCellsToMatch && fCaloCells;
+
+  AliEmcalJet* jet1 = 0;
+  jets1->ResetCurrentID();
+  while ((jet1 = jets1->GetNextJet())) {
+    if (jet1->MCPt() < fMinJetMCPt) continue;
+    const Int_t ijet1 = jets1->GetCurrentID();
+
+    fMatchCandidates.clear();
+    Double_t totalPt1 = jet1->Pt();
+
+    if (fMatching == kMCLabel) {
+      // tracks first, then clusters or cells, as in GetMCLabelMatchingLevel
+      for (Int_t iTrack = 0; iTrack < jet1->GetNumberOfTracks(); iTrack++) {
+        AliVParticle *track = jet1->Track(iTrack);
+        if (!track) {
+          AliWarning(Form("Could not find track %d!", iTrack));
+          continue;
+        }
+        Int_t MClabel = TMath::Abs(track->GetLabel());
+        MClabel -= fMCLabelShift;
+        if (MClabel == 0 && tracks1 && tracks1->GetArray()) totalPt1 -= track->Pt(); // not a MC particle
+        if (MClabel <= 0) continue;
+        AddSharedConstituent(tracks2->GetIndexFromLabel(MClabel), ijet1, track->Pt(), 1.);
+      }
+
+      for (Int_t iClus = 0; iClus < jet1->GetNumberOfClusters(); iClus++) {
+        AliVCluster *clus = jet1->Cluster(iClus);
+        if (!clus) {
+          AliWarning(Form("Could not find cluster %d!", iClus));
+          continue;
+        }
+        AliTLorentzVector part;
+        clus->GetMomentum(part, fVertex);
+
+        if (useCells) {
+          for (Int_t iCell = 0; iCell < clus->GetNCells(); iCell++) {
+            Double_t cellFrac = clus->GetCellAmplitudeFraction(iCell);
+            Int_t MClabel = TMath::Abs(fCaloCells->GetCellMCLabel(clus->GetCellAbsId(iCell)));
+            MClabel -= fMCLabelShift;
+            if (MClabel == 0) totalPt1 -= part.Pt() * cellFrac;
+            if (MClabel <= 0) continue;
+            AddSharedConstituent(tracks2->GetIndexFromLabel(MClabel), ijet1, part.Pt() * cellFrac, cellFrac);
+          }
+        }
+        else {
+          Int_t MClabel = TMath::Abs(clus->GetLabel());
+          MClabel -= fMCLabelShift;
+          if (MClabel == 0) totalPt1 -= part.Pt();
+          if (MClabel <= 0) continue;
+          AddSharedConstituent(tracks2->GetIndexFromLabel(MClabel), ijet1, part.Pt(), 1.);
+        }
+      }
+    }
+    else {
+      for (Int_t iTrack1 = 0; nTrackKeys > 0 && iTrack1 < jet1->GetNumberOfTracks(); iTrack1++) {
+        Int_t index1 = jet1->TrackAt(iTrack1);
+        if (index1 < 0 || index1 >= nTrackKeys || fMatchHead[index1] < 0) continue;
+        AliVParticle *part1 = jet1->Track(iTrack1);
+        if (!part1) {
+          AliWarning(Form("Could not find track %d!", index1));
+          continue;
+        }
+        AddSharedConstituent(index1, ijet1, part1->Pt(), 1.);
+      }
+
+      for (Int_t iClus1 = 0; clusters1 && clusters2 && iClus1 < jet1->GetNumberOfClusters(); iClus1++) {
+        Int_t index1 = jet1->ClusterAt(iClus1);
+        Int_t key = nTrackKeys + index1;
+        if (index1 < 0 || key >= (Int_t)fMatchHead.size() || fMatchHead[key] < 0) continue;
+        AliVCluster *clus1 = jet1->Cluster(iClus1);
+        if (!clus1) {
+          AliWarning(Form("Could not find cluster %d!", index1));
+          continue;
+        }
+        TLorentzVector part1;
+        clus1->GetMomentum(part1, fVertex);
+        AddSharedConstituent(key, ijet1, part1.Pt(), 1.);
+      }
+    }
+
+    // same order as the full comparison, for identical results in case of ties
+    std::sort(fMatchCandidates.begin(), fMatchCandidates.end());
+    for (UInt_t icand = 0; icand < fMatchCandidates.size(); icand++) {
+      Int_t ijet2 = fMatchCandidates[icand];
+      AliEmcalJet *jet2 = jets2->GetJet(ijet2);
+
+      // 0 = maximum level of matching, 1 = the two jets are completely unrelated
+      Double_t d1 = TMath::Max(totalPt1 - fMatchShared1[ijet2], 0.);
+      Double_t d2 = TMath::Max(jet2->Pt() - fMatchShared2[ijet2], 0.);
+      if (fMatching == kMCLabel) {
+        d1 = totalPt1 < 1 ? -1 : d1 / totalPt1;
+        d2 = jet2->Pt() < 1 ? -1 : d2 / jet2->Pt();
+      }
+      else {
+        d1 = jet1->Pt() > 0 ? d1 / jet1->Pt() : -1;
+        d2 = jet2->Pt() > 0 ? d2 / jet2->Pt() : -1;
+      }
+      SetMatchingLevel(jet1, jet2, d1, d2);
+    }
+  }
+}
+
 //________________________________________________________________________
 void AliJetResponseMaker::GetGeometricalMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t &d) const
 {
@@ -1886,6 +2199,12 @@ void AliJetResponseMaker::SetMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2,
     ;
   }
 
+  SetMatchingLevel(jet1, jet2, d1, d2);
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::SetMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t d1, Double_t d2)
+{
   if (d1 >= 0) {
 
     if (d1 < jet1->ClosestJetDistance()) {
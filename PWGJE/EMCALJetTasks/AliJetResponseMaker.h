@@ -24,6 +24,8 @@ class TH2;
 class THnSparse;
 class AliNamedArrayI;
 
+#include <vector>
+
 #include "AliEmcalJet.h"
 #include "AliAnalysisTaskEmcalJet.h"
 #include "AliEmcalEmbeddingQA.h"
@@ -47,6 +49,7 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   void                        SetPtHardBin(Int_t b)                                           { fSelectPtHardBin   = b         ; }
   void                        SetUseCellsToMatch(Bool_t i)                                    { fUseCellsToMatch   = i         ; }
   void                        SetMinJetMCPt(Float_t pt)                                       { fMinJetMCPt        = pt        ; }
+  void                        SetUseHashMatching(Bool_t b)                                    { fUseHashMatching   = b         ; }
   void                        SetHistoType(Int_t b)                                           { fHistoType         = b         ; }
   void                        SetDeltaPtAxis(Int_t b)                                         { fDeltaPtAxis       = b         ; }
   void                        SetDeltaEtaDeltaPhiAxis(Int_t b)                                { fDeltaEtaDeltaPhiAxis= b       ; }
@@ -96,7 +99,12 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   Bool_t                      FillHistograms();
   Bool_t                      Run();
   Bool_t                      DoJetMatching();
+  void                        DoJetLoopGrid(AliJetContainer *jets1, AliJetContainer *jets2);
+  void                        DoJetLoopSharedConstituents(AliJetContainer *jets1, AliJetContainer *jets2);
+  void                        IndexJetConstituents(AliJetContainer *jets1, AliJetContainer *jets2);
+  void                        AddSharedConstituent(Int_t key, Int_t ijet1, Double_t pt1, Double_t weight2);
   void                        SetMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, MatchingType matching);
+  void                        SetMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t d1, Double_t d2);
   void                        GetGeometricalMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t &d) const;
   void                        GetMCLabelMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t &d1, Double_t &d2) const;
   void                        GetSameCollectionsMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t &d1, Double_t &d2) const;
@@ -111,6 +119,7 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   Double_t                    fMatchingPar2;                           // matching parameter for jet2-jet1 matching
   Bool_t                      fUseCellsToMatch;                        // use cells instead of clusters to match jets (slower but sometimes needed)
   Double_t                    fMinJetMCPt;                             // minimum jet MC pt
+  Bool_t                      fUseHashMatching;                        // compare only candidate jet pairs, found with an (eta,phi) grid or a constituent index
   AliEmcalEmbeddingQA         fEmbeddingQA;                            //!<! Embedding QA hists (will only be added if embedding)
   Int_t                       fHistoType;                              // histogram type (0=TH2, 1=THnSparse)
   Int_t                       fDeltaPtAxis;                            // add delta pt axis in THnSparse (default=0)
@@ -200,10 +209,21 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   TH2                        *fHistDeltaMCPtvsDeltaArea;               //!jet 1 MC pt - jet2 pt vs delta area
   TH2                        *fHistJet1MCPtvsJet2Pt;                   //!correlation jet 1 MC pt vs jet 2 pt
 
+  // Candidate matching (fUseHashMatching)
+  std::vector<Int_t>          fMatchHead;                              //!first index entry per constituent key or grid cell
+  std::vector<Int_t>          fMatchNext;                              //!next index entry with the same key
+  std::vector<Int_t>          fMatchJet;                               //!jet 2 of the index entry
+  std::vector<Double_t>       fMatchPt;                                //!pt of the jet 2 constituent of the index entry
+  std::vector<Int_t>          fMatchStamp;                             //!last jet 1 found sharing the constituent of the index entry
+  std::vector<Int_t>          fMatchJetStamp;                          //!last jet 1 found sharing constituents with jet 2
+  std::vector<Double_t>       fMatchShared1;                           //!pt shared by jet 2 and the current jet 1, jet 1 side
+  std::vector<Double_t>       fMatchShared2;                           //!pt shared by jet 2 and the current jet 1, jet 2 side
+  std::vector<Int_t>          fMatchCandidates;                        //!jets 2 to be compared with the current jet 1
+
  private:
   AliJetResponseMaker(const AliJetResponseMaker&);            // not implemented
   AliJetResponseMaker &operator=(const AliJetResponseMaker&); // not implemented
 
-  ClassDef(AliJetResponseMaker, 29) // Jet response matrix producing task
+  ClassDef(AliJetResponseMaker, 30) // Jet response matrix producing task
 };
 #endif
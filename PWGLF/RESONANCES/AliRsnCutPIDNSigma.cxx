@@ -16,7 +16,10 @@
 //          Alberto Pulvirenti (alberto.pulvirenti@ct.infn.it)
 //
 
+#include "AliAnalysisManager.h"
+#include "AliInputEventHandler.h"
 #include "AliPIDResponse.h"
+#include "AliPIDResponseCache.h"
 #include "AliESDpid.h"
 #include "AliAODpidUtil.h"
 
@@ -24,6 +27,21 @@
 
 ClassImp(AliRsnCutPIDNSigma)
 
+namespace {
+   // n-sigma from the shared per-event cache, if it serves the same PID response,
+   // so that the PID of a track is computed once for all the cuts which use it
+   Double_t NumberOfSigmas(AliPIDResponse *pid, AliPIDResponse::EDetector det, AliVTrack *vtrack, AliPID::EParticleType species)
+   {
+      AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+      AliInputEventHandler *handler = mgr ? dynamic_cast<AliInputEventHandler *>(mgr->GetInputEventHandler()) : 0x0;
+      if (handler && handler->GetPIDResponse() == pid) {
+         AliPIDResponseCache *cache = AliPIDResponseCache::Instance();
+         if (cache->GetPIDResponse() == pid) return cache->NumberOfSigmas(det, vtrack, species);
+      }
+      return pid->NumberOfSigmas(det, vtrack, species);
+   }
+}
+
 //_________________________________________________________________________________________________
 AliRsnCutPIDNSigma::AliRsnCutPIDNSigma() :
    AliRsnCut("cut", AliRsnTarget::kDaughter),
@@ -153,13 +171,13 @@ Bool_t AliRsnCutPIDNSigma::IsSelected(TObject *object)
    // get number of sigmas
    switch (fDetector) {
       case kITS:
-         fTrackNSigma = TMath::Abs(pid->NumberOfSigmasITS(vtrack, fSpecies));
+         fTrackNSigma = TMath::Abs(NumberOfSigmas(pid, AliPIDResponse::kITS, vtrack, fSpecies));
          break;
       case kTPC:
-         fTrackNSigma = TMath::Abs(pid->NumberOfSigmasTPC(vtrack, fSpecies));
+         fTrackNSigma = TMath::Abs(NumberOfSigmas(pid, AliPIDResponse::kTPC, vtrack, fSpecies));
          break;
       case kTOF:
-         fTrackNSigma = TMath::Abs(pid->NumberOfSigmasTOF(vtrack, fSpecies));
+         fTrackNSigma = TMath::Abs(NumberOfSigmas(pid, AliPIDResponse::kTOF, vtrack, fSpecies));
          break;
       default:
          AliError("Bad detector chosen. Rejecting track");
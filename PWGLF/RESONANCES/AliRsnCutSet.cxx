@@ -27,7 +27,10 @@ AliRsnCutSet::AliRsnCutSet() :
    fIsScheme(kFALSE),
    fExpression(0),
    fMonitors(),
-   fUseMonitor(kFALSE)
+   fUseMonitor(kFALSE),
+   fIsCompiled(kFALSE),
+   fProgram(),
+   fStack()
 {
 //
 // Constructor without name (not recommended)
@@ -48,7 +51,10 @@ AliRsnCutSet::AliRsnCutSet(const char *name, RSNTARGET target) :
    fIsScheme(kFALSE),
    fExpression(0),
    fMonitors(),
-   fUseMonitor(kFALSE)
+   fUseMonitor(kFALSE),
+   fIsCompiled(kFALSE),
+   fProgram(),
+   fStack()
 {
 //
 // Constructor with argument name (recommended)
@@ -70,7 +76,10 @@ AliRsnCutSet::AliRsnCutSet(const AliRsnCutSet &copy) :
    fIsScheme(copy.fIsScheme),
    fExpression(copy.fExpression),
    fMonitors(copy.fMonitors),
-   fUseMonitor(copy.fUseMonitor)
+   fUseMonitor(copy.fUseMonitor),
+   fIsCompiled(kFALSE),
+   fProgram(),
+   fStack()
 {
 //
 // Copy constructor
@@ -104,6 +113,8 @@ AliRsnCutSet &AliRsnCutSet::operator=(const AliRsnCutSet &copy)
    fExpression = copy.fExpression;
    fMonitors = copy.fMonitors;
    fUseMonitor = copy.fUseMonitor;
+   fIsCompiled = kFALSE;
+   fProgram.clear();
 
    if (fBoolValues) delete [] fBoolValues;
 
@@ -151,6 +162,7 @@ void AliRsnCutSet::AddCut(AliRsnCut *cut)
    AliInfo(Form("====> Adding a new cut: [%s]", cut->GetName()));
    //cut->Print();
    fNumOfCuts++;
+   fIsCompiled = kFALSE;
 
    if (fBoolValues) delete [] fBoolValues;
 
@@ -197,6 +209,33 @@ Bool_t AliRsnCutSet::IsSelected(TObject *object)
 
    if (fIsScheme) boolReturn = Passed();
 
+   return Finish(object, boolReturn);
+}
+
+//_____________________________________________________________________________
+Bool_t AliRsnCutSet::IsSelectedWithValues(TObject *object)
+{
+//
+// Same as IsSelected(), but the results of the single cuts are not
+// computed here: they must have been set with SetBoolValue() by the caller,
+// e.g. when the same cut object is shared by several cut sets.
+//
+
+   if (!fNumOfCuts) return kTRUE;
+
+   Bool_t boolReturn = kTRUE;
+   if (fIsScheme) boolReturn = Passed();
+
+   return Finish(object, boolReturn);
+}
+
+//_____________________________________________________________________________
+Bool_t AliRsnCutSet::Finish(TObject *object, Bool_t boolReturn)
+{
+//
+// Fill the monitors for the selected objects
+//
+
    // fill monitoring info
    if (boolReturn && fUseMonitor) {
       if (TargetOK(object)) {
@@ -224,6 +263,7 @@ void AliRsnCutSet::SetCutScheme(const char *theValue)
    fCutScheme = theValue;
    SetCutSchemeIndexed(theValue);
    fIsScheme = kTRUE;
+   fIsCompiled = kFALSE;
    AliDebug(AliLog::kDebug, "->");
 }
 
@@ -275,9 +315,67 @@ Bool_t AliRsnCutSet::Passed()
 
    if (fCuts.IsEmpty()) return kTRUE;
 
+   if (!fIsCompiled) Compile();
+   if (!fProgram.empty()) return RunProgram();
+
    return fExpression->Value(*GetCuts());
 }
 
+//_____________________________________________________________________________
+Bool_t AliRsnCutSet::Compile()
+{
+//
+// Translate the expression into a flat program in postfix notation,
+// so that Passed() does not need to walk the expression tree.
+// If this fails (e.g. invalid scheme), the expression tree is used.
+//
+
+   fIsCompiled = kTRUE;
+   fProgram.clear();
+
+   AliRsnExpression::fgCutSet = this;
+   if (!fExpression) {
+      fExpression = new AliRsnExpression(fCutSchemeIndexed);
+      AliDebug(AliLog::kDebug, "fExpression was created.");
+   }
+
+   if (!fExpression->Compile(fProgram, fNumOfCuts)) {
+      AliWarning(Form("Cut scheme '%s' could not be compiled, using the expression tree", fCutScheme.Data()));
+      fProgram.clear();
+      return kFALSE;
+   }
+
+   fStack.resize(fProgram.size());
+   AliDebug(AliLog::kDebug, Form("Cut scheme compiled into %d instructions", (Int_t)fProgram.size()));
+   return kTRUE;
+}
+
+//_____________________________________________________________________________
+Bool_t AliRsnCutSet::RunProgram()
+{
+//
+// Evaluate the compiled expression on the current cut results
+//
+
+   Int_t top = 0;
+   for (UInt_t i = 0; i < fProgram.size(); i++) {
+      Int_t op = fProgram[i];
+      if (op >= 0) {
+         fStack[top++] = fBoolValues[op];
+      } else if (op == -AliRsnExpression::kOpNOT) {
+         fStack[top - 1] = !fStack[top - 1];
+      } else {
+         top--;
+         if (op == -AliRsnExpression::kOpAND)
+            fStack[top - 1] = (fStack[top - 1] && fStack[top]);
+         else
+            fStack[top - 1] = (fStack[top - 1] || fStack[top]);
+      }
+   }
+
+   return fStack[0];
+}
+
 //_____________________________________________________________________________
 Bool_t AliRsnCutSet::IsValidScheme()
 {
@@ -5,6 +5,8 @@
 // It must be prepared by adding all required single cuts,
 // and then with a logical expression which combines all cuts
 // with the "AND", "OR" and "NOT" operators.
+// At the first check the expression is compiled into a flat
+// program in postfix notation, which is then run on the cut results.
 //
 // author: M. Vala (martin.vala@cern.ch)
 //
@@ -12,6 +14,8 @@
 #ifndef ALIRSNCUTSET_H
 #define ALIRSNCUTSET_H
 
+#include <vector>
+
 #include <TNamed.h>
 #include <TObjArray.h>
 
@@ -45,6 +49,8 @@ public:
    void      PrintSetInfo();
 
    Bool_t    IsSelected(TObject *object);
+   Bool_t    IsSelectedWithValues(TObject *object);
+   Bool_t    Compile();
 
    void SetBoolValue(Bool_t theValue, Int_t index) { fBoolValues[index] = theValue; }
    Bool_t GetBoolValue(Int_t index) const { return fBoolValues[index]; }
@@ -64,6 +70,9 @@ public:
 
 private:
 
+   Bool_t    RunProgram();
+   Bool_t    Finish(TObject *object, Bool_t boolReturn);
+
    TObjArray         fCuts;                  // array of cuts
    Int_t             fNumOfCuts;             // number of cuts
    TString           fCutScheme;             // cut scheme
@@ -76,7 +85,11 @@ private:
    TObjArray         fMonitors;              // array of monitor object
    Bool_t            fUseMonitor;            // flag if monitoring should be used
 
-   ClassDef(AliRsnCutSet, 3)   // ROOT dictionary
+   Bool_t            fIsCompiled;            //! compilation of the scheme was attempted
+   std::vector<Int_t>  fProgram;             //! compiled scheme (cut indexes and operators in postfix notation)
+   std::vector<Char_t> fStack;               //! evaluation stack for fProgram
+
+   ClassDef(AliRsnCutSet, 4)   // ROOT dictionary
 };
 
 #endif
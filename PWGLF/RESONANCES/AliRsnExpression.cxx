@@ -133,6 +133,40 @@ Bool_t AliRsnExpression::Value(TObjArray &vars)
    return kFALSE;
 }
 
+//______________________________________________________________________________
+Bool_t AliRsnExpression::Compile(std::vector<Int_t> &program, Int_t nVars) const
+{
+   // Append the expression to program in postfix notation:
+   // a variable is stored as its index (>= 0), an operator as -fOperator.
+   // Returns kFALSE if the expression is undefined or refers
+   // to an index outside [0, nVars)
+
+   switch (fOperator) {
+
+      case kOpOR :
+      case kOpAND :
+         if (!fArg1 || !fArg2) return kFALSE;
+         if (!fArg1->Compile(program, nVars) || !fArg2->Compile(program, nVars)) return kFALSE;
+         program.push_back(-fOperator);
+         return kTRUE;
+
+      case kOpNOT :
+         if (!fArg2 || !fArg2->Compile(program, nVars)) return kFALSE;
+         program.push_back(-fOperator);
+         return kTRUE;
+
+      case 0 : {
+         if (fVname.IsNull() || !fVname.IsDigit()) return kFALSE;
+         Int_t index = fVname.Atoi();
+         if (index < 0 || index >= nVars) return kFALSE;
+         program.push_back(index);
+         return kTRUE;
+      }
+
+      default:
+         return kFALSE;
+   }
+}
 
 //______________________________________________________________________________
 TString AliRsnExpression::Unparse() const
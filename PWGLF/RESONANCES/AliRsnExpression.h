@@ -10,6 +10,8 @@
 #ifndef ALIRSNEXPRESSION_H
 #define ALIRSNEXPRESSION_H
 
+#include <vector>
+
 #include <TObject.h>
 
 class TObjArray;
@@ -35,6 +37,7 @@ public:
 
    virtual Bool_t     Value(TObjArray &vars);
    virtual TString     Unparse() const;
+   Bool_t              Compile(std::vector<Int_t> &program, Int_t nVars) const;
 
    void SetCutSet(AliRsnCutSet *const theValue) { fgCutSet = theValue; }
    AliRsnCutSet *GetCutSet() const { return fgCutSet; }
@@ -12,6 +12,7 @@
 // Author: A. Pulvirenti
 // Developers: F. Bellini (fbellini@cern.ch)
 
+#include <algorithm>
 #include <Riostream.h>
 
 #include <TH1.h>
@@ -40,6 +41,7 @@
 #include "AliQnCorrectionsManager.h"
 #include "AliQnCorrectionsQnVector.h"
 
+#include "AliRsnCut.h"
 #include "AliRsnCutSet.h"
 #include "AliRsnMiniPair.h"
 #include "AliRsnMiniEvent.h"
@@ -107,7 +109,10 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask() :
    fComputeSpherocity(kFALSE),
    fTrackFilter(0x0),
    fSpherocity(-10),
-   fResonanceFinders(0)
+   fResonanceFinders(0),
+   fTrackCutList(),
+   fTrackCutIndex(),
+   fTrackCutValues()
 {
 //
 // Dummy constructor ALWAYS needed for I/O.
@@ -175,7 +180,10 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const char *name, Bool_t useMC,Bo
    fComputeSpherocity(kFALSE),
    fTrackFilter(0x0),
    fSpherocity(-10),
-   fResonanceFinders(0)
+   fResonanceFinders(0),
+   fTrackCutList(),
+   fTrackCutIndex(),
+   fTrackCutValues()
 {
 //
 // Default constructor.
@@ -244,7 +252,10 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const AliRsnMiniAnalysisTask &cop
    fComputeSpherocity(copy.fComputeSpherocity),
    fTrackFilter(copy.fTrackFilter),
    fSpherocity(copy.fSpherocity),
-   fResonanceFinders(copy.fResonanceFinders)
+   fResonanceFinders(copy.fResonanceFinders),
+   fTrackCutList(),
+   fTrackCutIndex(),
+   fTrackCutValues()
 {
 //
 // Copy constructor.
@@ -315,6 +326,8 @@ AliRsnMiniAnalysisTask &AliRsnMiniAnalysisTask::operator=(const AliRsnMiniAnalys
    fTrackFilter = copy.fTrackFilter;
    fSpherocity = copy.fSpherocity;
    fResonanceFinders = copy.fResonanceFinders;
+   fTrackCutList.clear();
+   fTrackCutIndex.clear();
 
    return (*this);
 }
@@ -956,6 +969,8 @@ void AliRsnMiniAnalysisTask::FillMiniEvent(Char_t evType)
    AliRsnDaughter cursor;
   //  AliRsnMiniParticle miniParticle;
    AliRsnMiniParticle *miniParticlePtr;
+   if ((Int_t)fTrackCutIndex.size() != ncuts) PrepareTrackCuts();
+   Int_t ik, nk = fTrackCutList.size();
    for (ip = 0; ip < npart; ip++) {
       // point cursor to next particle
       fRsnEvent.SetDaughter(cursor, ip);
@@ -966,11 +981,15 @@ void AliRsnMiniAnalysisTask::FillMiniEvent(Char_t evType)
       // copy momentum and MC info if present
       // miniParticle.CopyDaughter(&cursor);
       // miniParticle.Index() = ip;
-      // switch on the bits corresponding to passed cuts
+      // check each single cut once, then switch on the bits
+      // corresponding to the cut sets which are passed
+      for (ik = 0; ik < nk; ik++) fTrackCutValues[ik] = fTrackCutList[ik]->IsSelected(&cursor);
       for (ic = 0; ic < ncuts; ic++) {
          AliRsnCutSet *cuts = (AliRsnCutSet *)fTrackCuts[ic];
+         const std::vector<Int_t> &index = fTrackCutIndex[ic];
+         for (UInt_t i = 0; i < index.size(); i++) cuts->SetBoolValue(fTrackCutValues[index[i]], i);
         //  if (cuts->IsSelected(&cursor)) miniParticle.SetCutBit(ic);
-         if (cuts->IsSelected(&cursor)) miniParticlePtr->SetCutBit(ic);
+         if (cuts->IsSelectedWithValues(&cursor)) miniParticlePtr->SetCutBit(ic);
         }
         // continue;
        
@@ -996,6 +1015,30 @@ void AliRsnMiniAnalysisTask::FillMiniEvent(Char_t evType)
    AliDebugClass(1, Form("Event %6d: total = %5d, accepted = %4d (pos %4d, neg %4d, neu %4d)", fEvNum, npart, (Int_t)fMiniEvent->Particles().GetEntriesFast(), npos, nneg, nneu));
 }
 
+//__________________________________________________________________________________________________
+/// List the single cuts of all track cut sets, so that a cut object
+/// added to several sets is checked only once per track.
+void AliRsnMiniAnalysisTask::PrepareTrackCuts()
+{
+   Int_t ic, ncuts = fTrackCuts.GetEntries();
+   fTrackCutList.clear();
+   fTrackCutIndex.assign(ncuts, std::vector<Int_t>());
+
+   for (ic = 0; ic < ncuts; ic++) {
+      AliRsnCutSet *cuts = (AliRsnCutSet *)fTrackCuts[ic];
+      TObjArray *list = cuts->GetCuts();
+      for (Int_t i = 0; i < list->GetEntriesFast(); i++) {
+         AliRsnCut *cut = (AliRsnCut *)list->At(i);
+         UInt_t k = std::find(fTrackCutList.begin(), fTrackCutList.end(), cut) - fTrackCutList.begin();
+         if (k == fTrackCutList.size()) fTrackCutList.push_back(cut);
+         fTrackCutIndex[ic].push_back(k);
+      }
+   }
+   fTrackCutValues.resize(fTrackCutList.size());
+
+   AliInfo(Form("%d track cut sets use %d distinct single cuts", ncuts, (Int_t)fTrackCutList.size()));
+}
+
 //__________________________________________________________________________________________________
 /// Compute event plane angle.
 ///
@@ -15,6 +15,8 @@
 #ifndef ALIRSNMINIANALYSISTASK_H
 #define ALIRSNMINIANALYSISTASK_H
 
+#include <vector>
+
 #include <TString.h>
 #include <TClonesArray.h>
 
@@ -34,6 +36,7 @@ class TList;
 
 class AliTriggerAnalysis;
 class AliRsnMiniEvent;
+class AliRsnCut;
 class AliRsnCutSet;
 class AliQnCorrectionsManager;
 class AliQnCorrectionsQnVector;
@@ -103,6 +106,7 @@ public:
 private:
    Char_t   CheckCurrentEvent();
    void     FillMiniEvent(Char_t evType);
+   void     PrepareTrackCuts();
    Double_t ComputeAngle();
    Double_t ComputeCentrality(Bool_t isESD);
    Double_t ComputeMultiplicity(Bool_t isESD,TString type);
@@ -173,9 +177,12 @@ private:
    AliAnalysisFilter   *fTrackFilter;       //!<! track filter for spherocity estimator 
    Double_t             fSpherocity;        ///< stores value of spherocity
    TObjArray            fResonanceFinders;  ///< list of AliRsnMiniResonanceFinder objects
+   std::vector<AliRsnCut*>          fTrackCutList;   //!<! single cuts used by the track cut sets, each listed once
+   std::vector<std::vector<Int_t> > fTrackCutIndex;  //!<! for each track cut set, index in fTrackCutList of its cuts
+   std::vector<Char_t>              fTrackCutValues; //!<! results of the cuts in fTrackCutList for the current track
 
 /// \cond CLASSIMP
-   ClassDef(AliRsnMiniAnalysisTask, 20);     
+   ClassDef(AliRsnMiniAnalysisTask, 21);     
 /// \endcond
 };
 
@@ -103,9 +103,37 @@ class AliAODv0;
 #include "AliLog.h"
 #include "AliTrackerBase.h"
 
+#include <thread>
+
 using std::cout;
 using std::endl;
 
+//________________________________________________________________________
+struct AliAnalysisTaskWeakDecayVertexer::V0PairLoop {
+    AliESDEvent *fEvent;
+    const AliESDVertex *fPrimaryVertex;
+    Double_t fB;
+    std::vector<Int_t> fNeg;                          //selected negative tracks
+    std::vector<Int_t> fPos;                          //selected positive tracks
+    std::vector<HelixXY> fNegHelix;                   //helix per entry of fNeg
+    std::vector<HelixXY> fPosHelix;                   //helix per entry of fPos
+    std::vector<std::vector<AliESDv0> > fV0s;         //candidates per range
+    std::vector<std::vector<Int_t> > fV0Neg;          //fNeg entry of each candidate per range
+    std::vector<std::vector<Long64_t> > fStat;        //fHistV0Statistics counts per range
+    std::vector<std::vector<Long64_t> > fOTFStat;     //fHistV0OptimalTrackParamUse counts per range
+};
+
+namespace {
+    //Add n entries at x, equivalent to n calls of h->Fill(x)
+    void FillCount(TH1 *h, Double_t x, Long64_t n) {
+        if (!h || n <= 0) return;
+        Int_t bin = h->FindBin(x);
+        h->AddBinContent(bin, n);
+        if (h->GetSumw2N()) h->GetSumw2()->AddAt(h->GetSumw2()->At(bin) + n, bin);
+        h->SetEntries(h->GetEntries() + n);
+    }
+}
+
 ClassImp(AliAnalysisTaskWeakDecayVertexer)
 
 AliAnalysisTaskWeakDecayVertexer::AliAnalysisTaskWeakDecayVertexer()
@@ -155,6 +183,7 @@ fMinPtCascade(   0.3 ),
 fMaxPtCascade( 100.00 ),
 fMassWindowAroundCascade(0.060),
 fMinXforXYtest( -3.0 ),
+fNThreads(1),
 //________________________________________________
 //Histos
 fHistEventCounter(0),
@@ -216,6 +245,7 @@ fMinPtCascade(   0.3 ), //pre-selection
 fMaxPtCascade( 100.00 ),
 fMassWindowAroundCascade(0.060),
 fMinXforXYtest( -3.0 ),
+fNThreads(1),
 //________________________________________________
 //Histos
 fHistEventCounter(0),
@@ -670,55 +700,133 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
         if (esdTrack->GetSign() > 0. && TMath::Abs(d)>fV0VertexerSels[2]) pos[npos++]=i;
     }
     
+    //Helices of the selected tracks, computed once per track instead of once per pair
+    V0PairLoop loop;
+    loop.fEvent = event;
+    loop.fPrimaryVertex = vtxT3D;
+    loop.fB = b;
+    loop.fNeg.assign(neg.GetArray(), neg.GetArray()+nneg);
+    loop.fPos.assign(pos.GetArray(), pos.GetArray()+npos);
+    loop.fNegHelix.resize(nneg);
+    loop.fPosHelix.resize(npos);
+    for (i=0; i<nneg; i++) GetHelixXY(event->GetTrack(neg[i]), loop.fNegHelix[i], b);
+    for (i=0; i<npos; i++) GetHelixXY(event->GetTrack(pos[i]), loop.fPosHelix[i], b);
+    
+    //Material corrections go through the (not thread-safe) geometry: run serially then
+    Int_t lNThreads = fkDoMaterialCorrection ? 1 : fNThreads;
+    if (lNThreads > nneg) lNThreads = nneg > 0 ? nneg : 1;
+    loop.fV0s.resize(lNThreads);
+    loop.fV0Neg.resize(lNThreads);
+    loop.fStat.assign(lNThreads, std::vector<Long64_t>(9, 0));
+    loop.fOTFStat.assign(lNThreads, std::vector<Long64_t>(3, 0));
+    
+    if (lNThreads > 1) {
+        std::vector<std::thread> lThreads;
+        for (Int_t iThread=0; iThread<lNThreads; iThread++)
+            lThreads.push_back(std::thread(&AliAnalysisTaskWeakDecayVertexer::Tracks2V0verticesPairs, this, &loop, iThread, lNThreads));
+        for (Int_t iThread=0; iThread<lNThreads; iThread++) lThreads[iThread].join();
+    } else {
+        Tracks2V0verticesPairs(&loop, 0, 1);
+    }
+    
+    //Store candidates in the order of the serial loop (negative, then positive track)
+    std::vector<size_t> lNext(lNThreads, 0);
     for (i=0; i<nneg; i++) {
-        Long_t nidx=neg[i];
+        Int_t iThread = i % lNThreads;
+        std::vector<AliESDv0> &lV0s = loop.fV0s[iThread];
+        size_t &j = lNext[iThread];
+        for (; j<lV0s.size() && loop.fV0Neg[iThread][j]==i; j++) {
+            event->AddV0(&lV0s[j]);
+            nvtx++;
+        }
+    }
+    for (Int_t iThread=0; iThread<lNThreads; iThread++) {
+        for (Int_t iStat=0; iStat<9; iStat++) FillCount(fHistV0Statistics, iStat+0.5, loop.fStat[iThread][iStat]);
+        for (Int_t iStat=0; iStat<3; iStat++) FillCount(fHistV0OptimalTrackParamUse, iStat+0.5, loop.fOTFStat[iThread][iStat]);
+    }
+    Info("Tracks2V0vertices","Number of reconstructed V0 vertices: %ld",nvtx);
+    return nvtx;
+}
+
+
+//________________________________________________________________________
+void AliAnalysisTaskWeakDecayVertexer::Tracks2V0verticesPairs(V0PairLoop *loop, Int_t lFirst, Int_t lStep) {
+    //--------------------------------------------------------------------
+    //Pair loop of Tracks2V0vertices for the negative tracks lFirst,
+    //lFirst+lStep, ... Candidates and counts go to the range lFirst of
+    //loop, so that several ranges can run in parallel
+    //--------------------------------------------------------------------
+    AliESDEvent *event = loop->fEvent;
+    Double_t b = loop->fB;
+    Double_t xPrimaryVertex=loop->fPrimaryVertex->GetX();
+    Double_t yPrimaryVertex=loop->fPrimaryVertex->GetY();
+    Double_t zPrimaryVertex=loop->fPrimaryVertex->GetZ();
+    Long_t nneg=loop->fNeg.size(), npos=loop->fPos.size();
+    std::vector<Long64_t> &lStat = loop->fStat[lFirst];
+    std::vector<Long64_t> &lOTFStat = loop->fOTFStat[lFirst];
+    
+    for (Long_t i=lFirst; i<nneg; i+=lStep) {
+        Long_t nidx=loop->fNeg[i];
         AliESDtrack *ntrk=event->GetTrack(nidx);
         if(!ntrk) continue;
+        const HelixXY &nh = loop->fNegHelix[i];
         
         for (Int_t k=0; k<npos; k++) {
-            Int_t pidx=pos[k];
+            Int_t pidx=loop->fPos[k];
             AliESDtrack *ptrk=event->GetTrack(pidx);
             if(!ptrk) continue;
             
-            fHistV0Statistics->Fill(0.5); //number of considered pairs
+            lStat[0]++; //number of considered pairs
             
             Double_t lNegMassForTracking = ntrk->GetMassForTracking();
             Double_t lPosMassForTracking = ptrk->GetMassForTracking();
             
-            fHistV0Statistics->Fill(1.5); //pass distance to PV
-            
-            AliExternalTrackParam nt(*ntrk), pt(*ptrk);
-            Bool_t lUsedOptimalParams = kFALSE;
+            lStat[1]++; //pass distance to PV
             
+            AliESDv0 *v0_otf = 0;
             if( fkUseOptimalTrackParams ){
                 //reroute to pointers obtained with on-the-fly finding, please
                 map<pair<int,int>, int>::iterator iter = fOTFMap.find(make_pair(nidx,pidx));
                 if(iter != fOTFMap.end())
                 {
                     Int_t lEquivalentOTFV0 = (*iter).second; // or iter->second;
-                    AliESDv0 *v0_otf = ((AliESDEvent*)event)->GetV0(lEquivalentOTFV0);
+                    v0_otf = ((AliESDEvent*)event)->GetV0(lEquivalentOTFV0);
                     if(!v0_otf){
                         AliWarning(Form("Invalid V0 at position %i!", lEquivalentOTFV0));
-                        fHistV0OptimalTrackParamUse->Fill(2.5);
-                    }else{
-                        AliExternalTrackParam ptimproved(*(v0_otf->GetParamP()));
-                        AliExternalTrackParam ntimproved(*(v0_otf->GetParamN()));
-                        if( v0_otf->GetParamP()->Charge() > 0 && v0_otf->GetParamN()->Charge() < 0 ) {
-                            //V0 daughter track swapping is required! Note: everything is swapped here... P->N, N->P
-                            pt = ptimproved;
-                            nt = ntimproved;
-                        }else{
-                            //swap charges if charges are swapped
-                            pt = ntimproved;
-                            nt = ptimproved;
-                        }
-                        fHistV0OptimalTrackParamUse->Fill(1.5);
-                        lUsedOptimalParams=kTRUE;
+                        lOTFStat[2]++;
                     }
                 }else{
                     //OTF not available for this pair
-                    fHistV0OptimalTrackParamUse->Fill(0.5);
+                    lOTFStat[0]++;
+                }
+            }
+            
+            //Helix pre-screening: same rejection as the fast skipper of GetDCAV0Dau,
+            //before any track parameters are copied (propagation to the PV keeps the helix)
+            if( fkDoImprovedDCAV0DauPropagation && fkSkipLargeXYDCA && !v0_otf ){
+                const HelixXY &ph = loop->fPosHelix[k];
+                Double_t lDist = TMath::Sqrt( (nh.fXc-ph.fXc)*(nh.fXc-ph.fXc) + (nh.fYc-ph.fYc)*(nh.fYc-ph.fYc) );
+                if( lDist > nh.fR + ph.fR + 2*fV0VertexerSels[3] ) continue;
+                if( lDist < TMath::Abs(nh.fR - ph.fR) - 2*fV0VertexerSels[3] ) continue;
+            }
+            
+            AliExternalTrackParam nt(*ntrk), pt(*ptrk);
+            Bool_t lUsedOptimalParams = kFALSE;
+            
+            if( v0_otf ){
+                AliExternalTrackParam ptimproved(*(v0_otf->GetParamP()));
+                AliExternalTrackParam ntimproved(*(v0_otf->GetParamN()));
+                if( v0_otf->GetParamP()->Charge() > 0 && v0_otf->GetParamN()->Charge() < 0 ) {
+                    //V0 daughter track swapping is required! Note: everything is swapped here... P->N, N->P
+                    pt = ptimproved;
+                    nt = ntimproved;
+                }else{
+                    //swap charges if charges are swapped
+                    pt = ntimproved;
+                    nt = ptimproved;
                 }
+                lOTFStat[1]++;
+                lUsedOptimalParams=kTRUE;
             }
             AliExternalTrackParam *ntp=&nt, *ptp=&pt;
             Double_t xn, xp, dca;
@@ -729,8 +837,8 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
             if (fkResetInitialPositions){
                 Double_t dztemp[2], covartemp[3];
                 //Safety margin: 250 -> exceedingly large... not sure this makes sense, but ok
-                ntp->PropagateToDCA( vtxT3D , b , 250, dztemp, covartemp );
-                ptp->PropagateToDCA( vtxT3D , b , 250, dztemp, covartemp );
+                ntp->PropagateToDCA( loop->fPrimaryVertex , b , 250, dztemp, covartemp );
+                ptp->PropagateToDCA( loop->fPrimaryVertex , b , 250, dztemp, covartemp );
             }
             
             if( fkDoImprovedDCAV0DauPropagation ){
@@ -743,12 +851,12 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
             
             if (dca > fV0VertexerSels[3]) continue;
             
-            fHistV0Statistics->Fill(2.5); //pass dca
+            lStat[2]++; //pass dca
             
             if ((xn+xp) > 2*fV0VertexerSels[6] && fkPreselectX) continue;
             if ((xn+xp) < 2*fV0VertexerSels[5] && fkPreselectX) continue;
             
-            fHistV0Statistics->Fill(3.5); //pass X within R2D cut
+            lStat[3]++; //pass X within R2D cut
             
             if(!fkDoMaterialCorrection){
                 nt.PropagateTo(xn,b);
@@ -763,7 +871,7 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
             if (TMath::Abs(nt.Eta())>0.8&&fkExtraCleanup) continue;
             if (TMath::Abs(pt.Eta())>0.8&&fkExtraCleanup) continue;
             
-            fHistV0Statistics->Fill(4.5); //pass eta cut
+            lStat[4]++; //pass eta cut
             
             AliESDv0 vertex(nt,nidx,pt,pidx);
             
@@ -778,14 +886,14 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
             if (r2 < fV0VertexerSels[5]*fV0VertexerSels[5]) continue;
             if (r2 > fV0VertexerSels[6]*fV0VertexerSels[6]) continue;
             
-            fHistV0Statistics->Fill(5.5); //pass radius cut
+            lStat[5]++; //pass radius cut
             
             Float_t cpa=vertex.GetV0CosineOfPointingAngle(xPrimaryVertex,yPrimaryVertex,zPrimaryVertex);
             
             //Simple cosine cut (no pt dependence for now)
             if (cpa < fV0VertexerSels[4]) continue;
             
-            fHistV0Statistics->Fill(6.5); //pass cosPA
+            lStat[6]++; //pass cosPA
             
             vertex.SetDcaV0Daughters(dca);
             vertex.SetV0CosineOfPointingAngle(cpa);
@@ -799,21 +907,15 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
             if(lTransvMom<fMinPtV0) continue;
             if(lTransvMom>fMaxPtV0) continue;
             
-            fHistV0Statistics->Fill(7.5); //within pT range
-            if (lUsedOptimalParams) fHistV0Statistics->Fill(8.5); //good V0, used OTF params
-            
-            event->AddV0(&vertex);
-            
-            nvtx++;
+            lStat[7]++; //within pT range
+            if (lUsedOptimalParams) lStat[8]++; //good V0, used OTF params
             
-            //if ( nvtx % 10000 ) gObjectTable->Print(); //debug, REMOVE ME PLEASE
+            loop->fV0s[lFirst].push_back(vertex);
+            loop->fV0Neg[lFirst].push_back(i);
         }
     }
-    Info("Tracks2V0vertices","Number of reconstructed V0 vertices: %ld",nvtx);
-    return nvtx;
 }
 
-
 //________________________________________________________________________
 Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0verticesMC(AliESDEvent *event) {
     //--------------------------------------------------------------------
@@ -1214,6 +1316,13 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
         trk[ntr++]=i;
     }
     
+    //Bachelor helices for pre-screening: with the improved propagation the DCA is measured
+    //from a point of the bachelor helix, so it cannot be below the XY distance between the
+    //helix and the V0 line (not valid with material corrections or OTF bachelor parameters)
+    Bool_t lBachPrescreen = fkDoImprovedDCACascDauPropagation && !fkDoMaterialCorrection && !fkUseOptimalTrackParamsBachelor;
+    std::vector<HelixXY> lBachHelix(lBachPrescreen ? ntr : 0);
+    for (Long_t j=0; j<(Long_t)lBachHelix.size(); j++) GetHelixXY(event->GetTrack(trk[j]), lBachHelix[j], b);
+    
     Double_t massLambda=1.11568;
     Long_t ncasc=0;
     
@@ -1232,6 +1341,7 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
             Float_t lBachMassForTracking=btrk->GetMassForTracking();
             
             if (btrk->GetSign()>0) continue;  // bachelor's charge
+            if (lBachPrescreen && GetMinDistanceXY(lBachHelix[j], &v0) > fCascadeVertexerSels[4]) continue;
             
             AliESDv0 *pv0=&v0;
             AliExternalTrackParam bt(*btrk);
@@ -1327,6 +1437,7 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
             Float_t lBachMassForTracking=btrk->GetMassForTracking();
             
             if (btrk->GetSign()<0) continue;  // bachelor's charge
+            if (lBachPrescreen && GetMinDistanceXY(lBachHelix[j], &v0) > fCascadeVertexerSels[4]) continue;
             
             AliESDv0 *pv0=&v0;
             AliExternalTrackParam bt(*btrk);
@@ -2839,6 +2950,30 @@ void AliAnalysisTaskWeakDecayVertexer::GetHelixCenter(const AliExternalTrackPara
     return;
 }
 
+///________________________________________________________________________
+void AliAnalysisTaskWeakDecayVertexer::GetHelixXY(const AliExternalTrackParam *track, HelixXY &helix, Double_t b){
+    //Center and radius as used in GetDCAV0Dau
+    Double_t lHelix[6], lCenter[2];
+    track->GetHelixParameters(lHelix,b);
+    GetHelixCenter( track, lCenter, b);
+    helix.fXc = lCenter[0];
+    helix.fYc = lCenter[1];
+    helix.fR  = TMath::Abs(1./lHelix[4]);
+}
+
+///________________________________________________________________________
+Double_t AliAnalysisTaskWeakDecayVertexer::GetMinDistanceXY(const HelixXY &helix, AliESDv0 *v0){
+    //Distance in the XY plane between the helix and the line of flight of the V0
+    Double_t xyz[3], pxpypz[3];
+    v0->GetXYZ(xyz[0],xyz[1],xyz[2]);
+    v0->GetPxPyPz(pxpypz[0],pxpypz[1],pxpypz[2]);
+    Double_t pt = TMath::Sqrt(pxpypz[0]*pxpypz[0]+pxpypz[1]*pxpypz[1]);
+    if( pt < 1e-10 ) return 0.;
+    //distance of the helix center to the line along the perpendicular unit vector
+    Double_t lDist = TMath::Abs( ((xyz[0]-helix.fXc)*(-pxpypz[1]) + (xyz[1]-helix.fYc)*pxpypz[0])/pt );
+    return lDist > helix.fR ? lDist - helix.fR : 0.;
+}
+
 ///________________________________________________________________________
 void AliAnalysisTaskWeakDecayVertexer::SelectiveResetV0s(AliESDEvent *event, Int_t lType){
     //Selectively reset V0s
@@ -38,6 +38,7 @@ class AliPhysicsSelection;
 #include "AliEventCuts.h"
 //For mapping functionality
 #include <map>
+#include <vector>
 
 using namespace std;
 
@@ -228,6 +229,10 @@ public:
     void SetUseMonteCarloAssociation( Bool_t lOpt = kTRUE) {
         fkMonteCarlo=lOpt;
     }
+    void SetNumberOfThreads( Int_t lNThreads ) {
+        //Threads for the pair loop of Tracks2V0vertices (not used with material corrections)
+        fNThreads = lNThreads > 0 ? lNThreads : 1;
+    }
 //---------------------------------------------------------------------------------------
     void SetUseImprovedFinding(){
         fkRunV0Vertexer = kTRUE;
@@ -291,6 +296,15 @@ public:
     Double_t GetDCAV0Dau ( AliExternalTrackParam *pt, AliExternalTrackParam *nt, Double_t &xp, Double_t &xn, Double_t b, Double_t lNegMassForTracking=0.139, Double_t lPosMassForTracking=0.139);
     void GetHelixCenter(const AliExternalTrackParam *track,Double_t center[2], Double_t b);
     //---------------------------------------------------------------------------------------
+    //Track helix in the XY plane, computed once per track for pre-screening of pairs
+    struct HelixXY {
+        Double_t fXc; //center x
+        Double_t fYc; //center y
+        Double_t fR;  //radius
+    };
+    void GetHelixXY(const AliExternalTrackParam *track, HelixXY &helix, Double_t b);
+    Double_t GetMinDistanceXY(const HelixXY &helix, AliESDv0 *v0);
+    //---------------------------------------------------------------------------------------
     
     //---------------------------------------------------------------------------------------
     // changes to enable AliExternalTrackParam inheritance from on-the-fly finder
@@ -369,6 +383,7 @@ private:
     Double_t fMassWindowAroundCascade;
     
     Double_t fMinXforXYtest; //min X allowed for XY-plane preopt test
+    Int_t fNThreads; //threads for the V0 pair loop
     
     Double_t  fV0VertexerSels[7];        // Array to store the 7 values for the different selections V0 related
     Double_t  fCascadeVertexerSels[8];   // Array to store the 8 values for the different selections Casc. related
@@ -378,6 +393,10 @@ private:
     //(pair) -> (OTF index) map
     std::map<std::pair<int, int>, int> fOTFMap; //std::map to store index pair <-> OTF index equiv
     
+    //Per-event input and output of the V0 pair loop, split in interleaved ranges of negative tracks
+    struct V0PairLoop;
+    void Tracks2V0verticesPairs(V0PairLoop *loop, Int_t lFirst, Int_t lStep);
+    
 //===========================================================================================
 //   Histograms
 //===========================================================================================
@@ -395,8 +414,9 @@ private:
     AliAnalysisTaskWeakDecayVertexer(const AliAnalysisTaskWeakDecayVertexer&);            // not implemented
     AliAnalysisTaskWeakDecayVertexer& operator=(const AliAnalysisTaskWeakDecayVertexer&); // not implemented
 
-    ClassDef(AliAnalysisTaskWeakDecayVertexer, 1);
+    ClassDef(AliAnalysisTaskWeakDecayVertexer, 2);
     //1: first implementation
+    //2: helix pre-screening and threads for the V0 pair loop
 };
 
 #endif
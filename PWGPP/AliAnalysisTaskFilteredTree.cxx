@@ -112,6 +112,9 @@ ClassImp(AliAnalysisTaskFilteredTree)
   , fTrigger(AliTriggerAnalysis::kMB1) 
   , fAnalysisMode(kTPCAnalysisMode) 
   , fTreeSRedirector(0)
+  , fHighPtStream(0)
+  , fV0Stream(0)
+  , fdEdxStream(0)
   , fCentralityEstimator(0)
   , fLowPtTrackDownscaligF(0)
   , fLowPtV0DownscaligF(0)
@@ -142,6 +145,10 @@ ClassImp(AliAnalysisTaskFilteredTree)
   , fPtResCentPtTPCITS(0)
   , fCurrentFileName("")
   , fDummyTrack(0)
+  , fMCLabelFirstTrack()
+  , fMCLabelNextTrack()
+  , fMCLabelIndexEvent(-1)
+  , fEventCounter(0)
 {
   // Constructor
 
@@ -208,9 +215,13 @@ void AliAnalysisTaskFilteredTree::UserCreateOutputObjects()
 
   //
   // Create trees
-  fV0Tree = ((*fTreeSRedirector)<<"V0s").GetTree();
-  fHighPtTree = ((*fTreeSRedirector)<<"highPt").GetTree();
-  fdEdxTree = ((*fTreeSRedirector)<<"dEdx").GetTree();
+  // the streams of the high volume trees are kept, so that filling does not look them up by name
+  fV0Stream = &((*fTreeSRedirector)<<"V0s");
+  fV0Tree = fV0Stream->GetTree();
+  fHighPtStream = &((*fTreeSRedirector)<<"highPt");
+  fHighPtTree = fHighPtStream->GetTree();
+  fdEdxStream = &((*fTreeSRedirector)<<"dEdx");
+  fdEdxTree = fdEdxStream->GetTree();
   fLaserTree = ((*fTreeSRedirector)<<"Laser").GetTree();
   fMCEffTree = ((*fTreeSRedirector)<<"MCEffTree").GetTree();
   fCosmicPairsTree = ((*fTreeSRedirector)<<"CosmicPairs").GetTree();
@@ -330,6 +341,7 @@ void AliAnalysisTaskFilteredTree::UserExec(Option_t *)
     Printf("ERROR: ESD event not available");
     return;
   }
+  fEventCounter++;   // invalidates the per event MC info cache
   //if MC info available - use it.
   fMC = MCEvent();
   if (fMC){  
@@ -745,7 +757,7 @@ void AliAnalysisTaskFilteredTree::Process(AliESDEvent *const esdEvent, AliMCEven
       if(!fFillTree) return;
       if(!fTreeSRedirector) return;
       downscaleCounter++;
-      (*fTreeSRedirector)<<"highPt"<<
+      (*fHighPtStream)<<
         "gid="<<gid<<
         "selectionPtMask="<<selectionPtMask<<
         "fileName.="<<&fCurrentFileName<<            
@@ -1429,8 +1441,8 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
 	  friendTrackStore = (gRandom->Rndm()<1./fFriendDownscaling)? friendTrack:0;
 	}
 	if (fFriendDownscaling<=0){
-	  if (((*fTreeSRedirector)<<"highPt").GetTree()){
-	    TTree * tree = ((*fTreeSRedirector)<<"highPt").GetTree();
+	  if (fHighPtTree){
+	    TTree * tree = fHighPtTree;
 	    if (tree){
 	      Double_t sizeAll=tree->GetZipBytes();
 	      TBranch * br= tree->GetBranch("friendTrack.fPoints");
@@ -1486,7 +1498,7 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
 	}
         if(fTreeSRedirector && dumpToTree && fFillTree) {
 	  downscaleCounter++;
-          (*fTreeSRedirector)<<"highPt"<<
+          (*fHighPtStream)<<
 	    "downscaleCounter="<<downscaleCounter<<
 	    "fLowPtTrackDownscaligF="<<fLowPtTrackDownscaligF<<
 	    "selectionPtMask="<<selectionPtMask<<          // high pt trigger mask
@@ -1533,7 +1545,7 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
             "centralityF="<<centralityF;
 	  // info for 2 track resolution studies and matching efficency studies 
 	  //
-	  (*fTreeSRedirector)<<"highPt"<<
+	  (*fHighPtStream)<<
 	    "paramITS.="<<&paramITS<<                // nearest ITS track  -   chi2 distance at vertex
 	    "paramITSC.="<<&paramITSC<<              // nearest ITS track  -  to constrained track   chi2 distance at vertex
 	    "paramComb.="<<&paramComb<<              // nearest comb. tack -   chi2 distance at inner wall
@@ -1549,7 +1561,7 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
             if (!refEMCAL) refEMCAL = &refDummy;
             if (!refPHOS) refPHOS = &refDummy;
 	    downscaleCounter++;
-            (*fTreeSRedirector)<<"highPt"<<	
+            (*fHighPtStream)<<
               "multMCTrueTracks="<<multMCTrueTracks<<   // mC track multiplicities
               "nrefITS="<<nrefITS<<              // number of track references in the ITS
               "nrefTPC="<<nrefTPC<<              // number of track references in the TPC
@@ -1588,7 +1600,7 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
           }
           //finish writing the entry
           AliInfo("writing tree highPt");
-          (*fTreeSRedirector)<<"highPt"<<"\n";
+          (*fHighPtStream)<<"\n";
         }
         //AliSysInfo::AddStamp("filteringTask",iTrack,numberOfTracks,numberOfFriendTracks,(friendTrackStore)?0:1);
         delete tpcInnerC;
@@ -2050,8 +2062,8 @@ void AliAnalysisTaskFilteredTree::ProcessV0(AliESDEvent *const esdEvent, AliMCEv
 	}
       }
       if (fFriendDownscaling<=0){
-	if (((*fTreeSRedirector)<<"V0s").GetTree()){
-	  TTree * tree = ((*fTreeSRedirector)<<"V0s").GetTree();
+	if (fV0Tree){
+	  TTree * tree = fV0Tree;
 	  if (tree){
 	    Double_t sizeAll=tree->GetZipBytes();
 	    TBranch * br= tree->GetBranch("friendTrack0.fPoints");
@@ -2113,7 +2125,7 @@ void AliAnalysisTaskFilteredTree::ProcessV0(AliESDEvent *const esdEvent, AliMCEv
       }
 
       downscaleCounter++;
-      (*fTreeSRedirector)<<"V0s"<<
+      (*fV0Stream)<<
         "gid="<<gid<<                         //  global id of event
         "fLowPtV0DownscaligF="<<fLowPtV0DownscaligF<<
         "selectionPtMask="<<selectionPtMask<< // selection pt mask
@@ -2268,7 +2280,7 @@ void AliAnalysisTaskFilteredTree::ProcessdEdx(AliESDEvent *const esdEvent, AliMC
       }
 	
       downscaleCounter++;
-      (*fTreeSRedirector)<<"dEdx"<<           // high dEdx tree
+      (*fdEdxStream)<<           // high dEdx tree
         "gid="<<gid<<                         // global id
         "fileName.="<<&fCurrentFileName<<     // file name
         "runNumber="<<runNumber<<
@@ -2690,6 +2702,9 @@ void AliAnalysisTaskFilteredTree::FinishTaskOutput()
   }
   if (deleteTrees) delete fTreeSRedirector;
   fTreeSRedirector=NULL;
+  fHighPtStream=NULL;
+  fV0Stream=NULL;
+  fdEdxStream=NULL;
 }
 
 //_____________________________________________________________________________
@@ -3318,11 +3333,10 @@ Int_t AliAnalysisTaskFilteredTree::GetMCTrackDiff(const TParticle &particle, con
   return 0;
 }
 
-/// # AliAnalysisTaskFilteredTree::GetMCInfoTrack - attach MC track info into map
+/// # AliAnalysisTaskFilteredTree::GetMCInfoTrack - fill MC track info into fixed schema structure
 /// combine MC and reconstruction particle information and calculate derived information
 /// \param label        - track label
-/// \param trackInfoF   - std map with
-/// \param trackInfoO   - std map with object information, map is OWNER of all containing information (shared pointers can be used because of alice C++ limitation)
+/// \param info         - structure to fill, pointers are not owned (particle, references and tracks of the current event)
 /// \return             - 0 OK - >0 error code
 ///
 /// ### Information collected
@@ -3330,30 +3344,31 @@ Int_t AliAnalysisTaskFilteredTree::GetMCTrackDiff(const TParticle &particle, con
 ///    * 2.) particle trajectory information (based on array o AliTrackReference)
 ///    * 3.) reconstruction information (based on the MC label information)
 ///    * 4.) diff between MC and real data at reference planes
-Int_t AliAnalysisTaskFilteredTree::GetMCInfoTrack(Int_t label,  std::map<std::string,float> &trackInfoF, std::map<std::string,TObject*> &trackInfoO){
+Int_t AliAnalysisTaskFilteredTree::GetMCInfoTrack(Int_t label, MCInfoTrack &info){
    // 0.)  define some constants
   const Double_t kTPCOutR=245; // used in loop counters
+  memset(&info,0,sizeof(MCInfoTrack));
+  info.fLabel=label;
+  info.fTrackIndex=-1;
   AliStack * stack = fMC->Stack();
   Int_t mcStackSize=stack->GetNtrack();
-  if (label>mcStackSize){
-    return 1;
+  if (label<0 || label>=mcStackSize){
+    return info.fStatus=1;
   }
   // 1.) particle information
   TParticle *particle=NULL;
   TClonesArray *trackRefs=0;
-  Int_t status = fMC->GetParticleAndTR(label, particle, trackRefs);
-  trackInfoO["p"]=particle;    // particle information
+  fMC->GetParticleAndTR(label, particle, trackRefs);
+  info.fParticle=particle;    // particle information
   if (particle==NULL || particle->GetPDG() ==NULL || particle->GetPDG()->Charge()!=0.) {
-    return 2;
+    return info.fStatus=2;
   }
   // 2.) particle trajectory information
-  Int_t nTrackRef = trackRefs->GetEntries();
-  trackInfoF["nRef"]=nTrackRef;  // number of references
+  Int_t nTrackRef = (trackRefs) ? trackRefs->GetEntries():0;
+  info.fNRef=nTrackRef;  // number of references
   if (nTrackRef==0){
-    return 4;
+    return info.fStatus=4;
   }
-  TVectorF refCounter(21);  // counter of references
-  TVectorF detLength(21);   // track length defined as distance between first and the last track reference in detector
   Double_t maxRadius=0;
   AliTrackReference*detRef[21]={NULL};
   Int_t loopCounter=0;     // turning point counter to check loopers
@@ -3363,11 +3378,11 @@ Int_t AliAnalysisTaskFilteredTree::GetMCInfoTrack(Int_t label,  std::map<std::st
     if (ref->Label() != label) continue;
     Int_t detID=ref->DetectorId();
     if (detID < 0) {
-      trackInfoO["refDecay"] = ref;
+      info.fRefDecay = ref;
       break;
     }
     if (ref->R()>maxRadius) maxRadius=ref->R();
-    refCounter[detID]++;
+    info.fRefCounter[detID]++;
     if (lastLoopRef!=NULL && ref->R()<kTPCOutR){ //loop counter
       Double_t dir0=ref->Px()*ref->X()+ref->Py()*ref->Y();
       Double_t dir1=lastLoopRef->Px()*lastLoopRef->X()+lastLoopRef->Py()*lastLoopRef->Y();
@@ -3377,43 +3392,35 @@ Int_t AliAnalysisTaskFilteredTree::GetMCInfoTrack(Int_t label,  std::map<std::st
       }
     }
     if (lastLoopRef==NULL) lastLoopRef=ref;
-    if (refCounter[detID] >0){
-      detLength[detID]=ref->GetLength()-detRef[detID]->GetLength();
+    if (detRef[detID]!=NULL){
+      info.fDetLength[detID]=ref->GetLength()-detRef[detID]->GetLength();
     }else{
       detRef[detID]=ref;
     }
   }
-  trackInfoO["refCounter"]=new TVectorF(refCounter);
-  trackInfoO["detLength"]=new TVectorF(detLength);
-  trackInfoF["loopCounter"]=loopCounter;
-  trackInfoF["maxRadius"]=maxRadius;
+  info.fLoopCounter=loopCounter;
+  info.fMaxRadius=maxRadius;
   // 3.) Assign - reconstruction information
   //     In case particle reconstructed more than once - use the best
-  //     Distance definition ???
-  Int_t ntracks=fESD->GetNumberOfTracks();
-  Int_t nRecITS=0, nRecTPC=0, nRecTRD=0, nRecTOF=0;
+  //     Only the tracks with the given label are visited (label index built once per event)
   AliESDtrack * esdTrack=NULL;
   AliESDtrack * itsTrack=0;
   Int_t detRecLength=0, trackIndex=-1;
-  for (Int_t iTrack=0;iTrack<ntracks;iTrack++) {
+  BuildMCLabelIndex();
+  Int_t firstTrack=(label<(Int_t)fMCLabelFirstTrack.size()) ? fMCLabelFirstTrack[label]:-1;
+  for (Int_t iTrack=firstTrack;iTrack>=0;iTrack=fMCLabelNextTrack[iTrack]) {
     AliESDtrack *track = fESD->GetTrack(iTrack);
-    if (track == NULL) continue;
-    Int_t recoLabel = TMath::Abs(track->GetLabel());
-    if (recoLabel != label) continue;
     // find longest combined track - only "non fake legs" counted
     Int_t detRecLength0 = 0;
-    if (TMath::Abs(track->GetITSLabel()) == label) detRecLength += track->IsOn(AliESDtrack::kITSin) +
+    if (TMath::Abs(track->GetITSLabel()) == label) detRecLength0 += track->IsOn(AliESDtrack::kITSin) +
                                                                 track->IsOn(AliESDtrack::kITSrefit);
-    if (TMath::Abs(track->GetTPCLabel()) == label) detRecLength += track->IsOn(AliESDtrack::kTPCin) +
+    if (TMath::Abs(track->GetTPCLabel()) == label) detRecLength0 += track->IsOn(AliESDtrack::kTPCin) +
                                                                 track->IsOn(AliESDtrack::kTPCrefit);
-    if (TMath::Abs(track->GetTRDLabel()) == label) detRecLength += track->IsOn(AliESDtrack::kTRDout) +
+    if (TMath::Abs(track->GetTRDLabel()) == label) detRecLength0 += track->IsOn(AliESDtrack::kTRDout) +
                                                                 track->IsOn(AliESDtrack::kTRDrefit);
-    if (track->IsOn(AliESDtrack::kITSin)) nRecITS++;
-    if (track->IsOn(AliESDtrack::kTPCin)) nRecTPC++;
-    if (track->IsOn(AliESDtrack::kTRDout)) nRecTRD++;
     // in case the same "detector length" use most precise angular pz/pt determination
     // TODO - pz/pt chosen because valid also for secondary particles, better to use combined chi2, More complex - closest reference to be used in that case
-    if (detRecLength == detRecLength0) {
+    if (esdTrack!=NULL && detRecLength == detRecLength0) {
       Double_t tglParticle = particle->Pz() / particle->Pt();
       Double_t deltaTgl0 = esdTrack->Pz() / esdTrack->Pt() - tglParticle;
       Double_t deltaTgl1 = track->Pz() / track->Pt() - tglParticle;
@@ -3422,7 +3429,7 @@ Int_t AliAnalysisTaskFilteredTree::GetMCInfoTrack(Int_t label,  std::map<std::st
         trackIndex = iTrack;
       }
     }
-    if (detRecLength < detRecLength0) {
+    if (esdTrack==NULL || detRecLength < detRecLength0) {
       detRecLength = detRecLength0;
       esdTrack = track;
       trackIndex = iTrack;
@@ -3431,35 +3438,68 @@ Int_t AliAnalysisTaskFilteredTree::GetMCInfoTrack(Int_t label,  std::map<std::st
       itsTrack = track;
     }
   }
-  trackInfoO["esdTrack"]=esdTrack;
-  trackInfoO["itsTrack"]=itsTrack;
+  info.fEsdTrack=esdTrack;
+  info.fItsTrack=itsTrack;
+  info.fTrackIndex=trackIndex;
   //4.) diff between MC and real data at reference planes
-  TVectorF mcDiff(5);
   if (esdTrack!=NULL){
-    if (GetMCTrackDiff(*particle,*(esdTrack), *trackRefs, mcDiff)==0){
-        trackInfoO["diffesdTrack"]=new TVectorF(mcDiff);
-    };
-    if (esdTrack->GetTPCInnerParam()){
-      if (GetMCTrackDiff(*particle,*(esdTrack->GetTPCInnerParam()), *trackRefs, mcDiff)==0){
-        trackInfoO["diffTPCInnerParam"]=new TVectorF(mcDiff);
-      };
-    }
-    if (esdTrack->GetInnerParam()){
-      if (GetMCTrackDiff(*particle,*(esdTrack->GetInnerParam()), *trackRefs, mcDiff)==0){
-        trackInfoO["diffInnerParam"]=new TVectorF(mcDiff);
-      };
-    }
-    if (esdTrack->GetOuterParam()){
-      if (GetMCTrackDiff(*particle,*(esdTrack->GetOuterParam()), *trackRefs, mcDiff)==0){
-        trackInfoO["diffOuterParam"]=new TVectorF(mcDiff);
-      };
-    }
-    if (esdTrack->GetOuterHmpParam()){
-      if (GetMCTrackDiff(*particle,*(esdTrack->GetOuterHmpParam()), *trackRefs, mcDiff)==0){
-        trackInfoO["diffOuterHmpParam"]=new TVectorF(mcDiff);
-      };
+    const AliExternalTrackParam *params[kNMCDiffParams]={esdTrack, esdTrack->GetTPCInnerParam(), esdTrack->GetInnerParam(),
+                                                         esdTrack->GetOuterParam(), esdTrack->GetOuterHmpParam()};
+    TVectorF mcDiff(5);
+    for (Int_t iParam=0; iParam<kNMCDiffParams; iParam++){
+      if (params[iParam]==NULL) continue;
+      if (GetMCTrackDiff(*particle,*(params[iParam]), *trackRefs, mcDiff)!=0) continue;
+      info.fHasDiff[iParam]=kTRUE;
+      for (Int_t iPar=0; iPar<5; iPar++) info.fDiff[iParam][iPar]=mcDiff[iPar];
     }
   }
+  return info.fStatus=0;
+}
+
+/// Index of the ESD tracks by abs(label) - linked list (first track per label, next track with the same label)
+/// built once per event
+void AliAnalysisTaskFilteredTree::BuildMCLabelIndex(){
+  if (fMCLabelIndexEvent==fEventCounter) return;
+  fMCLabelIndexEvent=fEventCounter;
+  Int_t ntracks=fESD->GetNumberOfTracks();
+  fMCLabelNextTrack.assign(ntracks,-1);
+  std::fill(fMCLabelFirstTrack.begin(),fMCLabelFirstTrack.end(),-1);
+  for (Int_t iTrack=ntracks-1;iTrack>=0;iTrack--) {   // backward - the lists are in the track order
+    AliESDtrack *track = fESD->GetTrack(iTrack);
+    if (track == NULL) continue;
+    Int_t recoLabel = TMath::Abs(track->GetLabel());
+    if (recoLabel>=(Int_t)fMCLabelFirstTrack.size()) fMCLabelFirstTrack.resize(recoLabel+1,-1);
+    fMCLabelNextTrack[iTrack]=fMCLabelFirstTrack[recoLabel];
+    fMCLabelFirstTrack[recoLabel]=iTrack;
+  }
+}
+
+/// # AliAnalysisTaskFilteredTree::GetMCInfoTrack - attach MC track info into map
+/// Same information as in the MCInfoTrack structure, kept for the string map based interface
+/// \param label        - track label
+/// \param trackInfoF   - std map with
+/// \param trackInfoO   - std map with object information, map is OWNER of all containing information (shared pointers can be used because of alice C++ limitation)
+/// \return             - 0 OK - >0 error code
+Int_t AliAnalysisTaskFilteredTree::GetMCInfoTrack(Int_t label,  std::map<std::string,float> &trackInfoF, std::map<std::string,TObject*> &trackInfoO){
+  static const char * diffNames[kNMCDiffParams]={"diffesdTrack","diffTPCInnerParam","diffInnerParam","diffOuterParam","diffOuterHmpParam"};
+  if (!fMC || !fMC->Stack()) return 1;
+  MCInfoTrack info;
+  GetMCInfoTrack(label,info);
+  if (info.fStatus==1) return 1;
+  trackInfoO["p"]=info.fParticle;
+  if (info.fStatus==2) return 2;
+  trackInfoF["nRef"]=info.fNRef;
+  if (info.fStatus==4) return 4;
+  if (info.fRefDecay) trackInfoO["refDecay"]=info.fRefDecay;
+  trackInfoO["refCounter"]=new TVectorF(21,info.fRefCounter);
+  trackInfoO["detLength"]=new TVectorF(21,info.fDetLength);
+  trackInfoF["loopCounter"]=info.fLoopCounter;
+  trackInfoF["maxRadius"]=info.fMaxRadius;
+  trackInfoO["esdTrack"]=info.fEsdTrack;
+  trackInfoO["itsTrack"]=info.fItsTrack;
+  for (Int_t iParam=0; iParam<kNMCDiffParams; iParam++){
+    if (info.fHasDiff[iParam]) trackInfoO[diffNames[iParam]]=new TVectorF(5,info.fDiff[iParam]);
+  }
   return 0;
 }
 
@@ -3475,9 +3515,8 @@ void AliAnalysisTaskFilteredTree::ProcessMC(){
   AliStack * stack = fMC->Stack();
   if (!stack) return;
   Int_t mcStackSize=stack->GetNtrack();
-  std::map<std::string,float> trackInfoF;
-  std::map<std::string,TObject*> trackInfoO;
   static Int_t downscaleCounter=0;
+  MCInfoTrack info;
   for (Int_t iMc = 0; iMc < mcStackSize; ++iMc) {
     TParticle *particle = stack->Particle(iMc);
     if (!particle) continue;
@@ -3486,7 +3525,7 @@ void AliAnalysisTaskFilteredTree::ProcessMC(){
     Double_t downscaleF = gRandom->Rndm();
     downscaleF *= fLowPtTrackDownscaligF;
     if (downscaleCounter>0 && TMath::Exp(2*scalempt)<downscaleF) continue;
-    Int_t result = GetMCInfoTrack(iMc, trackInfoF,trackInfoO);
+    GetMCInfoTrack(iMc, info);
 
   }
 }
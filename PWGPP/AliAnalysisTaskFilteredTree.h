@@ -42,10 +42,13 @@ class TList;
 class TObjArray;
 class TTree;
 class TTreeSRedirector;
+class TTreeStream;
+class AliTrackReference;
 class TParticle;
 class TH3D;
 class AliESDtools;
 #include <string>
+#include <vector>
 
 #include "AliTriggerAnalysis.h"
 #include "AliAnalysisTaskSE.h"
@@ -57,6 +60,27 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
                       kTPCITSAnalysisMode=0,
                       kTPCAnalysisMode=1 };
 
+  /// reference parameters of the assigned ESD track compared to the MC particle (see GetMCTrackDiff)
+  enum EMCDiffParam { kDiffEsdTrack=0, kDiffTPCInnerParam, kDiffInnerParam, kDiffOuterParam, kDiffOuterHmpParam, kNMCDiffParams };
+
+  /// MC information of one particle as filled by GetMCInfoTrack - fixed schema, no allocation
+  struct MCInfoTrack {
+    Int_t              fLabel;                         // MC label
+    Int_t              fStatus;                        // return code of GetMCInfoTrack (0 - OK)
+    TParticle         *fParticle;                      // particle
+    AliTrackReference *fRefDecay;                      // decay track reference
+    Int_t              fNRef;                          // number of track references
+    Int_t              fLoopCounter;                   // number of turning points (loopers)
+    Float_t            fMaxRadius;                     // maximal radius of the track references
+    Float_t            fRefCounter[21];                // number of references per detector
+    Float_t            fDetLength[21];                 // track length per detector
+    AliESDtrack       *fEsdTrack;                      // best reconstructed track
+    AliESDtrack       *fItsTrack;                      // ITS standalone track
+    Int_t              fTrackIndex;                    // index of fEsdTrack
+    Bool_t             fHasDiff[kNMCDiffParams];       // fDiff filled
+    Float_t            fDiff[kNMCDiffParams][5];       // diff of the reference parameters
+  };
+
   AliAnalysisTaskFilteredTree(const char *name = "AliAnalysisTaskFilteredTree");
   virtual ~AliAnalysisTaskFilteredTree();
   
@@ -136,6 +160,8 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   static void SetDefaultAliasesV0(TTree *treeV0);
   static void SetDefaultAliasesHighPt(TTree *treeV0);
   Int_t GetMCInfoTrack(Int_t label,   std::map<std::string,float> &trackInfoF, std::map<std::string,TObject*> &trackInfoO);  //TODO- test before enabling
+  Int_t GetMCInfoTrack(Int_t label, MCInfoTrack &info);
+  void  BuildMCLabelIndex();                                  // ESD tracks by MC label, once per event
   Int_t GetMCInfoKink(Int_t label,    std::map<std::string,float> &kinkInfoF, std::map<std::string,TObject*> &kinkInfoO);  // TODO
   static Int_t GetMCTrackDiff(const TParticle &particle, const AliExternalTrackParam &param, TClonesArray &trackRefArray, TVectorF &mcDiff); //TODO test before enabling
   /// sqrt s - mass dependent downsampling trigger (pt spectra as parameterized in https://iopscience.iop.org/article/10.1088/2399-6528/aab00f/pdf)
@@ -162,6 +188,9 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   EAnalysisMode fAnalysisMode;   // analysis mode TPC only, TPC + ITS
 
   TTreeSRedirector* fTreeSRedirector;      //! temp tree to dump output
+  TTreeStream* fHighPtStream;              //! stream of the highPt tree (cached to avoid the lookup by name)
+  TTreeStream* fV0Stream;                  //! stream of the V0s tree
+  TTreeStream* fdEdxStream;                //! stream of the dEdx tree
 
   TString fCentralityEstimator;     // use centrality can be "VOM" (default), "FMD", "TRK", "TKL", "CL0", "CL1", "V0MvsFMD", "TKLvsV0M", "ZEMvsZDC"
 
@@ -199,10 +228,14 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   TH3D* fPtResCentPtTPCITS; //! sigma(pt)/pt vs Cent vs Pt for prim. TPC+ITS tracks
   TObjString fCurrentFileName; // cached value of current file name
   AliESDtrack* fDummyTrack; //! dummy track for tree init
+  std::vector<Int_t> fMCLabelFirstTrack;     //! first ESD track with a given abs(label), -1 if none
+  std::vector<Int_t> fMCLabelNextTrack;      //! next ESD track with the same abs(label)
+  Int_t fMCLabelIndexEvent;                  //! event counter at which the label index was built
+  Int_t fEventCounter;                       //! number of processed events
 
   AliAnalysisTaskFilteredTree(const AliAnalysisTaskFilteredTree&); // not implemented
   AliAnalysisTaskFilteredTree& operator=(const AliAnalysisTaskFilteredTree&); // not implemented
-  ClassDef(AliAnalysisTaskFilteredTree, 1); // example of analysis
+  ClassDef(AliAnalysisTaskFilteredTree, 4); // example of analysis
 };
 
 #endif
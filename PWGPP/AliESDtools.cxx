@@ -65,6 +65,8 @@
 #include "TF3.h"
 #include "TStatToolkit.h"
 #include <stdarg.h>
+#include <algorithm>
+#include <vector>
 #include "AliNDLocalRegression.h"
 #include "AliESDEvent.h"
 #include "AliLumiTools.h"
@@ -374,6 +376,20 @@ void AliESDtools::ProcessITSTPCmatchOut(AliESDEvent *const esdEvent, AliESDfrien
     }
   }
   //
+  // 0.b) Sort the TPC tracks in bins of the position phi angle at the reference radius (bin width = fast phi cut)
+  //      and by z inside of the bin - only the tracks in the (phi,z) window of the ITS track are visited
+  //
+  const Int_t nPhiBins=TMath::CeilNint(TMath::TwoPi()/dFastPosPhiCut);
+  std::vector<std::vector<std::pair<Double_t,Int_t> > > tpcByPhiZ(nPhiBins);  // (z, track index) per phi bin
+  for (Int_t iTrack=0; iTrack<nTracks; iTrack++){
+    AliESDtrack *track = esdEvent->GetTrack(iTrack);
+    if(!track) continue;
+    if (!track->IsOn(AliVTrack::kTPCin) || !track->GetInnerParam()) continue;
+    Int_t iPhi=TMath::Min(nPhiBins-1,TMath::Max(0,Int_t((vecPosR1(iTrack,3)+TMath::Pi())/dFastPosPhiCut)));
+    tpcByPhiZ[iPhi].push_back(std::make_pair(vecPosR1(iTrack,2),iTrack));
+  }
+  for (Int_t iPhi=0; iPhi<nPhiBins; iPhi++) std::sort(tpcByPhiZ[iPhi].begin(),tpcByPhiZ[iPhi].end());
+  //
   // 1.) Find closest matching tracks, between the ITS standalone track
   // and  the all other tracks
   //  a.) category  - All
@@ -385,6 +401,10 @@ void AliESDtools::ProcessITSTPCmatchOut(AliESDEvent *const esdEvent, AliESDfrien
   AliESDtrack           esdTrackDummy;
   AliExternalTrackParam itsAtTPC;
   AliExternalTrackParam itsAtITSTPC;
+  std::vector<Int_t> candidates;                                      // TPC tracks in the (phi,z) window
+  std::vector<Double_t> rotatedAlpha;                                 // ITS track rotated once per TPC track frame
+  std::vector<AliExternalTrackParam> rotatedITS;                      //
+  std::vector<Bool_t> rotatedOK;                                      //
   for (Int_t iTrack0=0; iTrack0<nTracks; iTrack0++){
     AliESDtrack *track0 = esdEvent->GetTrack(iTrack0);
     if(!track0) continue;
@@ -407,10 +427,25 @@ void AliESDtools::ProcessITSTPCmatchOut(AliESDEvent *const esdEvent, AliESDfrien
     Int_t nCandidates1=0; // n candidates - rough + chi2 cut
     itsAtTPC=*(friendTrack0->GetITSOut());
     itsAtITSTPC=*(friendTrack0->GetITSOut());
-    for (Int_t iTrack1=0; iTrack1<nTracks; iTrack1++){
+    //
+    // collect the TPC tracks of the window, in the original track order (same result for equal chi2)
+    candidates.clear();
+    const Double_t phi0=vecPosR0(iTrack0,3), z0=vecPosR0(iTrack0,2);
+    const Int_t iPhiMin=TMath::Max(0,Int_t((phi0-dFastPosPhiCut+TMath::Pi())/dFastPosPhiCut));
+    const Int_t iPhiMax=TMath::Min(nPhiBins-1,Int_t((phi0+dFastPosPhiCut+TMath::Pi())/dFastPosPhiCut));
+    for (Int_t iPhi=iPhiMin; iPhi<=iPhiMax; iPhi++){
+      const std::vector<std::pair<Double_t,Int_t> > &bin=tpcByPhiZ[iPhi];
+      std::vector<std::pair<Double_t,Int_t> >::const_iterator it=std::lower_bound(bin.begin(),bin.end(),std::make_pair(z0-dFastZCut,-1));
+      for (; it!=bin.end() && it->first<=z0+dFastZCut; ++it) candidates.push_back(it->second);
+    }
+    std::sort(candidates.begin(),candidates.end());
+    rotatedAlpha.clear();
+    rotatedITS.clear();
+    rotatedOK.clear();
+    //
+    for (UInt_t iCandidate=0; iCandidate<candidates.size(); iCandidate++){
+      const Int_t iTrack1=candidates[iCandidate];
       AliESDtrack *track1 = esdEvent->GetTrack(iTrack1);
-      if(!track1) continue;
-      if (!track1->IsOn(AliVTrack::kTPCin)) continue;
       // fast checks
       //
       if (TMath::Abs(vecPosR1(iTrack1,2)-vecPosR0(iTrack0,2))>dFastZCut) continue;
@@ -421,9 +456,16 @@ void AliESDtools::ProcessITSTPCmatchOut(AliESDEvent *const esdEvent, AliESDfrien
       nCandidates0++;
       //
       const AliExternalTrackParam * param1= track1->GetInnerParam();
-      if (!friendTrack0->GetITSOut()) continue;
-      AliExternalTrackParam outerITS = *(friendTrack0->GetITSOut());
-      if (!outerITS.Rotate(param1->GetAlpha())) continue;
+      // the inner TPC parameters are in few sector frames - rotate the ITS track only once per frame
+      UInt_t iRotated=0;
+      while (iRotated<rotatedAlpha.size() && rotatedAlpha[iRotated]!=param1->GetAlpha()) iRotated++;
+      if (iRotated==rotatedAlpha.size()){
+        rotatedAlpha.push_back(param1->GetAlpha());
+        rotatedITS.push_back(*(friendTrack0->GetITSOut()));
+        rotatedOK.push_back(rotatedITS.back().Rotate(param1->GetAlpha()));
+      }
+      if (!rotatedOK[iRotated]) continue;
+      AliExternalTrackParam outerITS = rotatedITS[iRotated];
       if (!outerITS.PropagateTo(param1->GetX(),bz)) continue; // assume track close to the TPC inner wall
       Double_t chi2 =  outerITS.GetPredictedChi2(param1);
       if (chi2>chi2Cut) continue;
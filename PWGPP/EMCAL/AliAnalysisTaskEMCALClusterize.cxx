@@ -888,6 +888,10 @@ void AliAnalysisTaskEMCALClusterize::ClusterizeCells()
   
   Int_t bc = InputEvent()->GetBunchCrossNumber();
 
+  // Exotic flag of all the cells, by position in the list of cells
+  std::vector<Bool_t> isExotic;
+  fRecoUtils->FlagExoticCells(fCaloCells, bc, isExotic);
+
   for (Int_t icell = 0; icell < fCaloCells->GetNumberOfCells(); icell++)
   {
     // Get cell values, recalibrate and not include bad channels found in analysis, nor cells with too low energy, nor exotic cell
@@ -912,7 +916,7 @@ void AliAnalysisTaskEMCALClusterize::ClusterizeCells()
     }
     
     //Exotic?
-    if (accept && fRecoUtils->IsExoticCell(id,fCaloCells,bc))
+    if (accept && isExotic[icell])
         accept = kFALSE;
     
     if( !accept )
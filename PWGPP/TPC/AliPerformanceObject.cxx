@@ -56,7 +56,8 @@ AliPerformanceObject::AliPerformanceObject(TRootIOCtor*):
   fUseTOFBunchCrossing(kFALSE),
   fUseSparse(1),
   fCutsRC(),
-  fCutsMC()
+  fCutsMC(),
+  fDerivedProjections()
 {
   // io constructor
 }
@@ -77,7 +78,8 @@ AliPerformanceObject::AliPerformanceObject(const char* name, const char* title,
   fUseTOFBunchCrossing(kFALSE),
   fUseSparse(1),
   fCutsRC(),
-  fCutsMC()
+  fCutsMC(),
+  fDerivedProjections()
 {
 
     // constructor
@@ -252,3 +254,37 @@ void AliPerformanceObject::AddProjection(TObjArray* aFolderObj, TString nameSpar
   h3->SetTitle(title.Data());  
   aFolderObj->Add(h3);
 }
+
+//_____________________________________________________________________________
+void AliPerformanceObject::AddDerivedProjection(TH1* h, Int_t xDim, Int_t yDim, Int_t zDim, Int_t chargeAxis, Int_t chargeSel)
+{
+  // register a histogram filled by FillDerivedProjections()
+  if (!h) return;
+  DerivedProjection proj;
+  proj.fHisto = h;
+  proj.fDim[0] = xDim;
+  proj.fDim[1] = yDim;
+  proj.fDim[2] = zDim;
+  proj.fNDim = (zDim >= 0) ? 3 : ((yDim >= 0) ? 2 : 1);
+  proj.fChargeAxis = chargeAxis;
+  proj.fChargeSel = (chargeAxis >= 0) ? chargeSel : 0;
+  if (h->GetDimension() != proj.fNDim) {
+    AliError(Form("%s: histogram dimension %d does not match %d projected variables", h->GetName(), h->GetDimension(), proj.fNDim));
+    return;
+  }
+  fDerivedProjections.push_back(proj);
+}
+
+//_____________________________________________________________________________
+void AliPerformanceObject::FillDerivedProjections(const Double_t* vars) const
+{
+  // fill all registered histograms from one variable vector
+  for (UInt_t i = 0; i < fDerivedProjections.size(); i++) {
+    const DerivedProjection& proj = fDerivedProjections[i];
+    if (proj.fChargeSel > 0 && !(vars[proj.fChargeAxis] > 0)) continue;
+    if (proj.fChargeSel < 0 && vars[proj.fChargeAxis] > 0) continue;
+    if (proj.fNDim == 1) proj.fHisto->Fill(vars[proj.fDim[0]]);
+    else if (proj.fNDim == 2) ((TH2*)proj.fHisto)->Fill(vars[proj.fDim[0]], vars[proj.fDim[1]]);
+    else ((TH3*)proj.fHisto)->Fill(vars[proj.fDim[0]], vars[proj.fDim[1]], vars[proj.fDim[2]]);
+  }
+}
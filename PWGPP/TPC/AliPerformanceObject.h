@@ -10,12 +10,14 @@
 // Changes by J.Salzwedel 29/9/2014
 //------------------------------------------------------------------------------
 
+#include <vector>
 #include "TNamed.h"
 #include "TFolder.h"
 #include "THnSparse.h"
 #include "AliMergeable.h"
 
 class TTree;
+class TH1;
 class AliMCEvent;
 class AliVEvent;
 class AliRecInfoCuts;
@@ -124,6 +126,14 @@ protected:
   void AddProjection(TObjArray* aFolderObj, TString nameSparse, THnSparse *hSparse, Int_t xDim, Int_t yDim, TString* selString = 0);
   void AddProjection(TObjArray* aFolderObj, TString nameSparse, THnSparse *hSparse, Int_t xDim, Int_t yDim, Int_t zDim, TString* selString = 0);
 
+  // derived histograms filled directly from the per-track variable vector
+  // (the axes of the sparse master histogram), declared once in Init()
+  // chargeSel: 0 all, +1 vars[chargeAxis]>0, -1 otherwise
+  void AddDerivedProjection(TH1* h, Int_t xDim, Int_t yDim = -1, Int_t zDim = -1, Int_t chargeAxis = -1, Int_t chargeSel = 0);
+  void FillDerivedProjections(const Double_t* vars) const;
+  void ClearDerivedProjections() { fDerivedProjections.clear(); }
+  Int_t GetNDerivedProjections() const { return fDerivedProjections.size(); }
+
   // merge THnSparse
   Bool_t fMergeTHnSparseObj;
   
@@ -155,7 +165,18 @@ protected:
   AliRecInfoCuts fCutsRC;  // selection cuts for reconstructed tracks
   AliMCInfoCuts  fCutsMC;  // selection cuts for MC tracks
 
-  ClassDef(AliPerformanceObject,11);
+private:
+
+  struct DerivedProjection {
+    TH1*  fHisto;      // target histogram, owned by the derived class output
+    Int_t fNDim;       // 1, 2 or 3
+    Int_t fDim[3];     // variable index per histogram axis
+    Int_t fChargeAxis; // variable used for the charge split, -1 if none
+    Int_t fChargeSel;  // 0 all, +1 positive, -1 negative
+  };
+  std::vector<DerivedProjection> fDerivedProjections; //! registered derived histograms
+
+  ClassDef(AliPerformanceObject,12);
 };
 
 #endif
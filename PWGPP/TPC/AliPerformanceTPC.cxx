@@ -118,7 +118,8 @@ AliPerformanceTPC::AliPerformanceTPC(TRootIOCtor*):
   h_tpc_track_pos_recvertex_3_5_6(NULL),
   h_tpc_track_pos_recvertex_4_5_6(NULL),
   h_tpc_track_neg_recvertex_3_5_6(NULL),
-  h_tpc_track_neg_recvertex_4_5_6(NULL)
+  h_tpc_track_neg_recvertex_4_5_6(NULL),
+  fTrackVertex(NULL)
 {
   // io ctor
 }
@@ -162,7 +163,8 @@ AliPerformanceTPC::AliPerformanceTPC(const Char_t* name, const Char_t* title,Int
   h_tpc_track_pos_recvertex_3_5_6(NULL),
   h_tpc_track_pos_recvertex_4_5_6(NULL),
   h_tpc_track_neg_recvertex_3_5_6(NULL),
-  h_tpc_track_neg_recvertex_4_5_6(NULL)
+  h_tpc_track_neg_recvertex_4_5_6(NULL),
+  fTrackVertex(NULL)
 {
 
 // named constructor
@@ -526,6 +528,28 @@ void AliPerformanceTPC::Init()
         fFolderObj->Add(h_tpc_track_neg_recvertex_4_5_6);
         fFolderObj->Add(h_tpc_track_pos_recvertex_2_5_6);
         fFolderObj->Add(h_tpc_track_neg_recvertex_2_5_6);
+
+        // derived histograms of nClust:chi2PerClust:nClust/nFindableClust:DCAr:DCAz:eta:phi:pt:charge:vertStatus,
+        // filled from the track variable vector in ProcessTPC/ProcessTPCITS
+        ClearDerivedProjections();
+        AddDerivedProjection(h_tpc_track_all_recvertex_5_8, 5, 8);
+        AddDerivedProjection(h_tpc_track_all_recvertex_1_5_7, 1, 5, 7);
+        AddDerivedProjection(h_tpc_track_all_recvertex_2_5_7, 2, 5, 7);
+        AddDerivedProjection(h_tpc_track_all_recvertex_0_5_7, 0, 5, 7);
+        AddDerivedProjection(h_tpc_track_pos_recvertex_0_5_7, 0, 5, 7, 8, +1);
+        AddDerivedProjection(h_tpc_track_neg_recvertex_0_5_7, 0, 5, 7, 8, -1);
+        AddDerivedProjection(h_tpc_track_all_recvertex_3_5_7, 3, 5, 7);
+        AddDerivedProjection(h_tpc_track_pos_recvertex_3_5_7, 3, 5, 7, 8, +1);
+        AddDerivedProjection(h_tpc_track_neg_recvertex_3_5_7, 3, 5, 7, 8, -1);
+        AddDerivedProjection(h_tpc_track_all_recvertex_4_5_7, 4, 5, 7);
+        AddDerivedProjection(h_tpc_track_pos_recvertex_4_5_7, 4, 5, 7, 8, +1);
+        AddDerivedProjection(h_tpc_track_neg_recvertex_4_5_7, 4, 5, 7, 8, -1);
+        AddDerivedProjection(h_tpc_track_pos_recvertex_3_5_6, 3, 5, 6, 8, +1);
+        AddDerivedProjection(h_tpc_track_neg_recvertex_3_5_6, 3, 5, 6, 8, -1);
+        AddDerivedProjection(h_tpc_track_pos_recvertex_4_5_6, 4, 5, 6, 8, +1);
+        AddDerivedProjection(h_tpc_track_neg_recvertex_4_5_6, 4, 5, 6, 8, -1);
+        AddDerivedProjection(h_tpc_track_pos_recvertex_2_5_6, 2, 5, 6, 8, +1);
+        AddDerivedProjection(h_tpc_track_neg_recvertex_2_5_6, 2, 5, 6, 8, -1);
     }
 
   // init folder
@@ -566,9 +590,13 @@ void AliPerformanceTPC::ProcessTPC(AliMCEvent* const mcev, AliVTrack *const vTra
     if( IsUseTrackVertex() )
     {
     // Relate TPC inner params to prim. vertex
+        // track vertex of the event, fetched once per event in Exec()
         AliESDVertex vertex;
-        vEvent->GetPrimaryVertexTracks(vertex);
-        const AliVVertex *vVertex = &vertex;
+        const AliVVertex *vVertex = fTrackVertex;
+        if(!vVertex) {
+          vEvent->GetPrimaryVertexTracks(vertex);
+          vVertex = &vertex;
+        }
         Double_t x[3];
         pTrackParams->GetXYZ(x);
         Double_t b[3];
@@ -631,33 +659,7 @@ void AliPerformanceTPC::ProcessTPC(AliMCEvent* const mcev, AliVTrack *const vTra
     if(fUseSparse) {
       fTPCTrackHisto->Fill(vTPCTrackHisto);
     } else {
-        if(h_tpc_track_all_recvertex_5_8) h_tpc_track_all_recvertex_5_8->Fill(vTPCTrackHisto[5],vTPCTrackHisto[8]);
-        if(h_tpc_track_all_recvertex_1_5_7) h_tpc_track_all_recvertex_1_5_7->Fill(vTPCTrackHisto[1],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        if(h_tpc_track_all_recvertex_2_5_7) h_tpc_track_all_recvertex_2_5_7->Fill(vTPCTrackHisto[2],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-            
-        double q = vTPCTrackHisto[8];
-            
-        if (h_tpc_track_all_recvertex_0_5_7) h_tpc_track_all_recvertex_0_5_7->Fill(vTPCTrackHisto[0],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        if(q > 0 && h_tpc_track_pos_recvertex_0_5_7) h_tpc_track_pos_recvertex_0_5_7->Fill(vTPCTrackHisto[0],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        else if (h_tpc_track_neg_recvertex_0_5_7) h_tpc_track_neg_recvertex_0_5_7->Fill(vTPCTrackHisto[0],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-            
-        if(h_tpc_track_all_recvertex_3_5_7) h_tpc_track_all_recvertex_3_5_7->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        if(q > 0 && h_tpc_track_pos_recvertex_3_5_7) h_tpc_track_pos_recvertex_3_5_7->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        else if(h_tpc_track_neg_recvertex_3_5_7) h_tpc_track_neg_recvertex_3_5_7->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        
-        if(h_tpc_track_all_recvertex_4_5_7) h_tpc_track_all_recvertex_4_5_7->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        if(q > 0 && h_tpc_track_pos_recvertex_4_5_7) h_tpc_track_pos_recvertex_4_5_7->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        else if(h_tpc_track_neg_recvertex_4_5_7) h_tpc_track_neg_recvertex_4_5_7->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        
-        if(q > 0 && h_tpc_track_pos_recvertex_3_5_6) h_tpc_track_pos_recvertex_3_5_6->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-        else if(h_tpc_track_neg_recvertex_3_5_6) h_tpc_track_neg_recvertex_3_5_6->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-            
-        if(q > 0 && h_tpc_track_pos_recvertex_4_5_6) h_tpc_track_pos_recvertex_4_5_6->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-        else if(h_tpc_track_neg_recvertex_4_5_6) h_tpc_track_neg_recvertex_4_5_6->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-            
-        if(q > 0 && h_tpc_track_pos_recvertex_2_5_6) h_tpc_track_pos_recvertex_2_5_6->Fill(vTPCTrackHisto[2],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-        else if(h_tpc_track_neg_recvertex_2_5_6) h_tpc_track_neg_recvertex_2_5_6->Fill(vTPCTrackHisto[2],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-        
+        FillDerivedProjections(vTPCTrackHisto);
     }
     //
   // Fill rec vs MC information
@@ -686,9 +688,13 @@ void AliPerformanceTPC::ProcessTPCITS(AliMCEvent* const mcev, AliVTrack *const v
     
     if( IsUseTrackVertex() )
     {        
+        // track vertex of the event, fetched once per event in Exec()
         AliESDVertex vertex;
-        vEvent->GetPrimaryVertexTracks(vertex);
-        const AliVVertex *vVertex = &vertex;
+        const AliVVertex *vVertex = fTrackVertex;
+        if(!vVertex) {
+          vEvent->GetPrimaryVertexTracks(vertex);
+          vVertex = &vertex;
+        }
         Double_t x[3]; pTrackParams->GetXYZ(x);
         Double_t b[3]; AliTracker::GetBxByBz(x,b);
         Bool_t isOK = pTrackParams->RelateToVVertexBxByBzDCA(vVertex, b, kVeryBig,NULL,dca,cov);
@@ -731,33 +737,7 @@ void AliPerformanceTPC::ProcessTPCITS(AliMCEvent* const mcev, AliVTrack *const v
     if(fUseSparse) {
       fTPCTrackHisto->Fill(vTPCTrackHisto);
     } else {
-        if(h_tpc_track_all_recvertex_5_8) h_tpc_track_all_recvertex_5_8->Fill(vTPCTrackHisto[5],vTPCTrackHisto[8]);
-        if(h_tpc_track_all_recvertex_1_5_7) h_tpc_track_all_recvertex_1_5_7->Fill(vTPCTrackHisto[1],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        if(h_tpc_track_all_recvertex_2_5_7) h_tpc_track_all_recvertex_2_5_7->Fill(vTPCTrackHisto[2],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        
-        double q = vTPCTrackHisto[8];
-        
-        if (h_tpc_track_all_recvertex_0_5_7) h_tpc_track_all_recvertex_0_5_7->Fill(vTPCTrackHisto[0],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        if(q > 0 && h_tpc_track_pos_recvertex_0_5_7) h_tpc_track_pos_recvertex_0_5_7->Fill(vTPCTrackHisto[0],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        else if (h_tpc_track_neg_recvertex_0_5_7) h_tpc_track_neg_recvertex_0_5_7->Fill(vTPCTrackHisto[0],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        
-        if(h_tpc_track_all_recvertex_3_5_7) h_tpc_track_all_recvertex_3_5_7->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        if(q > 0 && h_tpc_track_pos_recvertex_3_5_7) h_tpc_track_pos_recvertex_3_5_7->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        else if(h_tpc_track_neg_recvertex_3_5_7) h_tpc_track_neg_recvertex_3_5_7->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        
-        if(h_tpc_track_all_recvertex_4_5_7) h_tpc_track_all_recvertex_4_5_7->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        if(q > 0 && h_tpc_track_pos_recvertex_4_5_7) h_tpc_track_pos_recvertex_4_5_7->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        else if(h_tpc_track_neg_recvertex_4_5_7) h_tpc_track_neg_recvertex_4_5_7->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        
-        if(q > 0 && h_tpc_track_pos_recvertex_3_5_6) h_tpc_track_pos_recvertex_3_5_6->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-        else if(h_tpc_track_neg_recvertex_3_5_6) h_tpc_track_neg_recvertex_3_5_6->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-        
-        if(q > 0 && h_tpc_track_pos_recvertex_4_5_6) h_tpc_track_pos_recvertex_4_5_6->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-        else if(h_tpc_track_neg_recvertex_4_5_6) h_tpc_track_neg_recvertex_4_5_6->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-        
-        if(q > 0 && h_tpc_track_pos_recvertex_2_5_6) h_tpc_track_pos_recvertex_2_5_6->Fill(vTPCTrackHisto[2],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-        else if(h_tpc_track_neg_recvertex_2_5_6) h_tpc_track_neg_recvertex_2_5_6->Fill(vTPCTrackHisto[2],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-    
+        FillDerivedProjections(vTPCTrackHisto);
     }
   //
   // Fill rec vs MC information
@@ -839,6 +819,8 @@ void AliPerformanceTPC::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent,
   
   // store vertex status
   Bool_t vertStatus = vVertex->GetStatus();
+  // the track vertex is shared by all tracks of the event
+  fTrackVertex = fUseTrackVertex ? vVertex : 0;
   //  Process events
   for (Int_t iTrack = 0; iTrack < vEvent->GetNumberOfTracks(); iTrack++) 
   {
@@ -914,10 +896,12 @@ void AliPerformanceTPC::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent,
     else if(GetAnalysisMode() == 2) ProcessConstrained(mcEvent,vTrack,vEvent);
     else {
       printf("ERROR: AnalysisMode %d \n",fAnalysisMode);
+      fTrackVertex = 0;
       return;
     }
     // TPC only
   } //end iTrack iteration
+  fTrackVertex = 0;
 
     Double_t vtxPosition[3]= {0.,0.,0.};
     vertex.GetXYZ(vtxPosition);
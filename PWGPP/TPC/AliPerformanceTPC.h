@@ -27,6 +27,7 @@ class AliVEvent;
 class AliVEvent;
 class AliVfriendEvent; 
 class TRootIOCtor;
+class AliVVertex;
 
 #include "THnSparse.h"
 #include "AliPerformanceObject.h"
@@ -132,10 +133,12 @@ private:
   TH3D *h_tpc_track_neg_recvertex_3_5_6;//!
   TH3D *h_tpc_track_neg_recvertex_4_5_6;//!
 
+  const AliVVertex *fTrackVertex; //! track vertex of the event being processed
+
   AliPerformanceTPC(const AliPerformanceTPC&); // not implemented
   AliPerformanceTPC& operator=(const AliPerformanceTPC&); // not implemented
 
-  ClassDef(AliPerformanceTPC,15);
+  ClassDef(AliPerformanceTPC,16);
 };
 
 #endif